@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015-2025 Arm Limited. All rights reserved.
+ * Copyright (c) 2015-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -17,7 +17,7 @@
  *
  * -----------------------------------------------------------------------------
  *
- * $Revision:   V2.0.0
+ * $Revision:   V2.1.0
  *
  * Project:     CMSIS-Driver Validation
  * Title:       Driver Validation main configuration file
@@ -38,6 +38,256 @@
 #ifndef PRINT_XML_REPORT
 #define PRINT_XML_REPORT                0
 #endif
+//   <o> Number of measurements per test (XML) <1-32>
+//   <i> Measurements of a test exceeding this number are not reported (their number is reported instead)
+#ifndef DV_MEAS_NUM
+#define DV_MEAS_NUM                     4
+#endif
+//   <e> Test Duration Report
+//   <i> Measure and report execution time of each test and of each test group setup and teardown
+#ifndef DV_TIME_REPORT
+#define DV_TIME_REPORT                  0
+#endif
+//     <o> Number of slowest tests listed <0-32>
+//     <i> Number of slowest tests listed at the end of the test report (0 = list disabled)
+#ifndef DV_TIME_SLOWEST_NUM
+#define DV_TIME_SLOWEST_NUM             5
+#endif
+//   </e>
+//   <e> Buffered Report Output
+//   <i> Format report into a RAM buffer and write it to the standard output only at selected points,
+//   <i> so that report output does not overlap with test execution
+#ifndef DV_REPORT_BUF_EN
+#define DV_REPORT_BUF_EN                0
+#endif
+//     <o> Buffer size [bytes] <256-65536>
+//     <i> Size of report buffer (report output exceeding the buffer is lost and counted)
+#ifndef DV_REPORT_BUF_SIZE
+#define DV_REPORT_BUF_SIZE              4096
+#endif
+//     <o> Write buffer to output <0=> At test group end <1=> Between tests
+//     <i> Select when buffered report is written to the standard output
+#ifndef DV_REPORT_BUF_DRAIN
+#define DV_REPORT_BUF_DRAIN             0
+#endif
+//   </e>
+//   <e> Runtime Test Selection
+//   <i> Select tests to be executed at runtime by matching test function names against patterns
+#ifndef DV_TEST_FILTER_EN
+#define DV_TEST_FILTER_EN               0
+#endif
+//     <s> Default test filter
+//     <i> Comma separated list of test function name patterns (wildcards '*' and '?' are supported),
+//     <i> patterns starting with '-' exclude matching tests (for example: "SPI_Data_Bits_*,-SPI_Data_Bits_1")
+//     <i> Empty filter selects all tests
+#ifndef DV_TEST_FILTER
+#define DV_TEST_FILTER                  ""
+#endif
+//     <o> Test filter buffer size [bytes] <16-1024>
+//     <i> Size of test filter variable dv_test_filter (can be modified by the debugger before tests are started)
+#ifndef DV_TEST_FILTER_SIZE
+#define DV_TEST_FILTER_SIZE             128
+#endif
+//     <q> Read test filter from standard input
+//     <i> Read test filter line from standard input when tests are started (empty line keeps current filter)
+#ifndef DV_TEST_FILTER_STDIN
+#define DV_TEST_FILTER_STDIN            0
+#endif
+//   </e>
+//   <e> Concurrent Test Groups
+//   <i> Execute selected test groups concurrently, each in its own thread
+//   <i> Report of each concurrent test group is buffered and written to the standard output when the group is done
+#ifndef DV_CONCURRENT_EN
+#define DV_CONCURRENT_EN                0
+#endif
+//     <s> Concurrent test groups
+//     <i> Comma separated list of test group report title patterns (wildcards '*' and '?' are supported),
+//     <i> patterns starting with '-' exclude matching groups (for example: "*SPI*,*CAN*")
+//     <i> Test groups not selected are executed sequentially after the concurrent test groups are done
+#ifndef DV_CONCURRENT_GROUPS
+#define DV_CONCURRENT_GROUPS            "*"
+#endif
+//     <o> Maximum number of concurrent test groups <1-8>
+//     <i> Each concurrent test group uses a report buffer of Buffered Report Output buffer size
+#ifndef DV_CONCURRENT_NUM
+#define DV_CONCURRENT_NUM               4
+#endif
+//     <o> Test group thread stack size [bytes] <1024-65536:8>
+//     <i> Stack size of the thread executing a concurrent test group
+#ifndef DV_CONCURRENT_STACK_SIZE
+#define DV_CONCURRENT_STACK_SIZE        4096
+#endif
+//   </e>
+//   <e> Test Watchdog
+//   <i> Execute test functions in a worker thread supervised by a time budget
+//   <i> Test exceeding its time budget is terminated and reported as failed, remaining tests in the test group are skipped
+#ifndef DV_WATCHDOG_EN
+#define DV_WATCHDOG_EN                  0
+#endif
+//     <o> Test time budget [ms] <1-3600000>
+//     <i> Maximum execution time of a test (also applies to test group setup and teardown)
+#ifndef DV_WATCHDOG_TEST_TIMEOUT
+#define DV_WATCHDOG_TEST_TIMEOUT        30000
+#endif
+//     <o> Test group time budget [ms] <0-3600000>
+//     <i> Maximum execution time of a test group setup and tests (0 = unlimited)
+#ifndef DV_WATCHDOG_GROUP_TIMEOUT
+#define DV_WATCHDOG_GROUP_TIMEOUT       0
+#endif
+//     <o> Worker thread stack size [bytes] <1024-65536:8>
+//     <i> Stack size of the thread executing the test functions
+#ifndef DV_WATCHDOG_STACK_SIZE
+#define DV_WATCHDOG_STACK_SIZE          4096
+#endif
+//   </e>
+//   <e> Test Repeat (Soak) Mode
+//   <i> Repeat selected tests and report statistics of the test iteration durations
+//   <i> (min, mean, 50th and 99th percentile, max) and the number of failed iterations
+#ifndef DV_REPEAT_EN
+#define DV_REPEAT_EN                    0
+#endif
+//     <s> Repeated tests
+//     <i> Comma separated list of test function name patterns (wildcards '*' and '?' are supported),
+//     <i> patterns starting with '-' exclude matching tests (for example: "SPI_Transfer_*")
+#ifndef DV_REPEAT_TESTS
+#define DV_REPEAT_TESTS                 "*"
+#endif
+//     <o> Number of iterations <0-1000000>
+//     <i> Maximum number of test iterations (0 = unlimited, test is repeated for the repeat time)
+#ifndef DV_REPEAT_COUNT
+#define DV_REPEAT_COUNT                 100
+#endif
+//     <o> Repeat time [ms] <0-3600000>
+//     <i> Maximum time a test is repeated (0 = unlimited, test is repeated for the number of iterations)
+//     <i> With both limits set to 0 the test is executed once
+#ifndef DV_REPEAT_TIME
+#define DV_REPEAT_TIME                  0
+#endif
+//   </e>
+//   <e> Assertion Recording
+//   <i> Record passed assertions (and failed assertions without message) into a RAM array instead of
+//   <i> calling the report functions, records are processed when the test result is reported
+//   <i> Not used with Concurrent Test Groups enabled
+#ifndef DV_ASSERT_REC_EN
+#define DV_ASSERT_REC_EN                0
+#endif
+//     <o> Number of assertion records <8-1024>
+//     <i> Records are processed (and the array emptied) when the array is full
+#ifndef DV_ASSERT_REC_NUM
+#define DV_ASSERT_REC_NUM               64
+#endif
+//   </e>
+//   <e> Memory Usage Report
+//   <i> Report peak heap use and stack high-water marks of the test thread and test worker threads for each test
+//   <i> Heap use is counted by malloc/free wrappers (with GCC link with -Wl,--wrap=malloc,--wrap=free)
+//   <i> Stack high-water marks require RTOS stack watermark (RTX: OS_STACK_WATERMARK = 1)
+#ifndef DV_MEM_REPORT
+#define DV_MEM_REPORT                   0
+#endif
+//   </e>
+//   <e> Fault Injection
+//   <i> Interpose the tested drivers and inject delays, dropped completion events, short data counts
+//   <i> and bit flips in received data by a pseudo-random schedule (reseeded at each test start)
+//   <i> Injected faults are reported for each test
+#ifndef DV_INJECT_EN
+#define DV_INJECT_EN                    0
+#endif
+//     <o> Seed <1-0xFFFFFFFF>
+//     <i> Seed of the schedule, the same seed reproduces the same faults in a test
+#ifndef DV_INJECT_SEED
+#define DV_INJECT_SEED                  1
+#endif
+//     <o> Delay rate [1/1000] <0-1000>
+//     <i> Probability of a delay before a transfer function call and before a signaled event
+#ifndef DV_INJECT_DELAY_RATE
+#define DV_INJECT_DELAY_RATE            10
+#endif
+//     <o> Maximum delay [us] <1-1000000>
+//     <i> Delays are busy waits (also in the driver event context) with a random length of 1 to maximum
+#ifndef DV_INJECT_DELAY_MAX
+#define DV_INJECT_DELAY_MAX             1000
+#endif
+//     <o> Dropped event rate [1/1000] <0-1000>
+//     <i> Probability that completion events (transfer complete, frame received/sent, message sent/received)
+//     <i> are not signaled
+#ifndef DV_INJECT_DROP_RATE
+#define DV_INJECT_DROP_RATE             0
+#endif
+//     <o> Short count rate [1/1000] <0-1000>
+//     <i> Probability that GetDataCount (SPI), GetTxCount/GetRxCount (USART) return a smaller count
+//     <i> and that WiFi SocketSend/SocketRecv transfer only a part of the data
+#ifndef DV_INJECT_SHORT_RATE
+#define DV_INJECT_SHORT_RATE            0
+#endif
+//     <o> Bit flip rate [1/1000] <0-1000>
+//     <i> Probability that a bit of received data (transfer, frame, message) is inverted
+#ifndef DV_INJECT_FLIP_RATE
+#define DV_INJECT_FLIP_RATE             0
+#endif
+//     <h> Drivers
+//       <q> SPI
+#ifndef DV_INJECT_SPI
+#define DV_INJECT_SPI                   1
+#endif
+//       <q> USART
+#ifndef DV_INJECT_USART
+#define DV_INJECT_USART                 1
+#endif
+//       <q> Ethernet (MAC)
+#ifndef DV_INJECT_ETH
+#define DV_INJECT_ETH                   1
+#endif
+//       <q> CAN
+#ifndef DV_INJECT_CAN
+#define DV_INJECT_CAN                   1
+#endif
+//       <q> WiFi
+#ifndef DV_INJECT_WIFI
+#define DV_INJECT_WIFI                  1
+#endif
+//     </h>
+//   </e>
+//   <e> Driver API Trace
+//   <i> Record driver function entry and exit (with timestamp, thread, argument and return value)
+//   <i> and signaled events into a ring buffer in RAM (DV_Trace), convert a dump of the ring buffer
+//   <i> with Tools/Trace/dv_trace2json.py into a Chrome trace (chrome://tracing, Perfetto)
+#ifndef DV_TRACE_EN
+#define DV_TRACE_EN                     0
+#endif
+//     <s> Traced tests
+//     <i> Comma separated list of test function name patterns (wildcards '*' and '?' are supported),
+//     <i> patterns starting with '-' exclude matching tests (for example: "SPI_Bus_Speed_Max")
+#ifndef DV_TRACE_TESTS
+#define DV_TRACE_TESTS                  "*"
+#endif
+//     <o> Number of trace records <64-1048576>
+//     <i> Power of 2, a record uses 16 bytes of RAM, the oldest records are overwritten
+#ifndef DV_TRACE_NUM
+#define DV_TRACE_NUM                    1024
+#endif
+//     <h> Drivers
+//       <q> SPI
+#ifndef DV_TRACE_SPI
+#define DV_TRACE_SPI                    1
+#endif
+//       <q> USART
+#ifndef DV_TRACE_USART
+#define DV_TRACE_USART                  1
+#endif
+//       <q> Ethernet (MAC)
+#ifndef DV_TRACE_ETH
+#define DV_TRACE_ETH                    1
+#endif
+//       <q> CAN
+#ifndef DV_TRACE_CAN
+#define DV_TRACE_CAN                    1
+#endif
+//       <q> WiFi
+#ifndef DV_TRACE_WIFI
+#define DV_TRACE_WIFI                   1
+#endif
+//     </h>
+//   </e>
 // </h>
 
 #endif /* DV_CONFIG_H_ */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2015-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -46,8 +46,28 @@ typedef struct {
   uint32_t tests;                       /* Total test cases count             */
   uint32_t passed;                      /* Total test cases passed            */
   uint32_t failed;                      /* Total test cases failed            */
+  uint32_t duration;                    /* Total test cases duration [us]     */
 } TEST_GROUP_RESULTS;
 
+/* Assertion record */
+typedef struct {
+  const char *file;                     /* Module file name string            */
+  uint16_t    line;                     /* Line number                        */
+  uint16_t    res;                      /* Assertion result (TC_RES)          */
+} AS_RECORD;
+
+/* Test memory usage */
+typedef struct {
+  uint32_t heap_peak;                   /* Peak heap use above test start     */
+  uint32_t heap_leak;                   /* Heap not freed at test end         */
+  uint32_t heap_fail;                   /* Number of failed allocations       */
+  uint32_t stack_used;                  /* Test thread stack high-water mark  */
+  uint32_t stack_size;                  /* Test thread stack size (0 = n/a)   */
+  uint32_t stack_cfg;                   /* Its configured size (0 = unknown)  */
+  uint32_t th_stack_used;               /* Highest worker thread stack use    */
+  uint32_t th_stack_size;               /* Its stack size (0 = no workers)    */
+} TEST_MEM_USAGE;
+
 /* Test report interface */
 typedef struct {
   void (* tr_Init)    (void);
@@ -55,10 +75,13 @@ typedef struct {
   void (* tg_Init)    (const char *title, const char *date, const char *time, const char *file);
   void (* tg_Info)    (const char *info);
   void (* tg_InfoDone)(void);
-  void (* tg_Uninit)  (void);
+  void (* tg_Uninit)  (uint32_t setup_us, uint32_t teardown_us);
   void (* tc_Init)    (uint32_t num, const char *fn);
   void (* tc_Detail)  (const char *module, uint32_t line, const char *message);
-  void (* tc_Uninit)  (void);
+  void (* tc_Uninit)  (uint32_t duration_us);
+  void (* tc_Measure) (const char *name, uint32_t value, const char *unit);
+  void (* tc_Iteration)(uint32_t duration_us);
+  void (* tc_Memory)  (const TEST_MEM_USAGE *mem);
   void (* as_Result)  (TC_RES res);
 } REPORT_ITF;
 
@@ -71,4 +94,36 @@ extern void __tg_info    (const char *info);
 extern void __set_result (const char *module, uint32_t line, const char *message, TC_RES res);
 extern void __set_message(const char *module, uint32_t line, const char *message);
 
+/* Assertion recording */
+#if (DV_ASSERT_REC != 0)
+extern AS_RECORD dv_as_rec[];
+extern uint32_t  dv_as_cnt;
+extern void __as_flush (void);
+#endif
+extern void __as_last  (void);
+
+/* Test measurements */
+extern void __set_measurement (const char *name, uint32_t value, const char *unit);
+
+/* Memory usage (stack use of threads created by tests) */
+extern void __mem_thread (void *thread);
+
+/* Fault injection (schedule reseed at test start, report at test end) */
+extern void __inject_start (const char *name);
+extern void __inject_done  (const char *name);
+
+/* Driver API trace (recording of traced tests, ring buffer for a dump) */
+extern void     __trace_start (const char *name);
+extern void     __trace_done  (void);
+extern uint32_t __trace_dump  (const void **data);
+
+/* Report contexts (concurrent test groups) */
+extern int32_t  __report_ctx_open   (void);
+extern void     __report_ctx_close  (void);
+extern uint32_t __report_ctx_get    (void);
+extern void     __report_ctx_worker (uint32_t id, void *thread);
+
+/* Report abort (write buffered report and close it when a test run is terminated) */
+extern void __report_abort (void);
+
 #endif /* __CMSIS_DV_REPORT_H__ */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015-2020 Arm Limited. All rights reserved.
+ * Copyright (c) 2015-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -32,6 +32,8 @@
 #include <string.h>
 #include <stdio.h>
 
+#include "DV_Config.h"
+
 typedef unsigned int    BOOL;
 
 #ifndef __TRUE
@@ -61,15 +63,52 @@ typedef unsigned int    BOOL;
 /* Test group info macro */
 #define TEST_GROUP_INFO(info)                   __tg_info (info)
 
+/* Assertion recording (not used with concurrent test groups) */
+#if (DV_ASSERT_REC_EN != 0) && (DV_CONCURRENT_EN == 0)
+#define DV_ASSERT_REC   1
+#else
+#define DV_ASSERT_REC   0
+#endif
+
+#if (DV_ASSERT_REC != 0)
+/* Append assertion record (records are processed when the array is full) */
+#define __AS_RECORD(result)                     do { if (dv_as_cnt == DV_ASSERT_REC_NUM) { __as_flush(); }        \
+                                                     dv_as_rec[dv_as_cnt].file = __FILE__;                         \
+                                                     dv_as_rec[dv_as_cnt].line = (uint16_t)__LINE__;               \
+                                                     dv_as_rec[dv_as_cnt].res  = (uint16_t)(result);               \
+                                                     dv_as_cnt++; } while (0)
+#endif
+
 /* Test macros */
+#if (DV_ASSERT_REC != 0)
+#define TEST_FAIL()                             __AS_RECORD(FAILED)
+#else
 #define TEST_FAIL()                             TEST_FAIL_MESSAGE(NULL)
+#endif
 #define TEST_FAIL_MESSAGE(message)              __set_result (__FILE__, __LINE__, message, FAILED)
+#if (DV_ASSERT_REC != 0)
+#define TEST_PASS()                             __AS_RECORD(PASSED)
+#else
 #define TEST_PASS()                             TEST_PASS_MESSAGE(NULL)
+#endif
 #define TEST_PASS_MESSAGE(message)              __set_result (__FILE__, __LINE__, message, PASSED)
 
 #define TEST_ASSERT(condition)                  TEST_ASSERT_MESSAGE(condition,"[FAILED]")
+#if (DV_ASSERT_REC != 0)
+#define TEST_ASSERT_MESSAGE(condition,message)  if (condition) { __AS_RECORD(PASSED); } else { __set_result (__FILE__, __LINE__, message, FAILED); }
+#else
 #define TEST_ASSERT_MESSAGE(condition,message)  if (condition) { __set_result (__FILE__, __LINE__, NULL, PASSED); } else { __set_result (__FILE__, __LINE__, message, FAILED); }
+#endif
 
 #define TEST_MESSAGE(message)                   __set_message(__FILE__, __LINE__, message)
 
+#define TEST_MEASUREMENT(name,value,unit)       __set_measurement(name, value, unit)
+
+/* Register stack use of a thread created by a test (call before the thread is terminated) */
+#if (DV_MEM_REPORT != 0)
+#define TEST_THREAD_STACK(thread)               __mem_thread(thread)
+#else
+#define TEST_THREAD_STACK(thread)
+#endif
+
 #endif /* __CMSIS_DV_TYPEDEFS_H__ */
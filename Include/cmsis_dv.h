@@ -35,7 +35,7 @@
 #include "cmsis_os2.h"
 
 #define GET_SYSTICK()   	osKernelGetTickCount()
-#define SYSTICK_MS(ms)  	(((uint32_t)ms * osKernelGetTickFreq()) / 1000U)
+#define SYSTICK_MS(ms)  	(((uint32_t)(ms) * osKernelGetTickFreq()) / 1000U)
 
 #define GET_SYSTIMER()      osKernelGetSysTimerCount()
 #define SYSTIMER_US(us)     (((uint64_t)us *  osKernelGetSysTimerFreq()) / 1000000)
@@ -79,7 +79,15 @@ const uint32_t CAN_BR_NUM = ARRAY_SIZE(CAN_BR);
 
 // Register Driver_CAN#
 extern ARM_DRIVER_CAN CREATE_SYMBOL(Driver_CAN, DRV_CAN);
+#if   (DV_TRACE_EN  != 0) && (DV_TRACE_CAN != 0)
+extern ARM_DRIVER_CAN DV_Trace_Driver_CAN;
+static ARM_DRIVER_CAN *drv = &DV_Trace_Driver_CAN;
+#elif (DV_INJECT_EN != 0) && (DV_INJECT_CAN != 0)
+extern ARM_DRIVER_CAN DV_Inject_Driver_CAN;
+static ARM_DRIVER_CAN *drv = &DV_Inject_Driver_CAN;
+#else
 static ARM_DRIVER_CAN *drv = &CREATE_SYMBOL(Driver_CAN, DRV_CAN);
+#endif
 static ARM_CAN_CAPABILITIES capab;
 static ARM_CAN_OBJ_CAPABILITIES obj_capab;
 
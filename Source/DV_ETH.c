@@ -58,6 +58,15 @@ static const ARM_ETH_MAC_ADDR mac_mcast[6] ={{0x01, 0x00, 0x5E, 0x00, 0x00, 0x01
 // Register Driver_ETH_MAC# Driver_ETH_PHY#
 extern ARM_DRIVER_ETH_MAC CREATE_SYMBOL(Driver_ETH_MAC, DRV_ETH);
 extern ARM_DRIVER_ETH_PHY CREATE_SYMBOL(Driver_ETH_PHY, DRV_ETH);
+#if   (DV_TRACE_EN  != 0) && (DV_TRACE_ETH != 0)
+extern ARM_DRIVER_ETH_MAC DV_Trace_Driver_ETH_MAC;
+static ARM_DRIVER_ETH_MAC * const eth_mac_drv = &DV_Trace_Driver_ETH_MAC;
+#elif (DV_INJECT_EN != 0) && (DV_INJECT_ETH != 0)
+extern ARM_DRIVER_ETH_MAC DV_Inject_Driver_ETH_MAC;
+static ARM_DRIVER_ETH_MAC * const eth_mac_drv = &DV_Inject_Driver_ETH_MAC;
+#else
+static ARM_DRIVER_ETH_MAC * const eth_mac_drv = &CREATE_SYMBOL(Driver_ETH_MAC, DRV_ETH);
+#endif
 
 static ARM_DRIVER_ETH_MAC       *eth_mac;
 static ARM_DRIVER_ETH_PHY       *eth_phy;
@@ -135,7 +144,7 @@ static int32_t ETH_CheckFilter (int32_t vlan) {
 
 // Initialize MAC driver wrapper for RMII interface
 static int32_t mac_initialize (ARM_ETH_MAC_SignalEvent_t cb_event) {
-  ARM_DRIVER_ETH_MAC *drv_mac = &CREATE_SYMBOL(Driver_ETH_MAC, DRV_ETH);
+  ARM_DRIVER_ETH_MAC *drv_mac = eth_mac_drv;
 
   phy_power = 1U;
   return drv_mac->Initialize(cb_event);
@@ -143,7 +152,7 @@ static int32_t mac_initialize (ARM_ETH_MAC_SignalEvent_t cb_event) {
 
 // Uninitialize MAC driver wrapper for RMII interface
 static int32_t mac_uninitialize (void) {
-  ARM_DRIVER_ETH_MAC *drv_mac = &CREATE_SYMBOL(Driver_ETH_MAC, DRV_ETH);
+  ARM_DRIVER_ETH_MAC *drv_mac = eth_mac_drv;
 
   phy_power = 0U;
   return drv_mac->Uninitialize();
@@ -151,7 +160,7 @@ static int32_t mac_uninitialize (void) {
 
 // MAC driver power control wrapper for RMII interface
 static int32_t mac_power_control (ARM_POWER_STATE state) {
-  ARM_DRIVER_ETH_MAC *drv_mac = &CREATE_SYMBOL(Driver_ETH_MAC, DRV_ETH);
+  ARM_DRIVER_ETH_MAC *drv_mac = eth_mac_drv;
   ARM_DRIVER_ETH_PHY *drv_phy = &CREATE_SYMBOL(Driver_ETH_PHY, DRV_ETH);
   int32_t retv;
 
@@ -191,7 +200,7 @@ void ETH_DV_Initialize (void) {
   static struct _ARM_DRIVER_ETH_MAC s_mac;
   static struct _ARM_DRIVER_ETH_PHY s_phy;
 
-  eth_mac = &CREATE_SYMBOL(Driver_ETH_MAC, DRV_ETH);
+  eth_mac = eth_mac_drv;
   eth_phy = &CREATE_SYMBOL(Driver_ETH_PHY, DRV_ETH);
   capab   = eth_mac->GetCapabilities();
   if (capab.media_interface == ARM_ETH_INTERFACE_RMII) {
@@ -212,7 +221,7 @@ void ETH_DV_Initialize (void) {
 
 /* Helper function that is called after tests stop executing */
 void ETH_DV_Uninitialize (void) {
-  eth_mac  = &CREATE_SYMBOL(Driver_ETH_MAC, DRV_ETH);
+  eth_mac  = eth_mac_drv;
   eth_phy  = &CREATE_SYMBOL(Driver_ETH_PHY, DRV_ETH);
   cb_event = NULL;
 }
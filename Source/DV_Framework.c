@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015-2020 Arm Limited. All rights reserved.
+ * Copyright (c) 2015-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -25,7 +25,117 @@
 
 
 #include "cmsis_dv.h" 
+#include "DV_Config.h"
 #include "DV_Framework.h"
+#if (DV_MEM_REPORT != 0)
+#include <stdlib.h>
+#endif
+
+/* Time stamp */
+typedef struct {
+  uint32_t tick;                        /* Kernel tick count                  */
+  uint32_t cnt;                         /* Kernel system timer count          */
+} TIME_STAMP;
+
+#if (DV_CONCURRENT_EN != 0)
+/* Concurrent test group slot */
+typedef struct {
+  TEST_GROUP  *tg;                      /* Test group executed in the slot    */
+  uint32_t     flag;                    /* Slot done event flag               */
+} GROUP_SLOT;
+
+static GROUP_SLOT        group_slot[DV_CONCURRENT_NUM];
+static osEventFlagsId_t  group_done;    /* Concurrent test group done flags   */
+
+static const osThreadAttr_t group_thread_attr = {
+  "DV_Group",                           /* Thread name                        */
+  0U,                                   /* Attribute bits                     */
+  NULL,                                 /* Thread control block               */
+  0U,                                   /* Thread control block size          */
+  NULL,                                 /* Thread stack                       */
+  DV_CONCURRENT_STACK_SIZE,             /* Thread stack size                  */
+  osPriorityNormal,                     /* Thread priority                    */
+  0U,                                   /* TrustZone module identifier        */
+  0U                                    /* Reserved                           */
+};
+#endif
+
+#if (DV_WATCHDOG_EN != 0)
+/* Supervised function run information */
+typedef struct {
+  void           (*func)(void);         /* Function executed by the worker    */
+  osEventFlagsId_t done;                /* Function done event flags          */
+#if (DV_CONCURRENT_EN != 0)
+  uint32_t         ctx;                 /* Report context of the test group   */
+#endif
+} WORKER_RUN;
+#endif
+
+#if (DV_MEM_REPORT != 0)
+/* Heap block header (malloc wrapper) */
+typedef union {
+  struct {
+    uint32_t   size;                    /* Requested block size               */
+    uint32_t   tag;                     /* Block size XOR HEAP_TAG            */
+#if (DV_CONCURRENT_EN != 0)
+    uint32_t   ctx;                     /* Report context of the allocation   */
+#endif
+  } blk;
+  long double  align;                   /* Keeps alignment of allocated block */
+} HEAP_HDR;
+
+#define HEAP_TAG        0x564D454DU     /* Heap block tag                     */
+
+/* Heap usage counters */
+typedef struct {
+  uint32_t     used;                    /* Heap in use [bytes]                */
+  uint32_t     peak;                    /* Peak heap in use [bytes]           */
+  uint32_t     fail;                    /* Number of failed allocations       */
+} HEAP_USAGE;
+
+/* Test memory usage measurement (one per report context) */
+typedef struct {
+  HEAP_USAGE   heap;                    /* Heap usage counters                */
+  TEST_MEM_USAGE usage;                 /* Memory usage of the current test   */
+  uint32_t     heap_base;               /* Heap in use at test start          */
+  uint32_t     fail_base;               /* Failed allocations at test start   */
+} MEM_STAT;
+
+#if (DV_CONCURRENT_EN != 0)
+#define MEM_STAT_NUM    (1U + DV_CONCURRENT_NUM)
+#else
+#define MEM_STAT_NUM    1U
+#endif
+
+static MEM_STAT   mem_stat[MEM_STAT_NUM];
+
+/* Wrapped heap functions (Arm Compiler: $Sub$$/$Super$$, GCC: linker option --wrap) */
+#if defined(__ARMCC_VERSION)
+#define HEAP_MALLOC       $Sub$$malloc
+#define HEAP_CALLOC       $Sub$$calloc
+#define HEAP_REALLOC      $Sub$$realloc
+#define HEAP_FREE         $Sub$$free
+#define HEAP_REAL_MALLOC  $Super$$malloc
+#define HEAP_REAL_REALLOC $Super$$realloc
+#define HEAP_REAL_FREE    $Super$$free
+#else
+#define HEAP_MALLOC       __wrap_malloc
+#define HEAP_CALLOC       __wrap_calloc
+#define HEAP_REALLOC      __wrap_realloc
+#define HEAP_FREE         __wrap_free
+#define HEAP_REAL_MALLOC  __real_malloc
+#define HEAP_REAL_REALLOC __real_realloc
+#define HEAP_REAL_FREE    __real_free
+#endif
+
+extern void *HEAP_MALLOC       (size_t size);
+extern void *HEAP_CALLOC       (size_t nmemb, size_t size);
+extern void *HEAP_REALLOC      (void *ptr, size_t size);
+extern void  HEAP_FREE         (void *ptr);
+extern void *HEAP_REAL_MALLOC  (size_t size);
+extern void *HEAP_REAL_REALLOC (void *ptr, size_t size);
+extern void  HEAP_REAL_FREE    (void *ptr);
+#endif
 
 /*=======0=========1=========2=========3=========4=========5=========6=========7=========8=========9=========0=========1====*/
 /**
@@ -39,6 +149,22 @@
 @{
 */
 
+/*=======0=========1=========2=========3=========4=========5=========6=========7=========8=========9=========0=========1====*/
+#if (DV_TEST_FILTER_EN != 0)
+/**
+\brief Test filter.
+\details
+Comma separated list of test function name patterns that selects the tests executed by \ref cmsis_dv.
+Wildcards \c '*' (any string) and \c '?' (any character) are supported and patterns starting with \c '-'
+exclude matching tests. Empty filter selects all tests.
+
+The filter is initialized from \c DV_TEST_FILTER define in DV_Config.h and can be modified by the debugger
+(or read from the standard input) before the tests are started, so any subset of tests can be executed
+without rebuilding the application.
+*/
+char dv_test_filter[DV_TEST_FILTER_SIZE] = DV_TEST_FILTER;
+#endif
+
 /*=======0=========1=========2=========3=========4=========5=========6=========7=========8=========9=========0=========1====*/
 /**
 \brief Close the debug session.
@@ -52,6 +178,941 @@ void __attribute__((noinline)) closeDebug(void){
   __NOP();
   // Test completed
 }
+
+/*
+  \fn            static void TimeStart (TIME_STAMP *ts)
+  \brief         Capture the start time of a measured interval.
+  \param[out]    ts     pointer to time stamp
+  \return        none
+*/
+static void TimeStart (TIME_STAMP *ts) {
+  ts->tick = GET_SYSTICK();
+  ts->cnt  = GET_SYSTIMER();
+}
+
+/*
+  \fn            static uint32_t TimeElapsed (const TIME_STAMP *ts)
+  \brief         Get time elapsed since the start of a measured interval.
+  \detail        The system timer provides the resolution, the kernel tick count
+                 is used instead for intervals that could overflow the 32-bit
+                 system timer count (intervals of more than 2^31 timer counts).
+  \param[in]     ts     pointer to time stamp captured by TimeStart
+  \return        elapsed time in microseconds (saturated to 0xFFFFFFFF)
+*/
+static uint32_t TimeElapsed (const TIME_STAMP *ts) {
+  uint32_t cnt, tick, cnt_freq, tick_freq;
+  uint64_t us;
+
+  cnt       = GET_SYSTIMER() - ts->cnt;
+  tick      = GET_SYSTICK()  - ts->tick;
+  cnt_freq  = osKernelGetSysTimerFreq();
+  tick_freq = osKernelGetTickFreq();
+
+  if (((uint64_t)tick * cnt_freq) < ((uint64_t)tick_freq << 31)) {
+    us = ((uint64_t)cnt  * 1000000U) / cnt_freq;
+  } else {
+    us = ((uint64_t)tick * 1000000U) / tick_freq;
+  }
+  if (us > 0xFFFFFFFFU) {
+    us = 0xFFFFFFFFU;
+  }
+
+  return ((uint32_t)us);
+}
+
+#if (DV_MEM_REPORT != 0)
+/*
+  \fn            static uint32_t MemCtx (void)
+  \brief         Get report context of the calling thread (heap use and memory usage measurement).
+  \return        report context index
+*/
+static uint32_t MemCtx (void) {
+#if (DV_CONCURRENT_EN != 0)
+  return (__report_ctx_get());
+#else
+  return (0U);
+#endif
+}
+
+/*
+  \fn            static MEM_STAT *MemStat (void)
+  \brief         Get memory usage measurement of the test executed by the calling thread.
+  \return        pointer to memory usage measurement
+*/
+static MEM_STAT *MemStat (void) {
+  return (&mem_stat[MemCtx()]);
+}
+
+/*
+  \fn            static uint32_t HeapValid (const HEAP_HDR *hdr)
+  \brief         Check if a block was allocated by the heap wrappers.
+  \param[in]     hdr    pointer to block header
+  \return        1 = block allocated by the wrappers, 0 = other block
+*/
+static uint32_t HeapValid (const HEAP_HDR *hdr) {
+  if ((hdr->blk.size ^ HEAP_TAG) != hdr->blk.tag) {
+    return (0U);
+  }
+#if (DV_CONCURRENT_EN != 0)
+  if (hdr->blk.ctx >= MEM_STAT_NUM) {
+    return (0U);
+  }
+#endif
+  return (1U);
+}
+
+/*
+  \fn            static void HeapAdd (HEAP_HDR *hdr, uint32_t size)
+  \brief         Set header of an allocated block and count the block to the heap use of the calling thread.
+  \param[out]    hdr    pointer to block header
+  \param[in]     size   block size in bytes
+  \return        none
+*/
+static void HeapAdd (HEAP_HDR *hdr, uint32_t size) {
+  HEAP_USAGE *heap;
+  uint32_t    ctx;
+  int32_t     lock;
+
+  ctx  = MemCtx();
+  heap = &mem_stat[ctx].heap;
+
+  hdr->blk.size = size;
+  hdr->blk.tag  = size ^ HEAP_TAG;
+#if (DV_CONCURRENT_EN != 0)
+  hdr->blk.ctx  = ctx;
+#endif
+
+  lock = osKernelLock();
+  heap->used += size;
+  if (heap->used > heap->peak) {
+    heap->peak = heap->used;
+  }
+  if (lock >= 0) {
+    (void)osKernelRestoreLock(lock);
+  }
+}
+
+/*
+  \fn            static void HeapRemove (HEAP_HDR *hdr)
+  \brief         Remove a block from the heap use it was counted to.
+  \param[in,out] hdr    pointer to block header
+  \return        none
+*/
+static void HeapRemove (HEAP_HDR *hdr) {
+  HEAP_USAGE *heap;
+  int32_t     lock;
+
+#if (DV_CONCURRENT_EN != 0)
+  heap = &mem_stat[hdr->blk.ctx].heap;
+#else
+  heap = &mem_stat[0].heap;
+#endif
+  hdr->blk.tag = 0U;
+
+  lock = osKernelLock();
+  if (heap->used >= hdr->blk.size) {
+    heap->used -= hdr->blk.size;
+  } else {
+    heap->used = 0U;
+  }
+  if (lock >= 0) {
+    (void)osKernelRestoreLock(lock);
+  }
+}
+
+/*
+  \fn            static void HeapFail (void)
+  \brief         Count a failed allocation to the heap use of the calling thread.
+  \return        none
+*/
+static void HeapFail (void) {
+  HEAP_USAGE *heap = &MemStat()->heap;
+  int32_t     lock;
+
+  lock = osKernelLock();
+  heap->fail++;
+  if (lock >= 0) {
+    (void)osKernelRestoreLock(lock);
+  }
+}
+
+/*
+  \fn            void *HEAP_MALLOC (size_t size)
+  \brief         Allocate memory block and count heap usage (malloc wrapper).
+  \detail        Block size is stored in a header in front of the returned block,
+                 so the block size is known when the block is freed.
+  \param[in]     size   block size in bytes
+  \return        pointer to allocated block (NULL = allocation failed)
+*/
+void *HEAP_MALLOC (size_t size) {
+  HEAP_HDR *hdr;
+
+  hdr = NULL;
+  if (size <= (0xFFFFFFFFU - sizeof(HEAP_HDR))) {
+    hdr = (HEAP_HDR *)HEAP_REAL_MALLOC(size + sizeof(HEAP_HDR));
+  }
+  if (hdr == NULL) {
+    HeapFail();
+    return (NULL);
+  }
+  HeapAdd(hdr, (uint32_t)size);
+
+  return (&hdr[1]);
+}
+
+/*
+  \fn            void *HEAP_CALLOC (size_t nmemb, size_t size)
+  \brief         Allocate zero initialized array and count heap usage (calloc wrapper).
+  \param[in]     nmemb  number of array elements
+  \param[in]     size   element size in bytes
+  \return        pointer to allocated array (NULL = allocation failed)
+*/
+void *HEAP_CALLOC (size_t nmemb, size_t size) {
+  void *ptr;
+
+  if ((size != 0U) && (nmemb > (0xFFFFFFFFU / size))) {
+    HeapFail();
+    return (NULL);
+  }
+  ptr = HEAP_MALLOC(nmemb * size);
+  if (ptr != NULL) {
+    (void)memset(ptr, 0, nmemb * size);
+  }
+
+  return (ptr);
+}
+
+/*
+  \fn            void *HEAP_REALLOC (void *ptr, size_t size)
+  \brief         Change size of memory block and count heap usage (realloc wrapper).
+  \detail        Blocks not allocated by the wrappers (no valid header tag) are reallocated uncounted.
+  \param[in]     ptr    pointer to memory block (NULL = allocate new block)
+  \param[in]     size   new block size in bytes
+  \return        pointer to reallocated block (NULL = allocation failed, block is unchanged)
+*/
+void *HEAP_REALLOC (void *ptr, size_t size) {
+  HEAP_HDR *hdr, *blk;
+  uint32_t  old_size;
+
+  if (ptr == NULL) {
+    return (HEAP_MALLOC(size));
+  }
+  hdr = &((HEAP_HDR *)ptr)[-1];
+  if (HeapValid(hdr) == 0U) {
+    return (HEAP_REAL_REALLOC(ptr, size));  /* Block not allocated by the wrapper */
+  }
+  if (size == 0U) {
+    HEAP_FREE(ptr);
+    return (NULL);
+  }
+
+  blk = NULL;
+  old_size = hdr->blk.size;
+  HeapRemove(hdr);
+  if (size <= (0xFFFFFFFFU - sizeof(HEAP_HDR))) {
+    blk = (HEAP_HDR *)HEAP_REAL_REALLOC(hdr, size + sizeof(HEAP_HDR));
+  }
+  if (blk == NULL) {
+    HeapAdd(hdr, old_size);             /* Block is unchanged                 */
+    HeapFail();
+    return (NULL);
+  }
+  HeapAdd(blk, (uint32_t)size);
+
+  return (&blk[1]);
+}
+
+/*
+  \fn            void HEAP_FREE (void *ptr)
+  \brief         Free memory block and count heap usage (free wrapper).
+  \detail        Blocks not allocated by the wrappers (no valid header tag) are freed uncounted.
+  \param[in]     ptr    pointer to memory block
+  \return        none
+*/
+void HEAP_FREE (void *ptr) {
+  HEAP_HDR *hdr;
+
+  if (ptr == NULL) {
+    return;
+  }
+  hdr = &((HEAP_HDR *)ptr)[-1];
+  if (HeapValid(hdr) == 0U) {
+    HEAP_REAL_FREE(ptr);                /* Block not allocated by the wrapper */
+    return;
+  }
+  HeapRemove(hdr);
+
+  HEAP_REAL_FREE(hdr);
+}
+
+#if (DV_WATCHDOG_EN != 0)
+/*
+  \fn            static uint32_t MemHeapUsed (void)
+  \brief         Get heap in use by the calling thread's report context.
+  \return        heap in use in bytes
+*/
+static uint32_t MemHeapUsed (void) {
+  return (MemStat()->heap.used);
+}
+
+/*
+  \fn            static void MemExclude (uint32_t size, uint32_t alloc)
+  \brief         Exclude heap used by the framework (test watchdog) from the heap use of the test.
+  \param[in]     size   heap used by the framework in bytes
+  \param[in]     alloc  1 = heap was allocated (uncount it),
+                        0 = heap will be freed (count it again before it is freed)
+  \return        none
+*/
+static void MemExclude (uint32_t size, uint32_t alloc) {
+  HEAP_USAGE *heap = &MemStat()->heap;
+  int32_t     lock;
+
+  lock = osKernelLock();
+  if (alloc != 0U) {
+    heap->used -= (heap->used >= size) ? size : heap->used;
+    heap->peak -= (heap->peak >= size) ? size : heap->peak;
+  } else {
+    heap->used += size;
+  }
+  if (lock >= 0) {
+    (void)osKernelRestoreLock(lock);
+  }
+}
+#endif
+
+/*
+  \fn            static void StackUsed (osThreadId_t thread, uint32_t *used, uint32_t *size)
+  \brief         Update highest stack use with the stack high-water mark of a thread.
+  \param[in]     thread  thread ID
+  \param[in,out] used    highest stack use in bytes
+  \param[in,out] size    stack size of the thread with the highest stack use in bytes
+  \return        none
+*/
+static void StackUsed (osThreadId_t thread, uint32_t *used, uint32_t *size) {
+  uint32_t stack_size, space;
+
+  stack_size = osThreadGetStackSize (thread);
+  space      = osThreadGetStackSpace(thread);
+
+  /* Stack space 0 is returned if stack watermark is not available */
+  if ((stack_size != 0U) && (space != 0U) && (space <= stack_size)) {
+    if ((stack_size - space) >= *used) {
+      *used = stack_size - space;
+      *size = stack_size;
+    }
+  }
+}
+
+/*
+  \fn            static void MemStack (osThreadId_t thread, uint32_t stack_cfg)
+  \brief         Register stack use of the thread executing the test.
+  \param[in]     thread     thread ID
+  \param[in]     stack_cfg  configured stack size of the thread in bytes (0 = unknown)
+  \return        none
+*/
+static void MemStack (osThreadId_t thread, uint32_t stack_cfg) {
+  MEM_STAT *mem = MemStat();
+
+  StackUsed(thread, &mem->usage.stack_used, &mem->usage.stack_size);
+  mem->usage.stack_cfg = stack_cfg;
+}
+
+/*
+  \fn            static void MemStart (void)
+  \brief         Start memory usage measurement of a test.
+  \return        none
+*/
+static void MemStart (void) {
+  MEM_STAT *mem = MemStat();
+  int32_t   lock;
+
+  (void)memset(&mem->usage, 0, sizeof(mem->usage));
+
+  lock = osKernelLock();
+  mem->heap.peak = mem->heap.used;
+  mem->heap_base = mem->heap.used;
+  mem->fail_base = mem->heap.fail;
+  if (lock >= 0) {
+    (void)osKernelRestoreLock(lock);
+  }
+}
+
+/*
+  \fn            static void MemDone (void)
+  \brief         Complete memory usage measurement of a test and register it to the test report.
+  \return        none
+*/
+static void MemDone (void) {
+  MEM_STAT *mem = MemStat();
+  int32_t   lock;
+
+  lock = osKernelLock();
+  if (mem->heap.peak > mem->heap_base) {
+    mem->usage.heap_peak = mem->heap.peak - mem->heap_base;
+  }
+  if (mem->heap.used > mem->heap_base) {
+    mem->usage.heap_leak = mem->heap.used - mem->heap_base;
+  }
+  mem->usage.heap_fail = mem->heap.fail - mem->fail_base;
+  if (lock >= 0) {
+    (void)osKernelRestoreLock(lock);
+  }
+
+  ritf.tc_Memory(&mem->usage);
+}
+
+/*
+  \fn            void __mem_thread (void *thread)
+  \brief         Register stack use of a thread created by a test (see TEST_THREAD_STACK).
+  \param[in]     thread  thread ID
+  \return        none
+*/
+void __mem_thread (void *thread) {
+  MEM_STAT *mem = MemStat();
+
+  StackUsed((osThreadId_t)thread, &mem->usage.th_stack_used, &mem->usage.th_stack_size);
+}
+#endif
+
+#if (DV_TEST_FILTER_EN != 0) || (DV_CONCURRENT_EN != 0) || (DV_REPEAT_EN != 0) || (DV_TRACE_EN != 0)
+/*
+  \fn            static uint32_t NameMatch (const char *pat, uint32_t len, const char *name)
+  \brief         Check if name matches a pattern ('*' matches any string, '?' matches any character).
+  \param[in]     pat    pattern (not null terminated)
+  \param[in]     len    pattern length
+  \param[in]     name   name string
+  \return        1 = name matches the pattern, 0 = name does not match the pattern
+*/
+static uint32_t NameMatch (const char *pat, uint32_t len, const char *name) {
+  const char *star_name;
+  uint32_t    star_idx, i;
+
+  star_name = NULL;
+  star_idx  = 0U;
+  i         = 0U;
+
+  while (*name != '\0') {
+    if ((i < len) && ((pat[i] == '?') || (pat[i] == *name))) {
+      i++;
+      name++;
+    } else if ((i < len) && (pat[i] == '*')) {
+      i++;
+      star_idx  = i;                    /* Remember position after wildcard   */
+      star_name = name;
+    } else if (star_name != NULL) {
+      star_name++;                      /* Wildcard consumes one more char    */
+      i    = star_idx;
+      name = star_name;
+    } else {
+      return 0U;
+    }
+  }
+  while ((i < len) && (pat[i] == '*')) {
+    i++;
+  }
+
+  return ((i == len) ? 1U : 0U);
+}
+
+/*
+  \fn            static uint32_t ListMatch (const char *list, const char *name)
+  \brief         Check if name is selected by a list of patterns.
+  \param[in]     list   comma separated list of patterns (patterns starting with '-' exclude)
+  \param[in]     name   name string
+  \return        1 = name is selected, 0 = name is not selected
+*/
+static uint32_t ListMatch (const char *list, const char *name) {
+  const char *pat;
+  uint32_t    len, exclude, incl_cnt, incl_match;
+
+  pat        = list;
+  incl_cnt   = 0U;
+  incl_match = 0U;
+
+  for (;;) {
+    while ((*pat == ',') || (*pat == ' ')) {
+      pat++;
+    }
+    if (*pat == '\0') {
+      break;
+    }
+    exclude = 0U;
+    if (*pat == '-') {
+      exclude = 1U;
+      pat++;
+    }
+    len = 0U;
+    while ((pat[len] != '\0') && (pat[len] != ',') && (pat[len] != ' ')) {
+      len++;
+    }
+    if (exclude != 0U) {
+      if (NameMatch(pat, len, name) != 0U) {
+        return 0U;                      /* Excluded by pattern                */
+      }
+    } else {
+      incl_cnt++;
+      if (NameMatch(pat, len, name) != 0U) {
+        incl_match = 1U;
+      }
+    }
+    pat = &pat[len];
+  }
+
+  return (((incl_cnt == 0U) || (incl_match != 0U)) ? 1U : 0U);
+}
+#endif
+
+#if (DV_TEST_FILTER_EN != 0)
+/*
+  \fn            static uint32_t TestSelected (const char *name)
+  \brief         Check if test is selected by the test filter.
+  \param[in]     name   test function name string
+  \return        1 = test is selected, 0 = test is not selected
+*/
+static uint32_t TestSelected (const char *name) {
+  return (ListMatch(dv_test_filter, name));
+}
+
+/*
+  \fn            static uint32_t GroupSelected (TEST_GROUP *tg)
+  \brief         Check if any test in a test group is selected by the test filter.
+  \param[in]     tg     pointer to test group
+  \return        1 = at least one test is selected, 0 = no test is selected
+*/
+static uint32_t GroupSelected (TEST_GROUP *tg) {
+  uint32_t tc;
+
+  for (tc = 0U; tc < tg->NumOfTC; tc++) {
+    if (TestSelected(tg->TC[tc].TFName) != 0U) {
+      return 1U;
+    }
+  }
+
+  return 0U;
+}
+
+#if (DV_TEST_FILTER_STDIN != 0)
+/*
+  \fn            static void FilterRead (void)
+  \brief         Read test filter line from the standard input (empty line keeps current filter).
+  \return        none
+*/
+static void FilterRead (void) {
+  char     line[DV_TEST_FILTER_SIZE];
+  uint32_t len;
+
+#if (PRINT_XML_REPORT == 0)
+  (void)printf("Test filter [%s]: ", dv_test_filter);
+  (void)fflush(stdout);
+#endif
+  if (fgets(line, (int)sizeof(line), stdin) != NULL) {
+    len = (uint32_t)strcspn(line, "\r\n");
+    line[len] = '\0';
+    if (len != 0U) {
+      (void)memcpy(dv_test_filter, line, len + 1U);
+    }
+  }
+}
+#endif
+#endif
+
+#if (DV_WATCHDOG_EN != 0)
+/*
+  \fn            static void WorkerThread (void *argument)
+  \brief         Worker thread executing a supervised function.
+  \param[in]     argument   pointer to worker run information
+  \return        none
+*/
+static void WorkerThread (void *argument) {
+  WORKER_RUN *run = (WORKER_RUN *)argument;
+
+#if (DV_CONCURRENT_EN != 0)
+  __report_ctx_worker(run->ctx, osThreadGetId());
+#endif
+#if (DV_MEM_REPORT != 0)
+  /* Wait until heap used by the watchdog objects is excluded from the test */
+  (void)osEventFlagsWait(run->done, 2U, osFlagsWaitAny, osWaitForever);
+#endif
+  run->func();
+  (void)osEventFlagsSet(run->done, 1U);
+  osThreadExit();
+}
+#endif
+
+/*
+  \fn            static uint32_t TimeBudget (const TIME_STAMP *tg_start)
+  \brief         Get time budget of the next test (limited by the remaining test group time budget).
+  \param[in]     tg_start   pointer to time stamp of test group start
+  \return        time budget in milliseconds (0 = test group time budget exhausted)
+*/
+static uint32_t TimeBudget (const TIME_STAMP *tg_start) {
+  uint32_t budget;
+#if (DV_WATCHDOG_EN != 0) && (DV_WATCHDOG_GROUP_TIMEOUT != 0)
+  uint32_t elapsed;
+#endif
+
+  budget = DV_WATCHDOG_TEST_TIMEOUT;
+#if (DV_WATCHDOG_EN != 0) && (DV_WATCHDOG_GROUP_TIMEOUT != 0)
+  elapsed = TimeElapsed(tg_start) / 1000U;
+  if (elapsed >= DV_WATCHDOG_GROUP_TIMEOUT) {
+    budget = 0U;
+  } else if ((DV_WATCHDOG_GROUP_TIMEOUT - elapsed) < budget) {
+    budget = DV_WATCHDOG_GROUP_TIMEOUT - elapsed;
+  } else {
+    // Test budget is within group budget
+  }
+#else
+  (void)tg_start;
+#endif
+
+  return (budget);
+}
+
+/*
+  \fn            static uint32_t FuncExec (void (*func)(void), uint32_t budget, uint32_t *duration_us)
+  \brief         Execute a test function (or test group setup/teardown) and measure its execution time.
+  \detail        With test watchdog enabled the function is executed in a worker thread which is
+                 terminated when the time budget expires.
+  \param[in]     func         pointer to function
+  \param[in]     budget       time budget in milliseconds (ignored if test watchdog is disabled)
+  \param[out]    duration_us  function execution time in microseconds
+  \return        0 = function completed, 1 = function terminated (time budget expired)
+*/
+static uint32_t FuncExec (void (*func)(void), uint32_t budget, uint32_t *duration_us) {
+  TIME_STAMP     ts_start;
+  uint32_t       rval;
+#if (DV_WATCHDOG_EN != 0)
+  WORKER_RUN     run;
+  osThreadAttr_t attr;
+  osThreadId_t   worker;
+  uint32_t       ticks;
+#if (DV_MEM_REPORT != 0)
+  uint32_t       heap, used;
+#endif
+#endif
+
+  rval = 0U;
+
+  TimeStart(&ts_start);
+#if (DV_WATCHDOG_EN != 0)
+#if (DV_MEM_REPORT != 0)
+  heap = MemHeapUsed();
+#endif
+  run.func = func;
+  run.done = osEventFlagsNew(NULL);
+#if (DV_CONCURRENT_EN != 0)
+  run.ctx  = __report_ctx_get();
+#endif
+
+  (void)memset(&attr, 0, sizeof(attr));
+  attr.name       = "DV_Test";
+  attr.attr_bits  = osThreadJoinable;
+  attr.stack_size = DV_WATCHDOG_STACK_SIZE;
+  attr.priority   = osThreadGetPriority(osThreadGetId());
+
+  worker = NULL;
+  if (run.done != NULL) {
+    worker = osThreadNew(WorkerThread, &run, &attr);
+  }
+#if (DV_MEM_REPORT != 0)
+  used = MemHeapUsed();
+  heap = (used > heap) ? (used - heap) : 0U;  /* Heap used by watchdog objects */
+  MemExclude(heap, 1U);
+  if (worker != NULL) {
+    (void)osEventFlagsSet(run.done, 2U);    /* Start the test                 */
+  }
+#endif
+  if (worker != NULL) {
+    ticks = SYSTICK_MS(budget);
+    if (ticks == 0U) {
+      ticks = 1U;
+    }
+    if (osEventFlagsWait(run.done, 1U, osFlagsWaitAny, ticks) == osFlagsErrorTimeout) {
+      rval = 1U;
+    }
+#if (DV_MEM_REPORT != 0)
+    MemStack(worker, DV_WATCHDOG_STACK_SIZE);   /* Test thread stack high-water mark */
+    MemExclude(heap, 0U);               /* Watchdog objects are freed         */
+#endif
+    if (rval != 0U) {
+      (void)osThreadTerminate(worker);  /* Time budget expired => terminate  */
+    }
+    (void)osThreadJoin(worker);
+#if (DV_CONCURRENT_EN != 0)
+    __report_ctx_worker(run.ctx, NULL);
+#endif
+  } else {
+#if (DV_MEM_REPORT != 0)
+    MemExclude(heap, 0U);
+#endif
+    func();                             /* Worker not created => unsupervised */
+#if (DV_MEM_REPORT != 0)
+    MemStack(osThreadGetId(), 0U);
+#endif
+  }
+  if (run.done != NULL) {
+    (void)osEventFlagsDelete(run.done);
+  }
+#else
+  (void)budget;
+  func();
+#if (DV_MEM_REPORT != 0)
+  MemStack(osThreadGetId(), 0U);
+#endif
+#endif
+  *duration_us = TimeElapsed(&ts_start);
+
+  return (rval);
+}
+
+#if (DV_REPEAT_EN != 0)
+/*
+  \fn            static uint32_t RepeatMore (uint32_t cnt, const TIME_STAMP *ts_start)
+  \brief         Check if test shall be repeated (repeat mode).
+  \param[in]     cnt        number of test iterations executed
+  \param[in]     ts_start   pointer to time stamp of the first test iteration start
+  \return        1 = repeat test, 0 = test is done
+*/
+static uint32_t RepeatMore (uint32_t cnt, const TIME_STAMP *ts_start) {
+#if (DV_REPEAT_COUNT == 0) && (DV_REPEAT_TIME == 0)
+  (void)cnt;
+  (void)ts_start;
+  return (0U);                          /* No limit set => execute once       */
+#else
+#if (DV_REPEAT_COUNT != 0)
+  if (cnt >= DV_REPEAT_COUNT) {
+    return (0U);
+  }
+#else
+  (void)cnt;
+#endif
+#if (DV_REPEAT_TIME != 0)
+  if ((TimeElapsed(ts_start) / 1000U) >= DV_REPEAT_TIME) {
+    return (0U);
+  }
+#else
+  (void)ts_start;
+#endif
+  return (1U);
+#endif
+}
+#endif
+
+/*
+  \fn            static uint32_t TestExec (TEST_CASE *tc, const TIME_STAMP *tg_start, uint32_t budget, uint32_t *duration_us)
+  \brief         Execute a test function (repeatedly if the test is selected for repeat mode).
+  \detail        Duration of each iteration of a repeated test is registered to the test report
+                 which collects the iteration statistics.
+  \param[in]     tc           pointer to test case
+  \param[in]     tg_start     pointer to time stamp of test group start
+  \param[in]     budget       time budget of the (first) test iteration in milliseconds
+  \param[out]    duration_us  test execution time (of all iterations) in microseconds
+  \return        0 = test completed, 1 = test terminated (time budget expired)
+*/
+static uint32_t TestExec (TEST_CASE *tc, const TIME_STAMP *tg_start, uint32_t budget, uint32_t *duration_us) {
+#if (DV_REPEAT_EN != 0)
+  TIME_STAMP ts_start;
+  uint32_t   rval, cnt, iter_us;
+
+  if (ListMatch(DV_REPEAT_TESTS, tc->TFName) == 0U) {
+    return (FuncExec(tc->TestFunc, budget, duration_us));
+  }
+
+  *duration_us = 0U;
+  cnt = 0U;
+
+  TimeStart(&ts_start);
+  do {
+    rval = FuncExec(tc->TestFunc, budget, &iter_us);
+    ritf.tc_Iteration(iter_us);         /* Register test iteration            */
+    if (*duration_us > (0xFFFFFFFFU - iter_us)) {
+      *duration_us = 0xFFFFFFFFU;
+    } else {
+      *duration_us += iter_us;
+    }
+    cnt++;
+    budget = TimeBudget(tg_start);      /* Group budget limits repetitions    */
+  } while ((rval == 0U) && (budget != 0U) && (RepeatMore(cnt, &ts_start) != 0U));
+
+  return (rval);
+#else
+  (void)tg_start;
+  return (FuncExec(tc->TestFunc, budget, duration_us));
+#endif
+}
+
+/*
+  \fn            static void GroupRun (TEST_GROUP *tg)
+  \brief         Execute test group and write its report.
+  \param[in]     tg     pointer to test group
+  \return        none
+*/
+static void GroupRun (TEST_GROUP *tg) {
+  const char *fn;
+  uint32_t    tc, no, budget, abort;
+  uint32_t    setup_us, teardown_us, duration_us;
+  TIME_STAMP  tg_start;
+
+  TimeStart(&tg_start);
+  abort = 0U;
+
+                                        /* Init test group report             */
+  ritf.tg_Init(tg->ReportTitle,         /* Write test group title             */
+               tg->Date,                /* Write test group compilation date  */
+               tg->Time,                /* Write test group compilation time  */
+               tg->FileName);           /* Write test group module file name  */
+
+  setup_us = 0U;
+  if (tg->Init != NULL) {
+    budget = TimeBudget(&tg_start);
+                                        /* Init test group (group setup)      */
+    if (FuncExec(tg->Init, budget, &setup_us) != 0U) {
+      TEST_GROUP_INFO("[FAILED] Test group setup timeout, tests skipped");
+      abort = 1U;
+    }
+  }
+
+  ritf.tg_InfoDone();                   /* Test group info done               */
+
+  /* Execute all tests in a group */
+  for (tc = 0U; tc < tg->NumOfTC; tc++) {
+    no = tc + 1U;                       /* Test number                        */
+    fn = tg->TC[tc].TFName;             /* Test function name string          */
+#if (DV_TEST_FILTER_EN != 0)
+    if (TestSelected(fn) == 0U) {
+      continue;                         /* Skip test not selected by filter   */
+    }
+#endif
+    ritf.tc_Init (no, fn);              /* Init test report #(Base + TC)      */
+    duration_us = 0U;
+    if ((tg->TC[tc].TestFunc != NULL) && (abort == 0U)) {
+#if (DV_MEM_REPORT != 0)
+      MemStart();                       /* Start memory usage measurement     */
+#endif
+#if (DV_INJECT_EN != 0)
+      __inject_start(fn);               /* Reseed fault injection schedule    */
+#endif
+#if (DV_TRACE_EN != 0)
+      if (ListMatch(DV_TRACE_TESTS, fn) != 0U) {
+        __trace_start(fn);              /* Start driver API trace recording   */
+      }
+#endif
+      budget = TimeBudget(&tg_start);
+      if (budget == 0U) {
+        TEST_FAIL_MESSAGE("[FAILED] Test group time budget exhausted, tests skipped");
+        abort = 1U;
+      } else if (TestExec(&tg->TC[tc], &tg_start, budget, &duration_us) != 0U) {
+                                        /* Test func executed if enabled      */
+        TEST_FAIL_MESSAGE("[FAILED] Test timeout, test terminated and remaining tests skipped");
+        __as_last();                    /* Show where the test got stuck      */
+        abort = 1U;
+      }
+#if (DV_TRACE_EN != 0)
+      __trace_done();                   /* Stop driver API trace recording    */
+#endif
+#if (DV_INJECT_EN != 0)
+      __inject_done(fn);                /* Report injected faults             */
+#endif
+#if (DV_MEM_REPORT != 0)
+      MemDone();                        /* Register test memory usage         */
+#endif
+    }
+    ritf.tc_Uninit (duration_us);       /* Uninit test report                 */
+  }
+
+  teardown_us = 0U;
+  if (tg->Uninit != NULL) {
+                                        /* Uninit test group (group teardown) */
+    (void)FuncExec(tg->Uninit, DV_WATCHDOG_TEST_TIMEOUT, &teardown_us);
+  }
+
+                                        /* Uninit test group report           */
+  ritf.tg_Uninit (setup_us, teardown_us);
+}
+
+#if (DV_CONCURRENT_EN != 0)
+/*
+  \fn            static uint32_t GroupConcurrent (TEST_GROUP *tg)
+  \brief         Check if test group is selected for concurrent execution.
+  \param[in]     tg     pointer to test group
+  \return        1 = test group is executed concurrently, 0 = test group is executed sequentially
+*/
+static uint32_t GroupConcurrent (TEST_GROUP *tg) {
+  return (ListMatch(DV_CONCURRENT_GROUPS, tg->ReportTitle));
+}
+
+/*
+  \fn            static void GroupThread (void *argument)
+  \brief         Thread executing a concurrent test group.
+  \param[in]     argument   pointer to test group slot
+  \return        none
+*/
+static void GroupThread (void *argument) {
+  GROUP_SLOT *slot = (GROUP_SLOT *)argument;
+
+  (void)__report_ctx_open();            /* Report of the group is buffered    */
+  GroupRun(slot->tg);
+  __report_ctx_close();
+
+  (void)osEventFlagsSet(group_done, slot->flag);
+  (void)osThreadExit();
+}
+
+/*
+  \fn            static void GroupsConcurrentRun (void)
+  \brief         Execute test groups selected for concurrent execution, each in its own thread.
+  \details       Up to DV_CONCURRENT_NUM test groups are executed at the same time, the function
+                 returns when all concurrent test groups are done.
+  \return        none
+*/
+static void GroupsConcurrentRun (void) {
+  uint32_t i, n, busy, flags;
+
+  if (group_done == NULL) {
+    group_done = osEventFlagsNew(NULL);
+  }
+  busy = 0U;
+
+  for (i = 0U; i < tg_cnt; i++) {
+#if (DV_TEST_FILTER_EN != 0)
+    if (GroupSelected(&ts[i]) == 0U) {
+      continue;                         /* Skip group if no test is selected  */
+    }
+#endif
+    if (GroupConcurrent(&ts[i]) == 0U) {
+      continue;                         /* Group is executed sequentially     */
+    }
+
+    if (busy == ((1UL << DV_CONCURRENT_NUM) - 1U)) {
+                                        /* Wait for a free slot               */
+      flags = osEventFlagsWait(group_done, busy, osFlagsWaitAny, osWaitForever);
+      if ((flags & osFlagsError) == 0U) {
+        busy &= ~flags;
+      }
+    }
+    n = 0U;
+    while ((busy & (1UL << n)) != 0U) {
+      n++;                              /* Find free slot                     */
+    }
+
+    group_slot[n].tg   = &ts[i];
+    group_slot[n].flag = 1UL << n;
+    if ((group_done != NULL) &&
+        (osThreadNew(GroupThread, &group_slot[n], &group_thread_attr) != NULL)) {
+      busy |= group_slot[n].flag;
+    } else {
+      GroupRun(&ts[i]);                 /* Thread not created => run here     */
+    }
+  }
+
+  while (busy != 0U) {                  /* Wait for all groups to finish      */
+    flags = osEventFlagsWait(group_done, busy, osFlagsWaitAny, osWaitForever);
+    if ((flags & osFlagsError) == 0U) {
+      busy &= ~flags;
+    }
+  }
+}
+#endif
 #endif
 
 
@@ -60,60 +1121,60 @@ void __attribute__((noinline)) closeDebug(void){
 \brief This is the entry point of the test framework.
 \details
 Program flow:
+  -# Test filter is read from the standard input (if enabled in DV_Config.h)
   -# Test report is initialized
-  -# For each test group following steps are executed:
+  -# For each test group with at least one test selected by \ref dv_test_filter following steps are executed:
     -# Test group initialization is called (custom test group initialization)
     -# Test group header is written to standard output 
-    -# All tests in a group are executed as follows:
+    -# All tests in a group selected by \ref dv_test_filter are executed as follows:
         - Test statistics are initialized
         - Test report header is written to the standard output
-        - Test function is executed
+        - Test function is executed and its execution time is measured
+          (in a worker thread terminated when the time budget expires, if test watchdog is enabled;
+          repeatedly with iteration statistics collected, if the test is selected for repeat mode)
         - Test results are written to the standard output
         - Test report footer is written to the standard output
-    -# Test group footer is written to standard output 
     -# Test group uninitialization is called (custom test group uninitialization)
+    -# Test group footer is written to standard output 
+  -# Test groups selected for concurrent execution (if enabled in DV_Config.h) are executed first,
+     each in its own thread, the remaining test groups are executed sequentially
+  -# Test report footer (list of slowest tests) is written to standard output
   -# Debug session ends when closeDebug function is reached
+
+Execution time of test group initialization and uninitialization and of each test function
+is measured with the kernel system timer (configured in DV_Config.h).
 */
 void cmsis_dv (void *argument) {
-  const char *fn;
-  uint32_t    i, tc, no;
+  uint32_t i;
 
   (void)argument;
 
   if (tg_cnt != 0U) {                   /* If at least 1 test is enabled      */
 
+#if (DV_TEST_FILTER_EN != 0) && (DV_TEST_FILTER_STDIN != 0)
+    FilterRead();                       /* Read test filter                   */
+#endif
+
     ritf.tr_Init ();                    /* Init test report                   */
 
-    for (i = 0U; i < tg_cnt; i++) {
+#if (DV_CONCURRENT_EN != 0)
+    GroupsConcurrentRun();              /* Execute concurrent test groups     */
+#endif
 
-                                        /* Init test group report             */
-      ritf.tg_Init(ts[i].ReportTitle,   /* Write test group title             */
-                   ts[i].Date,          /* Write test group compilation date  */
-                   ts[i].Time,          /* Write test group compilation time  */
-                   ts[i].FileName);     /* Write test group module file name  */
+    for (i = 0U; i < tg_cnt; i++) {
 
-      if (ts[i].Init != NULL) {
-        ts[i].Init();                   /* Init test group (group setup)      */
+#if (DV_TEST_FILTER_EN != 0)
+      if (GroupSelected(&ts[i]) == 0U) {
+        continue;                       /* Skip group if no test is selected  */
       }
-
-      ritf.tg_InfoDone();               /* Test group info done               */
-
-      /* Execute all tests in a group */
-      for (tc = 0U; tc < ts[i].NumOfTC; tc++) {
-        no = tc + 1U;                   /* Test number                        */
-        fn = ts[i].TC[tc].TFName;       /* Test function name string          */
-        ritf.tc_Init (no, fn);          /* Init test report #(Base + TC)      */
-        if (ts[i].TC[tc].TestFunc != NULL) {
-          ts[i].TC[tc].TestFunc();      /* Execute test func if enabled       */
-        }
-        ritf.tc_Uninit ();              /* Uninit test report                 */
+#endif
+#if (DV_CONCURRENT_EN != 0)
+      if (GroupConcurrent(&ts[i]) != 0U) {
+        continue;                       /* Skip group executed concurrently   */
       }
+#endif
 
-      ritf.tg_Uninit ();                /* Uninit test group report           */
-
-      if (ts[i].Uninit != NULL) {
-        ts[i].Uninit();                 /* Uninit test group (group teardown) */
-      }
+      GroupRun(&ts[i]);                 /* Execute test group                 */
     }
 
     ritf.tr_Uninit();                   /* Uninit test report                 */
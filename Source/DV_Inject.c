@@ -0,0 +1,967 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-Driver Validation
+ * Title:       Driver fault and latency injection
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+
+#include "cmsis_dv.h"
+#include "DV_Config.h"
+#include "DV_Framework.h"
+
+#if (DV_INJECT_EN != 0)
+
+#if defined(RTE_CMSIS_DV_SPI) && (DV_INJECT_SPI != 0)
+#define INJ_SPI         1
+#include "DV_SPI_Config.h"
+#include "Driver_SPI.h"
+#else
+#define INJ_SPI         0
+#endif
+#if defined(RTE_CMSIS_DV_USART) && (DV_INJECT_USART != 0)
+#define INJ_USART       1
+#include "DV_USART_Config.h"
+#include "Driver_USART.h"
+#else
+#define INJ_USART       0
+#endif
+#if defined(RTE_CMSIS_DV_ETH) && (DV_INJECT_ETH != 0)
+#define INJ_ETH         1
+#include "DV_ETH_Config.h"
+#include "Driver_ETH_MAC.h"
+#else
+#define INJ_ETH         0
+#endif
+#if defined(RTE_CMSIS_DV_CAN) && (DV_INJECT_CAN != 0)
+#define INJ_CAN         1
+#include "DV_CAN_Config.h"
+#include "Driver_CAN.h"
+#else
+#define INJ_CAN         0
+#endif
+#if defined(RTE_CMSIS_DV_WIFI) && (DV_INJECT_WIFI != 0)
+#define INJ_WIFI        1
+#include "DV_WiFi_Config.h"
+#include "Driver_WiFi.h"
+#else
+#define INJ_WIFI        0
+#endif
+
+/* Injection statistics and schedule of one execution context */
+typedef struct {
+  uint32_t rnd;                         /* Pseudo-random schedule state       */
+  uint32_t delays;                      /* Number of injected delays          */
+  uint32_t delay_sum;                   /* Sum of injected delays [us]        */
+  uint32_t delay_max;                   /* Longest injected delay [us]        */
+  uint32_t drops;                       /* Number of dropped events           */
+  uint32_t shorts;                      /* Number of shortened data counts    */
+  uint32_t flips;                       /* Number of inverted data bits       */
+} INJ_STAT;
+
+/* Injection context of an interposed driver */
+typedef struct {
+  const char *name;                     /* Driver name (report)               */
+  const char *prefix;                   /* Test function name prefix          */
+  INJ_STAT    call;                     /* Driver function calls (thread)     */
+  INJ_STAT    event;                    /* Signaled events (driver interrupt) */
+} INJ_CTX;
+
+#if (INJ_SPI != 0)
+static INJ_CTX spi_ctx   = { "SPI",     "SPI_"   };
+#endif
+#if (INJ_USART != 0)
+static INJ_CTX usart_ctx = { "USART",   "USART_" };
+#endif
+#if (INJ_ETH != 0)
+static INJ_CTX eth_ctx   = { "ETH_MAC", "ETH_"   };
+#endif
+#if (INJ_CAN != 0)
+static INJ_CTX can_ctx   = { "CAN",     "CAN_"   };
+#endif
+#if (INJ_WIFI != 0)
+static INJ_CTX wifi_ctx  = { "WiFi",    "WIFI_"  };
+#endif
+
+static INJ_CTX * const inj_ctx[] = {
+#if (INJ_SPI != 0)
+  &spi_ctx,
+#endif
+#if (INJ_USART != 0)
+  &usart_ctx,
+#endif
+#if (INJ_ETH != 0)
+  &eth_ctx,
+#endif
+#if (INJ_CAN != 0)
+  &can_ctx,
+#endif
+#if (INJ_WIFI != 0)
+  &wifi_ctx,
+#endif
+  NULL
+};
+
+static char inj_msg[160];
+
+/*
+  \fn            static uint32_t InjTest (const INJ_CTX *ctx, const char *name)
+  \brief         Check if a test validates the driver of an injection context.
+  \detail        Only the injection context of the driver under test is reseeded and
+                 reported, so tests of concurrent test groups (different drivers)
+                 do not influence each other.
+  \param[in]     ctx    injection context
+  \param[in]     name   test function name
+  \return        1 = driver under test, 0 = other driver
+*/
+static uint32_t InjTest (const INJ_CTX *ctx, const char *name) {
+  return ((strncmp(name, ctx->prefix, strlen(ctx->prefix)) == 0) ? 1U : 0U);
+}
+
+/*
+  \fn            static uint32_t InjRand (INJ_STAT *st)
+  \brief         Get next number of the pseudo-random schedule (xorshift32).
+  \param[in,out] st     pointer to injection statistics
+  \return        pseudo-random number
+*/
+static uint32_t InjRand (INJ_STAT *st) {
+  uint32_t x = st->rnd;
+
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  st->rnd = x;
+
+  return (x);
+}
+
+/*
+  \fn            static uint32_t InjChance (INJ_STAT *st, uint32_t rate)
+  \brief         Decide whether a fault is injected.
+  \param[in,out] st     pointer to injection statistics
+  \param[in]     rate   injection rate [1/1000]
+  \return        1 = inject, 0 = do not inject (also outside of tests, schedule not seeded)
+*/
+static uint32_t InjChance (INJ_STAT *st, uint32_t rate) {
+  if ((rate == 0U) || (st->rnd == 0U)) {
+    return (0U);
+  }
+  return (((InjRand(st) % 1000U) < rate) ? 1U : 0U);
+}
+
+/*
+  \fn            static void InjDelay (INJ_STAT *st)
+  \brief         Inject a delay (busy wait, also used in the driver event context).
+  \param[in,out] st     pointer to injection statistics
+  \return        none
+*/
+static void InjDelay (INJ_STAT *st) {
+  uint32_t us, cnt, ticks;
+
+  if (InjChance(st, DV_INJECT_DELAY_RATE) == 0U) {
+    return;
+  }
+  us    = (InjRand(st) % DV_INJECT_DELAY_MAX) + 1U;
+  ticks = (uint32_t)SYSTIMER_US(us);
+  cnt   = GET_SYSTIMER();
+  while ((GET_SYSTIMER() - cnt) < ticks);
+
+  st->delays++;
+  st->delay_sum += us;
+  if (us > st->delay_max) {
+    st->delay_max = us;
+  }
+}
+
+/*
+  \fn            static uint32_t InjDrop (INJ_STAT *st, uint32_t event, uint32_t mask)
+  \brief         Drop completion events.
+  \param[in,out] st     pointer to injection statistics
+  \param[in]     event  signaled events
+  \param[in]     mask   completion events that can be dropped
+  \return        events to signal
+*/
+static uint32_t InjDrop (INJ_STAT *st, uint32_t event, uint32_t mask) {
+  if (((event & mask) != 0U) && (InjChance(st, DV_INJECT_DROP_RATE) != 0U)) {
+    event &= ~mask;
+    st->drops++;
+  }
+  return (event);
+}
+
+/*
+  \fn            static uint32_t InjShort (INJ_STAT *st, uint32_t cnt)
+  \brief         Shorten a data count.
+  \param[in,out] st     pointer to injection statistics
+  \param[in]     cnt    data count
+  \return        data count, reduced by 1 to cnt when a fault is injected
+*/
+static uint32_t InjShort (INJ_STAT *st, uint32_t cnt) {
+  if ((cnt != 0U) && (InjChance(st, DV_INJECT_SHORT_RATE) != 0U)) {
+    cnt -= (InjRand(st) % cnt) + 1U;
+    st->shorts++;
+  }
+  return (cnt);
+}
+
+/*
+  \fn            static void InjFlip (INJ_STAT *st, void *data, uint32_t len)
+  \brief         Invert a bit of received data.
+  \param[in,out] st     pointer to injection statistics
+  \param[in,out] data   pointer to received data
+  \param[in]     len    number of received bytes
+  \return        none
+*/
+static void InjFlip (INJ_STAT *st, void *data, uint32_t len) {
+  uint32_t bit;
+
+  if ((data != NULL) && (len != 0U) && (InjChance(st, DV_INJECT_FLIP_RATE) != 0U)) {
+    bit = InjRand(st) % (len * 8U);
+    ((uint8_t *)data)[bit / 8U] ^= (uint8_t)(1U << (bit % 8U));
+    st->flips++;
+  }
+}
+
+/*
+  \fn            static uint32_t InjSeed (uint32_t seed)
+  \brief         Get valid schedule state from a seed (xorshift32 state must not be 0).
+  \param[in]     seed   seed
+  \return        schedule state
+*/
+static uint32_t InjSeed (uint32_t seed) {
+  return ((seed != 0U) ? seed : 0x2545F491U);
+}
+
+/*
+  \fn            void __inject_start (const char *name)
+  \brief         Reset injection statistics and reseed the schedule of the driver under test at test start.
+  \detail        The schedule is derived from DV_INJECT_SEED and the test function name,
+                 so a test gets the same schedule regardless of the tests executed before.
+  \param[in]     name   test function name
+  \return        none
+*/
+void __inject_start (const char *name) {
+  INJ_CTX    *ctx;
+  const char *cp;
+  uint32_t    i, hash;
+
+  hash = 2166136261U;                   /* FNV-1a hash of the test name       */
+  for (cp = name; *cp != '\0'; cp++) {
+    hash = (hash ^ (uint8_t)*cp) * 16777619U;
+  }
+  hash ^= (uint32_t)DV_INJECT_SEED;
+
+  for (i = 0U; inj_ctx[i] != NULL; i++) {
+    ctx = inj_ctx[i];
+    if (InjTest(ctx, name) == 0U) {
+      continue;
+    }
+    memset(&ctx->call,  0, sizeof(INJ_STAT));
+    memset(&ctx->event, 0, sizeof(INJ_STAT));
+    ctx->call.rnd  = InjSeed(hash ^ ((i + 1U) * 0x9E3779B9U));
+    ctx->event.rnd = InjSeed(hash ^ ((i + 1U) * 0x7F4A7C15U));
+  }
+}
+
+/*
+  \fn            void __inject_done (const char *name)
+  \brief         Stop fault injection and report faults injected during the test.
+  \detail        Test group setup and teardown are executed without fault injection.
+  \param[in]     name   test function name
+  \return        none
+*/
+void __inject_done (const char *name) {
+  INJ_CTX  *ctx;
+  uint32_t  i, delays, delay_sum, delay_max;
+
+  for (i = 0U; inj_ctx[i] != NULL; i++) {
+    ctx            = inj_ctx[i];
+    if (InjTest(ctx, name) == 0U) {
+      continue;
+    }
+    ctx->call.rnd  = 0U;
+    ctx->event.rnd = 0U;
+    delays    = ctx->call.delays    + ctx->event.delays;
+    delay_sum = ctx->call.delay_sum + ctx->event.delay_sum;
+    delay_max = (ctx->call.delay_max > ctx->event.delay_max) ? ctx->call.delay_max : ctx->event.delay_max;
+    if ((delays == 0U) && (ctx->event.drops == 0U) &&
+        ((ctx->call.shorts + ctx->event.shorts) == 0U) && ((ctx->call.flips + ctx->event.flips) == 0U)) {
+      continue;
+    }
+    snprintf(inj_msg, sizeof(inj_msg),
+             "[INFO] Injected %s faults: delays %u (total %u us, max %u us), dropped events %u, short counts %u, bit flips %u",
+             ctx->name, delays, delay_sum, delay_max, ctx->event.drops,
+             ctx->call.shorts + ctx->event.shorts, ctx->call.flips + ctx->event.flips);
+    __set_message(__FILE__, __LINE__, inj_msg);
+  }
+}
+
+#if (INJ_SPI != 0)
+/*-----------------------------------------------------------------------------
+ *      SPI interposer
+ *----------------------------------------------------------------------------*/
+#define _ARM_Driver_SPI_(n)     Driver_SPI##n
+#define  ARM_Driver_SPI_(n)     _ARM_Driver_SPI_(n)
+extern   ARM_DRIVER_SPI         ARM_Driver_SPI_(DRV_SPI);
+static   ARM_DRIVER_SPI        *spi_drv = &ARM_Driver_SPI_(DRV_SPI);
+
+static ARM_SPI_SignalEvent_t spi_cb_event;
+static void       * volatile spi_rx_data;
+static uint32_t     volatile spi_rx_num;
+
+static void SPI_InjEvent (uint32_t event) {
+  InjDelay(&spi_ctx.event);
+  if ((event & ARM_SPI_EVENT_TRANSFER_COMPLETE) != 0U) {
+    InjFlip(&spi_ctx.event, spi_rx_data, spi_rx_num);
+  }
+  event = InjDrop(&spi_ctx.event, event, ARM_SPI_EVENT_TRANSFER_COMPLETE);
+  if ((event != 0U) && (spi_cb_event != NULL)) {
+    spi_cb_event(event);
+  }
+}
+
+static ARM_DRIVER_VERSION SPI_InjGetVersion (void) {
+  return (spi_drv->GetVersion());
+}
+
+static ARM_SPI_CAPABILITIES SPI_InjGetCapabilities (void) {
+  return (spi_drv->GetCapabilities());
+}
+
+static int32_t SPI_InjInitialize (ARM_SPI_SignalEvent_t cb_event) {
+  spi_cb_event = cb_event;
+  return (spi_drv->Initialize((cb_event != NULL) ? SPI_InjEvent : NULL));
+}
+
+static int32_t SPI_InjUninitialize (void) {
+  return (spi_drv->Uninitialize());
+}
+
+static int32_t SPI_InjPowerControl (ARM_POWER_STATE state) {
+  return (spi_drv->PowerControl(state));
+}
+
+static int32_t SPI_InjSend (const void *data, uint32_t num) {
+  InjDelay(&spi_ctx.call);
+  spi_rx_data = NULL;
+  return (spi_drv->Send(data, num));
+}
+
+static int32_t SPI_InjReceive (void *data, uint32_t num) {
+  InjDelay(&spi_ctx.call);
+  spi_rx_data = data;
+  spi_rx_num  = num;
+  return (spi_drv->Receive(data, num));
+}
+
+static int32_t SPI_InjTransfer (const void *data_out, void *data_in, uint32_t num) {
+  InjDelay(&spi_ctx.call);
+  spi_rx_data = data_in;
+  spi_rx_num  = num;
+  return (spi_drv->Transfer(data_out, data_in, num));
+}
+
+static uint32_t SPI_InjGetDataCount (void) {
+  return (InjShort(&spi_ctx.call, spi_drv->GetDataCount()));
+}
+
+static int32_t SPI_InjControl (uint32_t control, uint32_t arg) {
+  return (spi_drv->Control(control, arg));
+}
+
+static ARM_SPI_STATUS SPI_InjGetStatus (void) {
+  return (spi_drv->GetStatus());
+}
+
+ARM_DRIVER_SPI DV_Inject_Driver_SPI = {
+  SPI_InjGetVersion,
+  SPI_InjGetCapabilities,
+  SPI_InjInitialize,
+  SPI_InjUninitialize,
+  SPI_InjPowerControl,
+  SPI_InjSend,
+  SPI_InjReceive,
+  SPI_InjTransfer,
+  SPI_InjGetDataCount,
+  SPI_InjControl,
+  SPI_InjGetStatus
+};
+#endif
+
+#if (INJ_USART != 0)
+/*-----------------------------------------------------------------------------
+ *      USART interposer
+ *----------------------------------------------------------------------------*/
+#define _ARM_Driver_USART_(n)   Driver_USART##n
+#define  ARM_Driver_USART_(n)   _ARM_Driver_USART_(n)
+extern   ARM_DRIVER_USART       ARM_Driver_USART_(DRV_USART);
+static   ARM_DRIVER_USART      *usart_drv = &ARM_Driver_USART_(DRV_USART);
+
+static ARM_USART_SignalEvent_t usart_cb_event;
+static void         * volatile usart_rx_data;
+static uint32_t       volatile usart_rx_num;
+
+static void USART_InjEvent (uint32_t event) {
+  InjDelay(&usart_ctx.event);
+  if ((event & (ARM_USART_EVENT_RECEIVE_COMPLETE | ARM_USART_EVENT_TRANSFER_COMPLETE)) != 0U) {
+    InjFlip(&usart_ctx.event, usart_rx_data, usart_rx_num);
+  }
+  event = InjDrop(&usart_ctx.event, event, ARM_USART_EVENT_SEND_COMPLETE     | ARM_USART_EVENT_RECEIVE_COMPLETE |
+                                           ARM_USART_EVENT_TRANSFER_COMPLETE | ARM_USART_EVENT_TX_COMPLETE);
+  if ((event != 0U) && (usart_cb_event != NULL)) {
+    usart_cb_event(event);
+  }
+}
+
+static ARM_DRIVER_VERSION USART_InjGetVersion (void) {
+  return (usart_drv->GetVersion());
+}
+
+static ARM_USART_CAPABILITIES USART_InjGetCapabilities (void) {
+  return (usart_drv->GetCapabilities());
+}
+
+static int32_t USART_InjInitialize (ARM_USART_SignalEvent_t cb_event) {
+  usart_cb_event = cb_event;
+  return (usart_drv->Initialize((cb_event != NULL) ? USART_InjEvent : NULL));
+}
+
+static int32_t USART_InjUninitialize (void) {
+  return (usart_drv->Uninitialize());
+}
+
+static int32_t USART_InjPowerControl (ARM_POWER_STATE state) {
+  return (usart_drv->PowerControl(state));
+}
+
+static int32_t USART_InjSend (const void *data, uint32_t num) {
+  InjDelay(&usart_ctx.call);
+  return (usart_drv->Send(data, num));
+}
+
+static int32_t USART_InjReceive (void *data, uint32_t num) {
+  InjDelay(&usart_ctx.call);
+  usart_rx_data = data;
+  usart_rx_num  = num;
+  return (usart_drv->Receive(data, num));
+}
+
+static int32_t USART_InjTransfer (const void *data_out, void *data_in, uint32_t num) {
+  InjDelay(&usart_ctx.call);
+  usart_rx_data = data_in;
+  usart_rx_num  = num;
+  return (usart_drv->Transfer(data_out, data_in, num));
+}
+
+static uint32_t USART_InjGetTxCount (void) {
+  return (InjShort(&usart_ctx.call, usart_drv->GetTxCount()));
+}
+
+static uint32_t USART_InjGetRxCount (void) {
+  return (InjShort(&usart_ctx.call, usart_drv->GetRxCount()));
+}
+
+static int32_t USART_InjControl (uint32_t control, uint32_t arg) {
+  return (usart_drv->Control(control, arg));
+}
+
+static ARM_USART_STATUS USART_InjGetStatus (void) {
+  return (usart_drv->GetStatus());
+}
+
+static int32_t USART_InjSetModemControl (ARM_USART_MODEM_CONTROL control) {
+  return (usart_drv->SetModemControl(control));
+}
+
+static ARM_USART_MODEM_STATUS USART_InjGetModemStatus (void) {
+  return (usart_drv->GetModemStatus());
+}
+
+ARM_DRIVER_USART DV_Inject_Driver_USART = {
+  USART_InjGetVersion,
+  USART_InjGetCapabilities,
+  USART_InjInitialize,
+  USART_InjUninitialize,
+  USART_InjPowerControl,
+  USART_InjSend,
+  USART_InjReceive,
+  USART_InjTransfer,
+  USART_InjGetTxCount,
+  USART_InjGetRxCount,
+  USART_InjControl,
+  USART_InjGetStatus,
+  USART_InjSetModemControl,
+  USART_InjGetModemStatus
+};
+#endif
+
+#if (INJ_ETH != 0)
+/*-----------------------------------------------------------------------------
+ *      ETH_MAC interposer
+ *----------------------------------------------------------------------------*/
+extern ARM_DRIVER_ETH_MAC  CREATE_SYMBOL(Driver_ETH_MAC, DRV_ETH);
+static ARM_DRIVER_ETH_MAC *eth_drv = &CREATE_SYMBOL(Driver_ETH_MAC, DRV_ETH);
+
+static ARM_ETH_MAC_SignalEvent_t eth_cb_event;
+
+static void ETH_InjEvent (uint32_t event) {
+  InjDelay(&eth_ctx.event);
+  event = InjDrop(&eth_ctx.event, event, ARM_ETH_MAC_EVENT_RX_FRAME | ARM_ETH_MAC_EVENT_TX_FRAME);
+  if ((event != 0U) && (eth_cb_event != NULL)) {
+    eth_cb_event(event);
+  }
+}
+
+static ARM_DRIVER_VERSION ETH_InjGetVersion (void) {
+  return (eth_drv->GetVersion());
+}
+
+static ARM_ETH_MAC_CAPABILITIES ETH_InjGetCapabilities (void) {
+  return (eth_drv->GetCapabilities());
+}
+
+static int32_t ETH_InjInitialize (ARM_ETH_MAC_SignalEvent_t cb_event) {
+  eth_cb_event = cb_event;
+  return (eth_drv->Initialize((cb_event != NULL) ? ETH_InjEvent : NULL));
+}
+
+static int32_t ETH_InjUninitialize (void) {
+  return (eth_drv->Uninitialize());
+}
+
+static int32_t ETH_InjPowerControl (ARM_POWER_STATE state) {
+  return (eth_drv->PowerControl(state));
+}
+
+static int32_t ETH_InjGetMacAddress (ARM_ETH_MAC_ADDR *ptr_addr) {
+  return (eth_drv->GetMacAddress(ptr_addr));
+}
+
+static int32_t ETH_InjSetMacAddress (const ARM_ETH_MAC_ADDR *ptr_addr) {
+  return (eth_drv->SetMacAddress(ptr_addr));
+}
+
+static int32_t ETH_InjSetAddressFilter (const ARM_ETH_MAC_ADDR *ptr_addr, uint32_t num_addr) {
+  return (eth_drv->SetAddressFilter(ptr_addr, num_addr));
+}
+
+static int32_t ETH_InjSendFrame (const uint8_t *frame, uint32_t len, uint32_t flags) {
+  InjDelay(&eth_ctx.call);
+  return (eth_drv->SendFrame(frame, len, flags));
+}
+
+static int32_t ETH_InjReadFrame (uint8_t *frame, uint32_t len) {
+  int32_t rval;
+
+  InjDelay(&eth_ctx.call);
+  rval = eth_drv->ReadFrame(frame, len);
+  if (rval > 0) {
+    InjFlip(&eth_ctx.call, frame, (uint32_t)rval);
+  }
+  return (rval);
+}
+
+static uint32_t ETH_InjGetRxFrameSize (void) {
+  return (eth_drv->GetRxFrameSize());
+}
+
+static int32_t ETH_InjGetRxFrameTime (ARM_ETH_MAC_TIME *time) {
+  return (eth_drv->GetRxFrameTime(time));
+}
+
+static int32_t ETH_InjGetTxFrameTime (ARM_ETH_MAC_TIME *time) {
+  return (eth_drv->GetTxFrameTime(time));
+}
+
+static int32_t ETH_InjControlTimer (uint32_t control, ARM_ETH_MAC_TIME *time) {
+  return (eth_drv->ControlTimer(control, time));
+}
+
+static int32_t ETH_InjControl (uint32_t control, uint32_t arg) {
+  return (eth_drv->Control(control, arg));
+}
+
+static int32_t ETH_InjPHY_Read (uint8_t phy_addr, uint8_t reg_addr, uint16_t *data) {
+  return (eth_drv->PHY_Read(phy_addr, reg_addr, data));
+}
+
+static int32_t ETH_InjPHY_Write (uint8_t phy_addr, uint8_t reg_addr, uint16_t data) {
+  return (eth_drv->PHY_Write(phy_addr, reg_addr, data));
+}
+
+ARM_DRIVER_ETH_MAC DV_Inject_Driver_ETH_MAC = {
+  ETH_InjGetVersion,
+  ETH_InjGetCapabilities,
+  ETH_InjInitialize,
+  ETH_InjUninitialize,
+  ETH_InjPowerControl,
+  ETH_InjGetMacAddress,
+  ETH_InjSetMacAddress,
+  ETH_InjSetAddressFilter,
+  ETH_InjSendFrame,
+  ETH_InjReadFrame,
+  ETH_InjGetRxFrameSize,
+  ETH_InjGetRxFrameTime,
+  ETH_InjGetTxFrameTime,
+  ETH_InjControlTimer,
+  ETH_InjControl,
+  ETH_InjPHY_Read,
+  ETH_InjPHY_Write
+};
+#endif
+
+#if (INJ_CAN != 0)
+/*-----------------------------------------------------------------------------
+ *      CAN interposer
+ *----------------------------------------------------------------------------*/
+extern ARM_DRIVER_CAN  CREATE_SYMBOL(Driver_CAN, DRV_CAN);
+static ARM_DRIVER_CAN *can_drv = &CREATE_SYMBOL(Driver_CAN, DRV_CAN);
+
+static ARM_CAN_SignalUnitEvent_t   can_cb_unit_event;
+static ARM_CAN_SignalObjectEvent_t can_cb_object_event;
+
+static void CAN_InjUnitEvent (uint32_t event) {
+  InjDelay(&can_ctx.event);
+  if (can_cb_unit_event != NULL) {
+    can_cb_unit_event(event);
+  }
+}
+
+static void CAN_InjObjectEvent (uint32_t obj_idx, uint32_t event) {
+  InjDelay(&can_ctx.event);
+  event = InjDrop(&can_ctx.event, event, ARM_CAN_EVENT_SEND_COMPLETE | ARM_CAN_EVENT_RECEIVE);
+  if ((event != 0U) && (can_cb_object_event != NULL)) {
+    can_cb_object_event(obj_idx, event);
+  }
+}
+
+static ARM_DRIVER_VERSION CAN_InjGetVersion (void) {
+  return (can_drv->GetVersion());
+}
+
+static ARM_CAN_CAPABILITIES CAN_InjGetCapabilities (void) {
+  return (can_drv->GetCapabilities());
+}
+
+static int32_t CAN_InjInitialize (ARM_CAN_SignalUnitEvent_t cb_unit_event, ARM_CAN_SignalObjectEvent_t cb_object_event) {
+  can_cb_unit_event   = cb_unit_event;
+  can_cb_object_event = cb_object_event;
+  return (can_drv->Initialize((cb_unit_event   != NULL) ? CAN_InjUnitEvent   : NULL,
+                              (cb_object_event != NULL) ? CAN_InjObjectEvent : NULL));
+}
+
+static int32_t CAN_InjUninitialize (void) {
+  return (can_drv->Uninitialize());
+}
+
+static int32_t CAN_InjPowerControl (ARM_POWER_STATE state) {
+  return (can_drv->PowerControl(state));
+}
+
+static uint32_t CAN_InjGetClock (void) {
+  return (can_drv->GetClock());
+}
+
+static int32_t CAN_InjSetBitrate (ARM_CAN_BITRATE_SELECT select, uint32_t bitrate, uint32_t bit_segments) {
+  return (can_drv->SetBitrate(select, bitrate, bit_segments));
+}
+
+static int32_t CAN_InjSetMode (ARM_CAN_MODE mode) {
+  return (can_drv->SetMode(mode));
+}
+
+static ARM_CAN_OBJ_CAPABILITIES CAN_InjObjectGetCapabilities (uint32_t obj_idx) {
+  return (can_drv->ObjectGetCapabilities(obj_idx));
+}
+
+static int32_t CAN_InjObjectSetFilter (uint32_t obj_idx, ARM_CAN_FILTER_OPERATION operation, uint32_t id, uint32_t arg) {
+  return (can_drv->ObjectSetFilter(obj_idx, operation, id, arg));
+}
+
+static int32_t CAN_InjObjectConfigure (uint32_t obj_idx, ARM_CAN_OBJ_CONFIG obj_cfg) {
+  return (can_drv->ObjectConfigure(obj_idx, obj_cfg));
+}
+
+static int32_t CAN_InjMessageSend (uint32_t obj_idx, ARM_CAN_MSG_INFO *msg_info, const uint8_t *data, uint8_t size) {
+  InjDelay(&can_ctx.call);
+  return (can_drv->MessageSend(obj_idx, msg_info, data, size));
+}
+
+static int32_t CAN_InjMessageRead (uint32_t obj_idx, ARM_CAN_MSG_INFO *msg_info, uint8_t *data, uint8_t size) {
+  int32_t rval;
+
+  InjDelay(&can_ctx.call);
+  rval = can_drv->MessageRead(obj_idx, msg_info, data, size);
+  if (rval > 0) {
+    InjFlip(&can_ctx.call, data, (uint32_t)rval);
+  }
+  return (rval);
+}
+
+static int32_t CAN_InjControl (uint32_t control, uint32_t arg) {
+  return (can_drv->Control(control, arg));
+}
+
+static ARM_CAN_STATUS CAN_InjGetStatus (void) {
+  return (can_drv->GetStatus());
+}
+
+ARM_DRIVER_CAN DV_Inject_Driver_CAN = {
+  CAN_InjGetVersion,
+  CAN_InjGetCapabilities,
+  CAN_InjInitialize,
+  CAN_InjUninitialize,
+  CAN_InjPowerControl,
+  CAN_InjGetClock,
+  CAN_InjSetBitrate,
+  CAN_InjSetMode,
+  CAN_InjObjectGetCapabilities,
+  CAN_InjObjectSetFilter,
+  CAN_InjObjectConfigure,
+  CAN_InjMessageSend,
+  CAN_InjMessageRead,
+  CAN_InjControl,
+  CAN_InjGetStatus
+};
+#endif
+
+#if (INJ_WIFI != 0)
+/*-----------------------------------------------------------------------------
+ *      WiFi interposer
+ *----------------------------------------------------------------------------*/
+extern ARM_DRIVER_WIFI  ARM_Driver_WiFi_(DRV_WIFI);
+static ARM_DRIVER_WIFI *wifi_drv = &ARM_Driver_WiFi_(DRV_WIFI);
+
+static ARM_WIFI_SignalEvent_t wifi_cb_event;
+
+static void WIFI_InjEvent (uint32_t event, void *arg) {
+  InjDelay(&wifi_ctx.event);
+  event = InjDrop(&wifi_ctx.event, event, 0xFFFFFFFFU);
+  if ((event != 0U) && (wifi_cb_event != NULL)) {
+    wifi_cb_event(event, arg);
+  }
+}
+
+/* Shorten socket transfer length (partial send and receive) */
+static uint32_t WIFI_InjLen (uint32_t len) {
+  if (len > 1U) {
+    len = InjShort(&wifi_ctx.call, len - 1U) + 1U;
+  }
+  return (len);
+}
+
+static ARM_DRIVER_VERSION WIFI_InjGetVersion (void) {
+  return (wifi_drv->GetVersion());
+}
+
+static ARM_WIFI_CAPABILITIES WIFI_InjGetCapabilities (void) {
+  return (wifi_drv->GetCapabilities());
+}
+
+static int32_t WIFI_InjInitialize (ARM_WIFI_SignalEvent_t cb_event) {
+  wifi_cb_event = cb_event;
+  return (wifi_drv->Initialize((cb_event != NULL) ? WIFI_InjEvent : NULL));
+}
+
+static int32_t WIFI_InjUninitialize (void) {
+  return (wifi_drv->Uninitialize());
+}
+
+static int32_t WIFI_InjPowerControl (ARM_POWER_STATE state) {
+  return (wifi_drv->PowerControl(state));
+}
+
+static int32_t WIFI_InjGetModuleInfo (char *module_info, uint32_t max_len) {
+  return (wifi_drv->GetModuleInfo(module_info, max_len));
+}
+
+static int32_t WIFI_InjSetOption (uint32_t interface, uint32_t option, const void *data, uint32_t len) {
+  return (wifi_drv->SetOption(interface, option, data, len));
+}
+
+static int32_t WIFI_InjGetOption (uint32_t interface, uint32_t option, void *data, uint32_t *len) {
+  return (wifi_drv->GetOption(interface, option, data, len));
+}
+
+static int32_t WIFI_InjScan (ARM_WIFI_SCAN_INFO_t scan_info[], uint32_t max_num) {
+  return (wifi_drv->Scan(scan_info, max_num));
+}
+
+static int32_t WIFI_InjActivate (uint32_t interface, const ARM_WIFI_CONFIG_t *config) {
+  return (wifi_drv->Activate(interface, config));
+}
+
+static int32_t WIFI_InjDeactivate (uint32_t interface) {
+  return (wifi_drv->Deactivate(interface));
+}
+
+static uint32_t WIFI_InjIsConnected (void) {
+  return (wifi_drv->IsConnected());
+}
+
+static int32_t WIFI_InjGetNetInfo (ARM_WIFI_NET_INFO_t *net_info) {
+  return (wifi_drv->GetNetInfo(net_info));
+}
+
+static int32_t WIFI_InjBypassControl (uint32_t interface, uint32_t mode) {
+  return (wifi_drv->BypassControl(interface, mode));
+}
+
+static int32_t WIFI_InjEthSendFrame (uint32_t interface, const uint8_t *frame, uint32_t len) {
+  InjDelay(&wifi_ctx.call);
+  return (wifi_drv->EthSendFrame(interface, frame, len));
+}
+
+static int32_t WIFI_InjEthReadFrame (uint32_t interface, uint8_t *frame, uint32_t len) {
+  int32_t rval;
+
+  InjDelay(&wifi_ctx.call);
+  rval = wifi_drv->EthReadFrame(interface, frame, len);
+  if (rval > 0) {
+    InjFlip(&wifi_ctx.call, frame, (uint32_t)rval);
+  }
+  return (rval);
+}
+
+static uint32_t WIFI_InjEthGetRxFrameSize (uint32_t interface) {
+  return (wifi_drv->EthGetRxFrameSize(interface));
+}
+
+static int32_t WIFI_InjSocketCreate (int32_t af, int32_t type, int32_t protocol) {
+  return (wifi_drv->SocketCreate(af, type, protocol));
+}
+
+static int32_t WIFI_InjSocketBind (int32_t socket, const uint8_t *ip, uint32_t ip_len, uint16_t port) {
+  return (wifi_drv->SocketBind(socket, ip, ip_len, port));
+}
+
+static int32_t WIFI_InjSocketListen (int32_t socket, int32_t backlog) {
+  return (wifi_drv->SocketListen(socket, backlog));
+}
+
+static int32_t WIFI_InjSocketAccept (int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t *port) {
+  InjDelay(&wifi_ctx.call);
+  return (wifi_drv->SocketAccept(socket, ip, ip_len, port));
+}
+
+static int32_t WIFI_InjSocketConnect (int32_t socket, const uint8_t *ip, uint32_t ip_len, uint16_t port) {
+  InjDelay(&wifi_ctx.call);
+  return (wifi_drv->SocketConnect(socket, ip, ip_len, port));
+}
+
+static int32_t WIFI_InjSocketRecv (int32_t socket, void *buf, uint32_t len) {
+  int32_t rval;
+
+  InjDelay(&wifi_ctx.call);
+  rval = wifi_drv->SocketRecv(socket, buf, WIFI_InjLen(len));
+  if (rval > 0) {
+    InjFlip(&wifi_ctx.call, buf, (uint32_t)rval);
+  }
+  return (rval);
+}
+
+static int32_t WIFI_InjSocketRecvFrom (int32_t socket, void *buf, uint32_t len, uint8_t *ip, uint32_t *ip_len, uint16_t *port) {
+  int32_t rval;
+
+  InjDelay(&wifi_ctx.call);
+  rval = wifi_drv->SocketRecvFrom(socket, buf, len, ip, ip_len, port);
+  if (rval > 0) {
+    InjFlip(&wifi_ctx.call, buf, (uint32_t)rval);
+  }
+  return (rval);
+}
+
+static int32_t WIFI_InjSocketSend (int32_t socket, const void *buf, uint32_t len) {
+  InjDelay(&wifi_ctx.call);
+  return (wifi_drv->SocketSend(socket, buf, WIFI_InjLen(len)));
+}
+
+static int32_t WIFI_InjSocketSendTo (int32_t socket, const void *buf, uint32_t len, const uint8_t *ip, uint32_t ip_len, uint16_t port) {
+  InjDelay(&wifi_ctx.call);
+  return (wifi_drv->SocketSendTo(socket, buf, len, ip, ip_len, port));
+}
+
+static int32_t WIFI_InjSocketGetSockName (int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t *port) {
+  return (wifi_drv->SocketGetSockName(socket, ip, ip_len, port));
+}
+
+static int32_t WIFI_InjSocketGetPeerName (int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t *port) {
+  return (wifi_drv->SocketGetPeerName(socket, ip, ip_len, port));
+}
+
+static int32_t WIFI_InjSocketGetOpt (int32_t socket, int32_t opt_id, void *opt_val, uint32_t *opt_len) {
+  return (wifi_drv->SocketGetOpt(socket, opt_id, opt_val, opt_len));
+}
+
+static int32_t WIFI_InjSocketSetOpt (int32_t socket, int32_t opt_id, const void *opt_val, uint32_t opt_len) {
+  return (wifi_drv->SocketSetOpt(socket, opt_id, opt_val, opt_len));
+}
+
+static int32_t WIFI_InjSocketClose (int32_t socket) {
+  return (wifi_drv->SocketClose(socket));
+}
+
+static int32_t WIFI_InjSocketGetHostByName (const char *name, int32_t af, uint8_t *ip, uint32_t *ip_len) {
+  return (wifi_drv->SocketGetHostByName(name, af, ip, ip_len));
+}
+
+static int32_t WIFI_InjPing (const uint8_t *ip, uint32_t ip_len) {
+  return (wifi_drv->Ping(ip, ip_len));
+}
+
+ARM_DRIVER_WIFI DV_Inject_Driver_WiFi = {
+  WIFI_InjGetVersion,
+  WIFI_InjGetCapabilities,
+  WIFI_InjInitialize,
+  WIFI_InjUninitialize,
+  WIFI_InjPowerControl,
+  WIFI_InjGetModuleInfo,
+  WIFI_InjSetOption,
+  WIFI_InjGetOption,
+  WIFI_InjScan,
+  WIFI_InjActivate,
+  WIFI_InjDeactivate,
+  WIFI_InjIsConnected,
+  WIFI_InjGetNetInfo,
+  WIFI_InjBypassControl,
+  WIFI_InjEthSendFrame,
+  WIFI_InjEthReadFrame,
+  WIFI_InjEthGetRxFrameSize,
+  WIFI_InjSocketCreate,
+  WIFI_InjSocketBind,
+  WIFI_InjSocketListen,
+  WIFI_InjSocketAccept,
+  WIFI_InjSocketConnect,
+  WIFI_InjSocketRecv,
+  WIFI_InjSocketRecvFrom,
+  WIFI_InjSocketSend,
+  WIFI_InjSocketSendTo,
+  WIFI_InjSocketGetSockName,
+  WIFI_InjSocketGetPeerName,
+  WIFI_InjSocketGetOpt,
+  WIFI_InjSocketSetOpt,
+  WIFI_InjSocketClose,
+  WIFI_InjSocketGetHostByName,
+  WIFI_InjPing
+};
+#endif
+
+#endif /* DV_INJECT_EN */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2015-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -23,11 +23,41 @@
  * -----------------------------------------------------------------------------
  */
 
+#include "DV_Config.h"
 #include "DV_Report.h"
+#if (DV_CONCURRENT_EN != 0)
+#include "cmsis_os2.h"
+#endif
 
 /* Local macros */
 #define PRINT(x) MsgPrint x
-#define FLUSH()  MsgFlush()
+#define FLUSH()  MsgFlush(0U)
+
+#if (DV_CONCURRENT_EN != 0)
+#define REPORT_CTX_NUM  (1U + DV_CONCURRENT_NUM)
+#else
+#define REPORT_CTX_NUM  1U
+#endif
+
+/* XML report of a test group is buffered until the group counts are known */
+#if (DV_REPORT_BUF_EN != 0) || (PRINT_XML_REPORT == 1)
+#define REPORT_BUF_MAIN 1U              /* Primary context is buffered        */
+#else
+#define REPORT_BUF_MAIN 0U
+#endif
+
+#if (REPORT_BUF_MAIN != 0U) || (DV_CONCURRENT_EN != 0)
+#define REPORT_BUF_EN   1
+#define REPORT_BUF_NUM  ((REPORT_CTX_NUM - 1U) + REPORT_BUF_MAIN)
+#else
+#define REPORT_BUF_EN   0
+#endif
+
+#if (DV_WATCHDOG_EN != 0)
+#define REPORT_BUDGET   1               /* Time budget usage is reported      */
+#else
+#define REPORT_BUDGET   0
+#endif
 
 /* Local functions */
 static void tr_Init    (void);
@@ -35,14 +65,22 @@ static void tr_Uninit  (void);
 static void tg_Init    (const char *title, const char *date, const char *time, const char *fn);
 static void tg_Info    (const char *info);
 static void tg_InfoDone(void);
-static void tg_Uninit  (void);
+static void tg_Uninit  (uint32_t setup_us, uint32_t teardown_us);
 static void tc_Init    (uint32_t num, const char *fn);
 static void tc_Detail  (const char *module, uint32_t line, const char *message);
-static void tc_Uninit  (void);
+static void tc_Uninit  (uint32_t duration_us);
+static void tc_Measure (const char *name, uint32_t value, const char *unit);
+static void tc_Iteration(uint32_t duration_us);
+static void tc_Memory  (const TEST_MEM_USAGE *mem);
 static void as_Result  (TC_RES res);
 
 static void MsgPrint (const char *msg, ...);
-static void MsgFlush (void);
+#if (PRINT_XML_REPORT == 1)
+static void XmlPrint (const char *str);
+#elif (DV_TIME_REPORT != 0) || (DV_REPEAT_EN != 0)
+static void TimePrint (uint32_t us);
+#endif
+static void MsgFlush (uint32_t group_end);
 
 /* Global variables */
 REPORT_ITF ritf = {                     /* Structure for report interface     */
@@ -55,19 +93,211 @@ REPORT_ITF ritf = {                     /* Structure for report interface     */
   tc_Init,
   tc_Detail,
   tc_Uninit,
+  tc_Measure,
+  tc_Iteration,
+  tc_Memory,
   as_Result,
 };
 
+#if (PRINT_XML_REPORT == 1)
+/* Test measurement record */
+typedef struct {
+  const char *name;                     /* Measurement name string            */
+  const char *unit;                     /* Measurement unit string            */
+  uint32_t    value;                    /* Measured value                     */
+} TEST_MEASUREMENT;
+#elif (DV_TIME_REPORT != 0) && (DV_TIME_SLOWEST_NUM > 0)
+/* Test duration record */
+typedef struct {
+  const char *fn;                       /* Test function name string          */
+  uint32_t    tg;                       /* Test group index                   */
+  uint32_t    num;                      /* Test number                        */
+  uint32_t    duration;                 /* Test duration [us]                 */
+} TEST_TIME;
+#endif
+
+#if (DV_REPEAT_EN != 0)
+#define REPEAT_HIST_SUB 8U              /* Histogram buckets per power of 2   */
+#define REPEAT_HIST_NUM (REPEAT_HIST_SUB * 30U)     /* Covers 0 .. 2^32-1 us  */
+
+/* Test iteration statistics (repeat mode) */
+typedef struct {
+  uint32_t    cnt;                      /* Number of iterations               */
+  uint32_t    failed;                   /* Number of failed iterations        */
+  uint32_t    as_failed;                /* Assertions failed before iteration */
+  uint32_t    min;                      /* Minimum iteration duration [us]    */
+  uint32_t    max;                      /* Maximum iteration duration [us]    */
+  uint64_t    sum;                      /* Sum of iteration durations [us]    */
+  uint32_t    hist[REPEAT_HIST_NUM];    /* Log-bucket duration histogram      */
+} REPEAT_STATS;
+#endif
+
+/* Report context (state of the test group currently reported by a thread) */
+typedef struct {
+  TEST_GROUP_RESULTS tg_result;         /* Test group results                 */
+  uint32_t    as_passed;                /* Assertions passed                  */
+  uint32_t    as_failed;                /* Assertions failed                  */
+  uint32_t    as_detail;                /* Assertions details available       */
+  const char *as_last_file;             /* Last passed assertion module file  */
+  uint32_t    as_last_line;             /* Last passed assertion line number  */
+  uint32_t    tg_open;                  /* Test group report is open          */
+  uint32_t    tc_open;                  /* Test report is open                */
+#if (PRINT_XML_REPORT == 1)
+  const char *tg_title;                 /* Test group title string            */
+  uint32_t    tg_pend;                  /* Test group start tag not written   */
+  TEST_GROUP_RESULTS tg_done;           /* Results of test group parts written*/
+  const char *tc_fn;                    /* Current test function name string  */
+  char        tc_detail[512];           /* Current test details (XML output)  */
+  uint32_t    tc_detail_len;            /* Current test details length        */
+  TEST_MEASUREMENT tc_meas[DV_MEAS_NUM];/* Current test measurements          */
+  uint32_t    tc_meas_cnt;              /* Current test measurements count    */
+  uint32_t    tc_meas_lost;             /* Measurements not reported (full)   */
+#else
+  const char *tc_fn;                    /* Current test function name string  */
+  uint32_t    tc_num;                   /* Current test number                */
+#endif
+#if (DV_REPEAT_EN != 0)
+  REPEAT_STATS rp;                      /* Current test iteration statistics  */
+#endif
+#if (DV_MEM_REPORT != 0)
+  TEST_MEM_USAGE mem;                   /* Current test memory usage          */
+  uint32_t    mem_valid;                /* Memory usage registered            */
+#endif
+#if (DV_WATCHDOG_EN != 0)
+  const char *budget_fn;                /* Test with highest budget usage     */
+  uint32_t    budget_max;               /* Highest test budget usage [%]      */
+#endif
+#if (REPORT_BUF_EN != 0)
+  char       *buf;                      /* Report buffer (NULL = unbuffered)  */
+  uint32_t    len;                      /* Number of bytes in report buffer   */
+  uint32_t    lost;                     /* Number of bytes lost (overflow)    */
+  uint32_t    direct;                   /* Output bypasses the report buffer  */
+#endif
+#if (DV_CONCURRENT_EN != 0)
+  osThreadId_t thread;                  /* Owner thread (NULL = free context) */
+  osThreadId_t worker;                  /* Worker thread executing the tests  */
+#endif
+} REPORT_CTX;
+
+#if (PRINT_XML_REPORT == 1)
+static void tg_Start (REPORT_CTX *ctx, uint32_t counts, uint32_t time_us);
+static void tg_End   (REPORT_CTX *ctx);
+#endif
+#if (REPORT_BUF_EN != 0)
+static void BufWrite (REPORT_CTX *ctx);
+#endif
+
+#if (DV_ASSERT_REC != 0)
+AS_RECORD         dv_as_rec[DV_ASSERT_REC_NUM]; /* Assertion records          */
+uint32_t          dv_as_cnt = 0U;       /* Number of assertion records        */
+#endif
+
 /* Local variables */
-static TEST_GROUP_RESULTS test_group_result;    /* Test group results         */
+static REPORT_CTX report_ctx[REPORT_CTX_NUM];   /* Report contexts            */
+static uint32_t   tg_idx = 0U;          /* Index of last started test group   */
+static uint32_t   tr_open = 0U;         /* Test report is open                */
+static uint32_t   tr_abort = 0U;        /* Test report is aborted             */
 
-static uint32_t   as_passed = 0U;       /* Assertions passed                  */
-static uint32_t   as_failed = 0U;       /* Assertions failed                  */
-static uint32_t   as_detail = 0U;       /* Assertions details available       */
+#if (REPORT_BUF_EN != 0)
+static char       report_buf[REPORT_BUF_NUM][DV_REPORT_BUF_SIZE];   /* Buffers */
+#endif
+
+#if (DV_CONCURRENT_EN != 0)
+static osMutexId_t report_mutex = NULL; /* Report output and shared data lock */
+static const osMutexAttr_t report_mutex_attr = {
+  "DV_Report", osMutexRecursive, NULL, 0U
+};
+#endif
+
+#if (PRINT_XML_REPORT == 0) && (DV_TIME_REPORT != 0) && (DV_TIME_SLOWEST_NUM > 0)
+static TEST_TIME  tc_slowest[DV_TIME_SLOWEST_NUM];  /* Slowest tests, sorted  */
+static uint32_t   tc_slowest_cnt = 0U;  /* Number of slowest tests recorded   */
+#endif
+
+#if (PRINT_XML_REPORT == 0)
 static const char Passed[] = "PASSED";
 static const char Failed[] = "FAILED";
 static const char NotExe[] = "NOT EXECUTED";
+#endif
+
 
+/*-----------------------------------------------------------------------------
+ * Get report context of the calling thread
+ *----------------------------------------------------------------------------*/
+static REPORT_CTX *CtxGet (void) {
+#if (DV_CONCURRENT_EN != 0)
+  osThreadId_t thread;
+  uint32_t     i;
+
+  thread = osThreadGetId();
+  if (thread == NULL) {                 /* Not a thread (ISR, before kernel)  */
+    return (&report_ctx[0]);
+  }
+  for (i = 1U; i < REPORT_CTX_NUM; i++) {
+    if ((report_ctx[i].thread == thread) || (report_ctx[i].worker == thread)) {
+      return (&report_ctx[i]);
+    }
+  }
+#endif
+  return (&report_ctx[0]);
+}
+
+/*-----------------------------------------------------------------------------
+ * Lock report output and data shared between report contexts
+ *----------------------------------------------------------------------------*/
+static void ReportLock (void) {
+#if (DV_CONCURRENT_EN != 0)
+  if ((report_mutex != NULL) && (tr_abort == 0U)) {
+    (void)osMutexAcquire(report_mutex, osWaitForever);
+  }
+#endif
+}
+
+/*-----------------------------------------------------------------------------
+ * Unlock report output and data shared between report contexts
+ *----------------------------------------------------------------------------*/
+static void ReportUnlock (void) {
+#if (DV_CONCURRENT_EN != 0)
+  if ((report_mutex != NULL) && (tr_abort == 0U)) {
+    (void)osMutexRelease(report_mutex);
+  }
+#endif
+}
+
+/*-----------------------------------------------------------------------------
+ * Init report contexts and data shared between them
+ *----------------------------------------------------------------------------*/
+static void ReportInit (void) {
+  uint32_t i;
+#if (REPORT_BUF_EN != 0)
+  uint32_t n;
+
+  n = 0U;
+#endif
+  for (i = 0U; i < REPORT_CTX_NUM; i++) {
+    report_ctx[i].tg_open = 0U;
+    report_ctx[i].tc_open = 0U;
+#if (REPORT_BUF_EN != 0)
+    report_ctx[i].buf     = NULL;
+    report_ctx[i].len     = 0U;
+    report_ctx[i].lost    = 0U;
+    report_ctx[i].direct  = 0U;
+    if ((i != 0U) || (REPORT_BUF_MAIN != 0U)) {
+      report_ctx[i].buf = report_buf[n];
+      n++;
+    }
+#endif
+  }
+#if (DV_CONCURRENT_EN != 0)
+  if (report_mutex == NULL) {
+    report_mutex = osMutexNew(&report_mutex_attr);
+  }
+#endif
+
+  tg_idx   = 0U;
+  tr_open  = 1U;
+  tr_abort = 0U;
+}
 
 /*-----------------------------------------------------------------------------
  * No path - helper function
@@ -84,12 +314,153 @@ static const char *no_path (const char *fn) {
   return (cp);
 }
 
+#if (DV_REPEAT_EN == 0)
+#define RepeatDetail(res)       (1U)    /* Details are always reported        */
+#else
+/*-----------------------------------------------------------------------------
+ * Check if test details are reported in the current test iteration
+ * (details are reported for the first iteration and failures for the first
+ *  failed iteration of a repeated test)
+ *----------------------------------------------------------------------------*/
+static uint32_t RepeatDetail (TC_RES res) {
+  const REPORT_CTX *ctx = CtxGet();
+
+  if (ctx->rp.cnt == 0U) {
+    return (1U);
+  }
+  if ((res == FAILED) && (ctx->rp.failed == 0U)) {
+    return (1U);
+  }
+  return (0U);
+}
+
+/*-----------------------------------------------------------------------------
+ * Get histogram bucket of a duration (8 buckets per power of 2)
+ *----------------------------------------------------------------------------*/
+static uint32_t HistIndex (uint32_t us) {
+  uint32_t e;
+
+  if (us < REPEAT_HIST_SUB) {
+    return (us);                        /* Exact buckets for short durations  */
+  }
+  e = 31U;
+  while ((us >> e) == 0U) {
+    e--;
+  }
+  return (((e - 2U) * REPEAT_HIST_SUB) + ((us >> (e - 3U)) & (REPEAT_HIST_SUB - 1U)));
+}
+
+/*-----------------------------------------------------------------------------
+ * Get duration represented by a histogram bucket (middle of the bucket)
+ *----------------------------------------------------------------------------*/
+static uint32_t HistValue (uint32_t idx) {
+  uint32_t e;
+
+  if (idx < REPEAT_HIST_SUB) {
+    return (idx);
+  }
+  e = (idx / REPEAT_HIST_SUB) + 2U;
+  return (((REPEAT_HIST_SUB + (idx % REPEAT_HIST_SUB)) << (e - 3U)) + ((1U << (e - 3U)) >> 1U));
+}
+
+/*-----------------------------------------------------------------------------
+ * Get iteration duration percentile (resolution is the histogram bucket)
+ *----------------------------------------------------------------------------*/
+static uint32_t RepeatPercentile (const REPEAT_STATS *rp, uint32_t pct) {
+  uint64_t target, cnt;
+  uint32_t i, val;
+
+  target = (((uint64_t)rp->cnt * pct) + 99U) / 100U;
+  if (target == 0U) {
+    target = 1U;
+  }
+  cnt = 0U;
+  val = rp->max;
+  for (i = 0U; i < REPEAT_HIST_NUM; i++) {
+    cnt += rp->hist[i];
+    if (cnt >= target) {
+      val = HistValue(i);
+      break;
+    }
+  }
+  if (val > rp->max) {
+    val = rp->max;
+  }
+  if (val < rp->min) {
+    val = rp->min;
+  }
+
+  return (val);
+}
+#endif
+
+#if (REPORT_BUDGET != 0)
+/*-----------------------------------------------------------------------------
+ * Get test time budget usage and track the highest usage in the test group
+ *----------------------------------------------------------------------------*/
+static uint32_t BudgetUsed (REPORT_CTX *ctx, const char *fn, uint32_t duration_us) {
+  uint32_t used;
+
+  used = (uint32_t)(((uint64_t)duration_us * 100U) / ((uint64_t)DV_WATCHDOG_TEST_TIMEOUT * 1000U));
+  if ((ctx->budget_fn == NULL) || (used > ctx->budget_max)) {
+    ctx->budget_fn  = fn;
+    ctx->budget_max = used;
+  }
+
+  return (used);
+}
+
+#if (DV_WATCHDOG_GROUP_TIMEOUT != 0)
+/*-----------------------------------------------------------------------------
+ * Get test group time budget usage (setup and tests)
+ *----------------------------------------------------------------------------*/
+static uint32_t BudgetGroupUsed (const REPORT_CTX *ctx, uint32_t setup_us) {
+  return ((uint32_t)((((uint64_t)setup_us + ctx->tg_result.duration) * 100U) /
+                     ((uint64_t)DV_WATCHDOG_GROUP_TIMEOUT * 1000U)));
+}
+#endif
+#endif
+
+#if (PRINT_XML_REPORT == 0)
+#if (DV_TIME_REPORT != 0) && (DV_TIME_SLOWEST_NUM > 0)
+/*-----------------------------------------------------------------------------
+ * Add current test to the list of slowest tests (sorted by duration)
+ *----------------------------------------------------------------------------*/
+static void SlowestAdd (const REPORT_CTX *ctx, uint32_t duration_us) {
+  uint32_t i;
+
+  ReportLock();
+
+  if (tc_slowest_cnt < DV_TIME_SLOWEST_NUM) {
+    tc_slowest_cnt++;
+  } else if (duration_us > tc_slowest[DV_TIME_SLOWEST_NUM - 1U].duration) {
+    // Fastest test in the list is dropped
+  } else {
+    ReportUnlock();
+    return;
+  }
+
+  for (i = tc_slowest_cnt - 1U; (i > 0U) && (tc_slowest[i - 1U].duration < duration_us); i--) {
+    tc_slowest[i] = tc_slowest[i - 1U];
+  }
+  tc_slowest[i].fn       = ctx->tc_fn;
+  tc_slowest[i].tg       = ctx->tg_result.idx;
+  tc_slowest[i].num      = ctx->tc_num;
+  tc_slowest[i].duration = duration_us;
+
+  ReportUnlock();
+}
+#endif
+
 /*-----------------------------------------------------------------------------
  * Init test report
  *----------------------------------------------------------------------------*/
 static void tr_Init (void) {
 
-  test_group_result.idx = 0;
+  ReportInit();
+#if (DV_TIME_REPORT != 0) && (DV_TIME_SLOWEST_NUM > 0)
+  tc_slowest_cnt = 0U;
+#endif
 
   PRINT(("                                \n\n"));
 }
@@ -98,17 +469,43 @@ static void tr_Init (void) {
  * Uninit test report
  *----------------------------------------------------------------------------*/
 static void tr_Uninit (void) {
+#if (DV_TIME_REPORT != 0) && (DV_TIME_SLOWEST_NUM > 0)
+  uint32_t i;
+
+  if (tc_slowest_cnt != 0U) {
+    PRINT(("Slowest Tests:\n"));
+    for (i = 0U; i < tc_slowest_cnt; i++) {
+      PRINT(("  GROUP %02d TEST %02d: %-32s ", tc_slowest[i].tg, tc_slowest[i].num, tc_slowest[i].fn));
+      TimePrint(tc_slowest[i].duration);
+      PRINT(("\n"));
+    }
+    PRINT(("\n\n"));
+  }
+#endif
+
+  tr_open = 0U;
+  MsgFlush(1U);
 }
 
 /*-----------------------------------------------------------------------------
  * Init test group
  *----------------------------------------------------------------------------*/
 static void tg_Init (const char *title, const char *date, const char *time, const char *fn) {
+  REPORT_CTX *ctx = CtxGet();
 
-  test_group_result.idx++;
-  test_group_result.tests  = 0U;
-  test_group_result.passed = 0U;
-  test_group_result.failed = 0U;
+  ReportLock();
+  tg_idx++;
+  ctx->tg_result.idx = tg_idx;
+  ReportUnlock();
+  ctx->tg_result.tests    = 0U;
+  ctx->tg_result.passed   = 0U;
+  ctx->tg_result.failed   = 0U;
+  ctx->tg_result.duration = 0U;
+  ctx->tg_open = 1U;
+#if (DV_WATCHDOG_EN != 0)
+  ctx->budget_fn  = NULL;
+  ctx->budget_max = 0U;
+#endif
 
   (void) fn;
   PRINT(("%s   %s   %s \n\n", title, date, time));
@@ -133,34 +530,72 @@ static void tg_InfoDone (void) {
 /*-----------------------------------------------------------------------------
  * Uninit test group
  *----------------------------------------------------------------------------*/
-static void tg_Uninit (void) {
+static void tg_Uninit (uint32_t setup_us, uint32_t teardown_us) {
+  REPORT_CTX *ctx = CtxGet();
   const char *tres;
 
-  if (test_group_result.failed > 0U) {  /* If any test failed => Failed       */
+  if (ctx->tg_result.failed > 0U) {  /* If any test failed => Failed       */
     tres = Failed;
-  } else if (test_group_result.passed > 0U) {   /* If 1 passed => Passed      */
+  } else if (ctx->tg_result.passed > 0U) {      /* If 1 passed => Passed      */
     tres = Passed;
   } else {                              /* If no tests exec => Not-executed   */
     tres = NotExe;
   }
 
   PRINT(("\nTest Summary: %d Tests, %d Passed, %d Failed.\n", 
-         test_group_result.tests, 
-         test_group_result.passed, 
-         test_group_result.failed));
+         ctx->tg_result.tests, 
+         ctx->tg_result.passed, 
+         ctx->tg_result.failed));
+#if (DV_TIME_REPORT != 0)
+  PRINT(("Test Duration: "));
+  TimePrint(ctx->tg_result.duration);
+  PRINT((" (setup "));
+  TimePrint(setup_us);
+  PRINT((", teardown "));
+  TimePrint(teardown_us);
+  PRINT((").\n"));
+#else
+  (void)setup_us;
+  (void)teardown_us;
+#endif
+#if (REPORT_BUDGET != 0)
+  if (ctx->budget_fn != NULL) {
+    PRINT(("Time Budget: test max %u%% (%s)", ctx->budget_max, ctx->budget_fn));
+#if (DV_WATCHDOG_GROUP_TIMEOUT != 0)
+    PRINT((", group %u%%", BudgetGroupUsed(ctx, setup_us)));
+#endif
+    PRINT((".\n"));
+  }
+#endif
   PRINT(("Test Result: %s\n\n\n", tres));
 
-  FLUSH();
+  ctx->tg_open = 0U;
+  MsgFlush(1U);
 }
 
 /*-----------------------------------------------------------------------------
  * Init test
  *----------------------------------------------------------------------------*/
 static void tc_Init (uint32_t num, const char *fn) {
+  REPORT_CTX *ctx = CtxGet();
 
-  as_passed = 0U;
-  as_failed = 0U;
-  as_detail = 0U;
+  ctx->as_passed = 0U;
+  ctx->as_failed = 0U;
+  ctx->as_detail = 0U;
+  ctx->as_last_file = NULL;
+  ctx->tc_open   = 1U;
+#if (DV_ASSERT_REC != 0)
+  dv_as_cnt = 0U;
+#endif
+
+  ctx->tc_fn  = fn;
+  ctx->tc_num = num;
+#if (DV_REPEAT_EN != 0)
+  (void)memset(&ctx->rp, 0, sizeof(ctx->rp));
+#endif
+#if (DV_MEM_REPORT != 0)
+  ctx->mem_valid = 0U;
+#endif
 
   PRINT(("TEST %02d: %-32s ", num, fn));
 }
@@ -173,7 +608,7 @@ static void tc_Detail (const char *module, uint32_t line, const char *message) {
 
   module_no_path = no_path (module);
 
-  as_detail = 1U;
+  CtxGet()->as_detail = 1U;
 
   PRINT(("\n  %s (%d)", module_no_path, line));
   if (message != NULL) {
@@ -184,36 +619,511 @@ static void tc_Detail (const char *module, uint32_t line, const char *message) {
 /*-----------------------------------------------------------------------------
  * Uninit test
  *----------------------------------------------------------------------------*/
-static void tc_Uninit (void) {
+static void tc_Uninit (uint32_t duration_us) {
+  REPORT_CTX *ctx = CtxGet();
   const char *res;
+#if (REPORT_BUDGET != 0)
+  uint32_t    budget_us;
+#endif
 
-  test_group_result.tests++;
+#if (DV_ASSERT_REC != 0)
+  __as_flush();                         /* Process assertion records          */
+#endif
+  ctx->tc_open = 0U;
+  ctx->tg_result.tests++;
 
-  if (as_failed > 0U) {                 /* If any assertion failed => Failed  */
-    test_group_result.failed++;
+  if (ctx->as_failed > 0U) {            /* If any assertion failed => Failed  */
+    ctx->tg_result.failed++;
     res = Failed;
-  } else if (as_passed > 0U) {          /* If 1 assertion passed => Passed    */
-    test_group_result.passed++;
+  } else if (ctx->as_passed > 0U) {     /* If 1 assertion passed => Passed    */
+    ctx->tg_result.passed++;
     res = Passed;
   } else {                              /* If no assertions => Not-executed   */
     res = NotExe;
   }
 
-  if (as_detail != 0U) {
+  if (ctx->as_detail != 0U) {
     PRINT(("\n                                          "));
   }
-  PRINT(("%s\n", res));
+#if (DV_TIME_REPORT != 0) || (REPORT_BUDGET != 0)
+  if (ctx->tg_result.duration > (0xFFFFFFFFU - duration_us)) {
+    ctx->tg_result.duration = 0xFFFFFFFFU;
+  } else {
+    ctx->tg_result.duration += duration_us;
+  }
+#else
+  (void)duration_us;
+#endif
+#if (DV_TIME_REPORT != 0)
+  PRINT(("%-12s ", res));
+  TimePrint(duration_us);
+#else
+  PRINT(("%s", res));
+#endif
+#if (REPORT_BUDGET != 0)
+  budget_us = duration_us;
+#if (DV_REPEAT_EN != 0)
+  if (ctx->rp.cnt != 0U) {              /* Budget applies to each iteration   */
+    budget_us = ctx->rp.max;
+  }
+#endif
+  PRINT(("  (%u%% of budget)", BudgetUsed(ctx, ctx->tc_fn, budget_us)));
+#endif
+  PRINT(("\n"));
+#if (DV_TIME_REPORT != 0) && (DV_TIME_SLOWEST_NUM > 0)
+  if (duration_us != 0U) {
+    SlowestAdd(ctx, duration_us);
+  }
+#endif
+
+#if (DV_REPEAT_EN != 0)
+  if (ctx->rp.cnt != 0U) {
+    PRINT(("  Repeat: %u iterations, %u failed, min ", ctx->rp.cnt, ctx->rp.failed));
+    TimePrint(ctx->rp.min);
+    PRINT((", mean "));
+    TimePrint((uint32_t)(ctx->rp.sum / ctx->rp.cnt));
+    PRINT((", p50 "));
+    TimePrint(RepeatPercentile(&ctx->rp, 50U));
+    PRINT((", p99 "));
+    TimePrint(RepeatPercentile(&ctx->rp, 99U));
+    PRINT((", max "));
+    TimePrint(ctx->rp.max);
+    PRINT(("\n"));
+  }
+#endif
+
+#if (DV_MEM_REPORT != 0)
+  if (ctx->mem_valid != 0U) {
+    PRINT(("  Memory: heap peak %u bytes", ctx->mem.heap_peak));
+    if (ctx->mem.heap_leak != 0U) {
+      PRINT((", %u bytes not freed", ctx->mem.heap_leak));
+    }
+    if (ctx->mem.heap_fail != 0U) {
+      PRINT((", %u allocations failed", ctx->mem.heap_fail));
+    }
+    if (ctx->mem.stack_size != 0U) {
+      PRINT((", stack %u of %u bytes", ctx->mem.stack_used, ctx->mem.stack_size));
+      if ((ctx->mem.stack_cfg != 0U) && (ctx->mem.stack_cfg != ctx->mem.stack_size)) {
+        PRINT((" (%u configured)", ctx->mem.stack_cfg));
+      }
+    }
+    if (ctx->mem.th_stack_size != 0U) {
+      PRINT((", worker stack %u of %u bytes", ctx->mem.th_stack_used, ctx->mem.th_stack_size));
+    }
+    PRINT(("\n"));
+  }
+#endif
+
+#if ((DV_REPORT_BUF_EN != 0) && (DV_REPORT_BUF_DRAIN == 1)) || (DV_CONCURRENT_EN != 0)
+  FLUSH();
+#endif
+}
+
+/*-----------------------------------------------------------------------------
+ * Register test measurement
+ *----------------------------------------------------------------------------*/
+static void tc_Measure (const char *name, uint32_t value, const char *unit) {
+  /* Measurements are reported in XML format only */
+  (void)name;
+  (void)value;
+  (void)unit;
+}
+
+#else /* (PRINT_XML_REPORT == 1) */
+
+/*-----------------------------------------------------------------------------
+ * Init test report (XML)
+ *----------------------------------------------------------------------------*/
+static void tr_Init (void) {
+
+  ReportInit();
+
+  PRINT(("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"));
+  PRINT(("<testsuites>\n"));
+  MsgFlush(1U);
+}
+
+/*-----------------------------------------------------------------------------
+ * Uninit test report (XML)
+ *----------------------------------------------------------------------------*/
+static void tr_Uninit (void) {
+
+  PRINT(("</testsuites>\n"));
+  tr_open = 0U;
+  MsgFlush(1U);
+}
+
+/*-----------------------------------------------------------------------------
+ * Init test group (XML)
+ *----------------------------------------------------------------------------*/
+static void tg_Init (const char *title, const char *date, const char *time, const char *fn) {
+  REPORT_CTX *ctx = CtxGet();
+
+  ReportLock();
+  tg_idx++;
+  ctx->tg_result.idx = tg_idx;
+  ReportUnlock();
+  ctx->tg_result.tests    = 0U;
+  ctx->tg_result.passed   = 0U;
+  ctx->tg_result.failed   = 0U;
+  ctx->tg_result.duration = 0U;
+  ctx->tg_open = 1U;
+#if (DV_WATCHDOG_EN != 0)
+  ctx->budget_fn  = NULL;
+  ctx->budget_max = 0U;
+#endif
+
+  ctx->tg_title = title;
+  ctx->tg_pend  = 1U;                   /* Start tag is written at group end  */
+  ctx->tg_done  = ctx->tg_result;
+
+  (void) fn;
+  PRINT(("    <properties>\n"));
+  PRINT(("      <property name=\"build\" value=\"%s %s\"/>\n", date, time));
+}
+
+/*-----------------------------------------------------------------------------
+ * Write test group start tag and the buffered test group report (XML)
+ * (a test group report larger than half of the buffer is written in parts,
+ *  each with the counts of its tests; without them if the buffer overflows
+ *  in a test, the rest of that test is then written directly)
+ * Report output must be locked by the caller.
+ *----------------------------------------------------------------------------*/
+static void tg_Start (REPORT_CTX *ctx, uint32_t counts, uint32_t time_us) {
+  uint32_t tests, passed, failed;
+  uint32_t len;
+
+  ctx->tg_pend = 0U;
+  ctx->direct  = 1U;
+  len          = ctx->len;
+  ctx->len     = 0U;
+
+  tests  = ctx->tg_result.tests  - ctx->tg_done.tests;
+  passed = ctx->tg_result.passed - ctx->tg_done.passed;
+  failed = ctx->tg_result.failed - ctx->tg_done.failed;
+  if (time_us > (0xFFFFFFFFU - (ctx->tg_result.duration - ctx->tg_done.duration))) {
+    time_us = 0xFFFFFFFFU;
+  } else {
+    time_us += ctx->tg_result.duration - ctx->tg_done.duration;
+  }
+
+  PRINT(("  <testsuite id=\"%u\" name=\"", ctx->tg_result.idx));
+  XmlPrint(ctx->tg_title);
+  if (counts != 0U) {
+    PRINT(("\" tests=\"%u\" failures=\"%u\" skipped=\"%u\" time=\"%u.%06u",
+           tests, failed, tests - passed - failed,
+           time_us / 1000000U, time_us % 1000000U));
+  }
+  PRINT(("\">\n"));
+  (void)fwrite(ctx->buf, 1U, len, stdout);
+}
+
+/*-----------------------------------------------------------------------------
+ * Write test group end tag of a test group part (XML)
+ * (the start tag of the next part is written with its buffered report)
+ *----------------------------------------------------------------------------*/
+static void tg_End (REPORT_CTX *ctx) {
+
+  PRINT(("  </testsuite>\n"));
+  ctx->tg_pend = 1U;
+  ctx->tg_done = ctx->tg_result;
+  ctx->direct  = 0U;
+}
+
+/*-----------------------------------------------------------------------------
+ * Write test group info (XML)
+ *----------------------------------------------------------------------------*/
+static void tg_Info (const char *info) {
+
+  PRINT(("      <property name=\"info\" value=\""));
+  XmlPrint(info);
+  PRINT(("\"/>\n"));
+}
+
+/*-----------------------------------------------------------------------------
+ * Test group info done (XML)
+ *----------------------------------------------------------------------------*/
+static void tg_InfoDone (void) {
+
+  PRINT(("    </properties>\n"));
+  FLUSH();
+}
+
+/*-----------------------------------------------------------------------------
+ * Uninit test group (XML)
+ *----------------------------------------------------------------------------*/
+static void tg_Uninit (uint32_t setup_us, uint32_t teardown_us) {
+  REPORT_CTX *ctx = CtxGet();
+  uint32_t    time_us;
+
+  PRINT(("    <system-out>Test Summary: %u Tests, %u Passed, %u Failed. ",
+         ctx->tg_result.tests,
+         ctx->tg_result.passed,
+         ctx->tg_result.failed));
+  PRINT(("Setup %u.%06u s, teardown %u.%06u s.",
+         setup_us    / 1000000U, setup_us    % 1000000U,
+         teardown_us / 1000000U, teardown_us % 1000000U));
+#if (DV_WATCHDOG_EN != 0)
+  if (ctx->budget_fn != NULL) {
+    PRINT((" Time budget: test max %u%% (%s)", ctx->budget_max, ctx->budget_fn));
+#if (DV_WATCHDOG_GROUP_TIMEOUT != 0)
+    PRINT((", group %u%%", BudgetGroupUsed(ctx, setup_us)));
+#endif
+    PRINT(("."));
+  }
+#endif
+  PRINT(("</system-out>\n"));
+
+  if (ctx->tg_pend != 0U) {
+    time_us = setup_us;
+    if (teardown_us > (0xFFFFFFFFU - time_us)) {
+      time_us = 0xFFFFFFFFU;
+    } else {
+      time_us += teardown_us;
+    }
+    ReportLock();
+    tg_Start(ctx, 1U, time_us);
+  }
+  tg_End(ctx);
+
+  ctx->tg_open = 0U;
+  MsgFlush(1U);
+  ReportUnlock();                       /* Locked by tg_Start or at overflow  */
+}
+
+/*-----------------------------------------------------------------------------
+ * Init test (XML)
+ *----------------------------------------------------------------------------*/
+static void tc_Init (uint32_t num, const char *fn) {
+  REPORT_CTX *ctx = CtxGet();
+
+  ctx->as_passed = 0U;
+  ctx->as_failed = 0U;
+  ctx->as_detail = 0U;
+  ctx->as_last_file = NULL;
+  ctx->tc_open   = 1U;
+#if (DV_ASSERT_REC != 0)
+  dv_as_cnt = 0U;
+#endif
+
+  ctx->tc_fn         = fn;
+  ctx->tc_detail_len = 0U;
+  ctx->tc_meas_cnt   = 0U;
+  ctx->tc_meas_lost  = 0U;
+#if (DV_REPEAT_EN != 0)
+  (void)memset(&ctx->rp, 0, sizeof(ctx->rp));
+#endif
+#if (DV_MEM_REPORT != 0)
+  ctx->mem_valid = 0U;
+#endif
+
+  (void)num;
+}
+
+/*-----------------------------------------------------------------------------
+ * Write test detail (XML)
+ *----------------------------------------------------------------------------*/
+static void tc_Detail (const char *module, uint32_t line, const char *message) {
+  REPORT_CTX *ctx = CtxGet();
+  int32_t     len;
+
+  ctx->as_detail = 1U;
+
+  /* Details are collected and written with the test result */
+  if (ctx->tc_detail_len < (sizeof(ctx->tc_detail) - 1U)) {
+    len = snprintf(&ctx->tc_detail[ctx->tc_detail_len], sizeof(ctx->tc_detail) - ctx->tc_detail_len,
+                   "%s (%u): %s\n", no_path(module), line, (message != NULL) ? message : "");
+    if (len > 0) {
+      ctx->tc_detail_len += (uint32_t)len;
+    }
+  } else {
+    ctx->tc_detail_len = sizeof(ctx->tc_detail);    /* Detail does not fit */
+  }
+  if (ctx->tc_detail_len > (sizeof(ctx->tc_detail) - 1U)) {
+    /* Details truncated, mark it at the end of the details */
+    ctx->tc_detail_len = sizeof(ctx->tc_detail) - 1U;
+    (void)memcpy(&ctx->tc_detail[sizeof(ctx->tc_detail) - 5U], "...\n", 5U);
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ * Uninit test (XML)
+ *----------------------------------------------------------------------------*/
+static void tc_Uninit (uint32_t duration_us) {
+  REPORT_CTX *ctx = CtxGet();
+  uint32_t    i, n;
+
+#if (DV_ASSERT_REC != 0)
+  __as_flush();                         /* Process assertion records          */
+#endif
+  ctx->tc_open = 0U;
+  ctx->tg_result.tests++;
+  if (ctx->tg_result.duration > (0xFFFFFFFFU - duration_us)) {
+    ctx->tg_result.duration = 0xFFFFFFFFU;
+  } else {
+    ctx->tg_result.duration += duration_us;
+  }
+#if (DV_WATCHDOG_EN != 0)
+  if (duration_us != 0U) {
+    n = duration_us;
+#if (DV_REPEAT_EN != 0)
+    if (ctx->rp.cnt != 0U) {            /* Budget applies to each iteration   */
+      n = ctx->rp.max;
+    }
+#endif
+    tc_Measure("Time budget used", BudgetUsed(ctx, ctx->tc_fn, n), "%");
+  }
+#endif
+
+  PRINT(("    <testcase name=\"%s\" classname=\"", ctx->tc_fn));
+  XmlPrint(ctx->tg_title);
+  PRINT(("\" time=\"%u.%06u\" assertions=\"%u\">\n",
+         duration_us / 1000000U, duration_us % 1000000U, ctx->as_passed + ctx->as_failed));
+
+  n = ctx->tc_meas_cnt + ctx->tc_meas_lost;
+#if (DV_REPEAT_EN != 0)
+  n += ctx->rp.cnt;
+#endif
+#if (DV_MEM_REPORT != 0)
+  n += ctx->mem_valid;
+#endif
+  if (n != 0U) {
+    PRINT(("      <properties>\n"));
+    for (i = 0U; i < ctx->tc_meas_cnt; i++) {
+      PRINT(("        <property name=\""));
+      XmlPrint(ctx->tc_meas[i].name);
+      PRINT(("\" value=\"%u %s\"/>\n", ctx->tc_meas[i].value, ctx->tc_meas[i].unit));
+    }
+    if (ctx->tc_meas_lost != 0U) {
+      PRINT(("        <property name=\"Measurements not reported\" value=\"%u\"/>\n", ctx->tc_meas_lost));
+    }
+#if (DV_REPEAT_EN != 0)
+    if (ctx->rp.cnt != 0U) {
+      PRINT(("        <property name=\"Iterations\" value=\"%u\"/>\n", ctx->rp.cnt));
+      PRINT(("        <property name=\"Iterations failed\" value=\"%u\"/>\n", ctx->rp.failed));
+      PRINT(("        <property name=\"Iteration min\" value=\"%u us\"/>\n", ctx->rp.min));
+      PRINT(("        <property name=\"Iteration mean\" value=\"%u us\"/>\n", (uint32_t)(ctx->rp.sum / ctx->rp.cnt)));
+      PRINT(("        <property name=\"Iteration p50\" value=\"%u us\"/>\n", RepeatPercentile(&ctx->rp, 50U)));
+      PRINT(("        <property name=\"Iteration p99\" value=\"%u us\"/>\n", RepeatPercentile(&ctx->rp, 99U)));
+      PRINT(("        <property name=\"Iteration max\" value=\"%u us\"/>\n", ctx->rp.max));
+    }
+#endif
+#if (DV_MEM_REPORT != 0)
+    if (ctx->mem_valid != 0U) {
+      PRINT(("        <property name=\"Heap peak\" value=\"%u bytes\"/>\n", ctx->mem.heap_peak));
+      PRINT(("        <property name=\"Heap not freed\" value=\"%u bytes\"/>\n", ctx->mem.heap_leak));
+      PRINT(("        <property name=\"Heap allocations failed\" value=\"%u\"/>\n", ctx->mem.heap_fail));
+      if (ctx->mem.stack_size != 0U) {
+        PRINT(("        <property name=\"Stack used\" value=\"%u of %u bytes\"/>\n", ctx->mem.stack_used, ctx->mem.stack_size));
+        if ((ctx->mem.stack_cfg != 0U) && (ctx->mem.stack_cfg != ctx->mem.stack_size)) {
+          PRINT(("        <property name=\"Stack configured\" value=\"%u bytes\"/>\n", ctx->mem.stack_cfg));
+        }
+      }
+      if (ctx->mem.th_stack_size != 0U) {
+        PRINT(("        <property name=\"Worker stack used\" value=\"%u of %u bytes\"/>\n", ctx->mem.th_stack_used, ctx->mem.th_stack_size));
+      }
+    }
+#endif
+    PRINT(("      </properties>\n"));
+  }
+
+  if (ctx->as_failed > 0U) {            /* If any assertion failed => Failed  */
+    ctx->tg_result.failed++;
+    PRINT(("      <failure message=\"%u assertion(s) failed\"/>\n", ctx->as_failed));
+  } else if (ctx->as_passed > 0U) {     /* If 1 assertion passed => Passed    */
+    ctx->tg_result.passed++;
+  } else {                              /* If no assertions => Not-executed   */
+    PRINT(("      <skipped/>\n"));
+  }
+
+  if (ctx->as_detail != 0U) {
+    PRINT(("      <system-out>"));
+    XmlPrint(ctx->tc_detail);
+    PRINT(("</system-out>\n"));
+  }
+
+  PRINT(("    </testcase>\n"));
+
+#if (DV_REPORT_BUF_EN == 0) || (DV_REPORT_BUF_DRAIN == 1) || (DV_CONCURRENT_EN != 0)
+  FLUSH();
+#endif
+}
+
+/*-----------------------------------------------------------------------------
+ * Register test measurement (XML)
+ *----------------------------------------------------------------------------*/
+static void tc_Measure (const char *name, uint32_t value, const char *unit) {
+  REPORT_CTX *ctx = CtxGet();
+
+  if (ctx->tc_meas_cnt < ARRAY_SIZE(ctx->tc_meas)) {
+    ctx->tc_meas[ctx->tc_meas_cnt].name  = name;
+    ctx->tc_meas[ctx->tc_meas_cnt].unit  = unit;
+    ctx->tc_meas[ctx->tc_meas_cnt].value = value;
+    ctx->tc_meas_cnt++;
+  } else {
+    ctx->tc_meas_lost++;                /* Counted, reported with the test    */
+  }
+}
+#endif /* (PRINT_XML_REPORT == 1) */
+
+/*-----------------------------------------------------------------------------
+ * Register test iteration (repeat mode)
+ *----------------------------------------------------------------------------*/
+static void tc_Iteration (uint32_t duration_us) {
+#if (DV_REPEAT_EN != 0)
+  REPORT_CTX *ctx = CtxGet();
+
+#if (DV_ASSERT_REC != 0)
+  __as_flush();                         /* Process assertion records          */
+#endif
+
+  if (ctx->rp.cnt == 0U) {
+    ctx->rp.min = duration_us;
+  } else if (duration_us < ctx->rp.min) {
+    ctx->rp.min = duration_us;
+  } else {
+    // Minimum unchanged
+  }
+  if (duration_us > ctx->rp.max) {
+    ctx->rp.max = duration_us;
+  }
+  ctx->rp.cnt++;
+  ctx->rp.sum += duration_us;
+  ctx->rp.hist[HistIndex(duration_us)]++;
+
+  if (ctx->as_failed != ctx->rp.as_failed) {
+    ctx->rp.as_failed = ctx->as_failed; /* Assertion failed in the iteration  */
+    ctx->rp.failed++;
+  }
+#else
+  (void)duration_us;
+#endif
+}
+
+/*-----------------------------------------------------------------------------
+ * Register test memory usage
+ *----------------------------------------------------------------------------*/
+static void tc_Memory (const TEST_MEM_USAGE *mem) {
+#if (DV_MEM_REPORT != 0)
+  REPORT_CTX *ctx = CtxGet();
+
+  ctx->mem       = *mem;
+  ctx->mem_valid = 1U;
+#else
+  (void)mem;
+#endif
 }
 
 /*-----------------------------------------------------------------------------
  * Assertion result registering
  *----------------------------------------------------------------------------*/
 static void as_Result (TC_RES res) {
+  REPORT_CTX *ctx = CtxGet();
 
   if (res == PASSED) {
-    as_passed++;
+    ctx->as_passed++;
   } else if (res == FAILED) {
-    as_failed++;
+    ctx->as_failed++;
   } else {
     // Do nothing
   }
@@ -233,41 +1143,376 @@ void __tg_info (const char *info) {
  * Set result
  *----------------------------------------------------------------------------*/
 void __set_result (const char *module, uint32_t line, const char *message, TC_RES res) {
+  REPORT_CTX *ctx;
 
   // Set debug info
-  if (message != NULL) {
+  if ((message != NULL) && (RepeatDetail(res) != 0U)) {
     tc_Detail(module, line, message);
   }
 
   // Set result
   as_Result(res);
+
+  if (res == PASSED) {
+    ctx = CtxGet();
+    ctx->as_last_file = module;
+    ctx->as_last_line = line;
+  }
 }
 
 /*-----------------------------------------------------------------------------
  * Set message
  *----------------------------------------------------------------------------*/
 void __set_message (const char *module, uint32_t line, const char *message) {
-  if (message != NULL) {
+  if ((message != NULL) && (RepeatDetail(NOT_EXECUTED) != 0U)) {
     tc_Detail(module, line, message);
   }
 }
 
+/*-----------------------------------------------------------------------------
+ * Set measurement
+ *----------------------------------------------------------------------------*/
+void __set_measurement (const char *name, uint32_t value, const char *unit) {
+  if ((name != NULL) && (unit != NULL) && (RepeatDetail(NOT_EXECUTED) != 0U)) {
+    tc_Measure(name, value, unit);
+  }
+}
+
+#if (DV_ASSERT_REC != 0)
+/*-----------------------------------------------------------------------------
+ * Process assertion records (count results, remember last passed assertion)
+ *----------------------------------------------------------------------------*/
+void __as_flush (void) {
+  REPORT_CTX *ctx = CtxGet();
+  uint32_t    i;
+
+  for (i = 0U; i < dv_as_cnt; i++) {
+    if (dv_as_rec[i].res == (uint16_t)PASSED) {
+      ctx->as_passed++;
+      ctx->as_last_file = dv_as_rec[i].file;
+      ctx->as_last_line = dv_as_rec[i].line;
+    } else if (dv_as_rec[i].res == (uint16_t)FAILED) {
+      ctx->as_failed++;
+    } else {
+      // Do nothing
+    }
+  }
+  dv_as_cnt = 0U;
+}
+#endif
+
+/*-----------------------------------------------------------------------------
+ * Write location of the last passed assertion of the current test
+ *----------------------------------------------------------------------------*/
+void __as_last (void) {
+  REPORT_CTX *ctx = CtxGet();
+
+#if (DV_ASSERT_REC != 0)
+  __as_flush();
+#endif
+  if (ctx->as_last_file != NULL) {
+    tc_Detail(ctx->as_last_file, ctx->as_last_line, "Last passed assertion");
+  }
+}
+
+#if (DV_CONCURRENT_EN != 0)
+/*-----------------------------------------------------------------------------
+ * Open report context for the calling thread (concurrent test group)
+ *----------------------------------------------------------------------------*/
+int32_t __report_ctx_open (void) {
+  int32_t  rval;
+  uint32_t i;
+
+  rval = -1;
+
+  ReportLock();
+  for (i = 1U; i < REPORT_CTX_NUM; i++) {
+    if (report_ctx[i].thread == NULL) {
+      report_ctx[i].thread = osThreadGetId();
+      report_ctx[i].len    = 0U;
+      report_ctx[i].lost   = 0U;
+      rval = 0;
+      break;
+    }
+  }
+  ReportUnlock();
+
+  return (rval);
+}
+
+/*-----------------------------------------------------------------------------
+ * Close report context of the calling thread
+ *----------------------------------------------------------------------------*/
+void __report_ctx_close (void) {
+  REPORT_CTX *ctx = CtxGet();
+
+  if (ctx != &report_ctx[0]) {
+    ReportLock();
+    ctx->thread = NULL;
+    ctx->worker = NULL;
+    ReportUnlock();
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ * Get report context of the calling thread
+ *----------------------------------------------------------------------------*/
+uint32_t __report_ctx_get (void) {
+  return ((uint32_t)(CtxGet() - &report_ctx[0]));
+}
+
+/*-----------------------------------------------------------------------------
+ * Set worker thread reporting into a report context (NULL = none)
+ *----------------------------------------------------------------------------*/
+void __report_ctx_worker (uint32_t id, void *thread) {
+  if ((id != 0U) && (id < REPORT_CTX_NUM)) {
+    report_ctx[id].worker = (osThreadId_t)thread;
+  }
+}
+#endif
+
 
 /*-----------------------------------------------------------------------------
  *       MsgPrint:  Print a message to the standard output
+ *                  (or to the report buffer if buffered output is enabled)
  *----------------------------------------------------------------------------*/
 static void MsgPrint (const char *msg, ...) {
   va_list args;
+#if (REPORT_BUF_EN != 0)
+  REPORT_CTX *ctx = CtxGet();
+  uint32_t    space;
+  int32_t     len;
+
+  if ((ctx->buf != NULL) && (ctx->direct == 0U) && (tr_abort == 0U)) {
+    space = DV_REPORT_BUF_SIZE - ctx->len;
+    va_start(args, msg);
+    len = vsnprintf(&ctx->buf[ctx->len], space, msg, args);
+    va_end(args);
+    if (len <= 0) {
+      return;
+    }
+    if ((uint32_t)len < space) {
+      ctx->len += (uint32_t)len;
+      return;
+    }
+#if (PRINT_XML_REPORT == 1)
+    if (ctx->tg_pend != 0U) {
+      /* Buffer full: write test group report so far, the rest of the test directly */
+      ReportLock();                     /* Unlocked at the test end           */
+      tg_Start(ctx, 0U, 0U);
+    }
+#else
+    if (ctx != &report_ctx[0]) {
+      /* Concurrent test group buffer full: write it, the rest of the test directly */
+      ReportLock();                     /* Unlocked at the test end           */
+      BufWrite(ctx);
+      ctx->direct = 1U;
+    }
+#endif
+    if (ctx->direct == 0U) {            /* Message truncated (buffer full)    */
+      ctx->lost += ((uint32_t)len - space) + 1U;
+      ctx->len   = DV_REPORT_BUF_SIZE - 1U;
+      return;
+    }
+  }
+#endif
+  ReportLock();
   va_start(args, msg);
   (void)vprintf(msg, args);
   va_end(args);
+  ReportUnlock();
+}
+
+#if (PRINT_XML_REPORT == 1)
+/*-----------------------------------------------------------------------------
+ *       XmlPrint:  Print a string with XML special characters escaped
+ *----------------------------------------------------------------------------*/
+static void XmlPrint (const char *str) {
+  const char *esc;
+  char        ch;
+
+  while ((ch = *str++) != '\0') {
+    switch (ch) {
+      case '&':  esc = "&amp;";  break;
+      case '<':  esc = "&lt;";   break;
+      case '>':  esc = "&gt;";   break;
+      case '"':  esc = "&quot;"; break;
+      case '\'': esc = "&apos;"; break;
+      case '\n': esc = "&#10;";  break;
+      default:   esc = NULL;     break;
+    }
+    if (esc != NULL) {
+      MsgPrint("%s", esc);
+    } else {
+      MsgPrint("%c", ch);
+    }
+  }
+}
+#elif (DV_TIME_REPORT != 0) || (DV_REPEAT_EN != 0)
+/*-----------------------------------------------------------------------------
+ *       TimePrint:  Print time given in microseconds as milliseconds
+ *----------------------------------------------------------------------------*/
+static void TimePrint (uint32_t us) {
+  MsgPrint("%u.%03u ms", us / 1000U, us % 1000U);
 }
+#endif
+
+#if (REPORT_BUF_EN != 0)
+/*-----------------------------------------------------------------------------
+ *       BufWrite:  Write report buffer of a report context to the standard output
+ *----------------------------------------------------------------------------*/
+static void BufWrite (REPORT_CTX *ctx) {
+
+  if (ctx->len != 0U) {
+    (void)fwrite(ctx->buf, 1U, ctx->len, stdout);
+    ctx->len = 0U;
+  }
+  if (ctx->lost != 0U) {
+#if (PRINT_XML_REPORT == 1)
+    (void)printf("\n<!-- [WARNING] Report buffer overflow, %u bytes lost -->\n", ctx->lost);
+#else
+    (void)printf("\n[WARNING] Report buffer overflow, %u bytes lost\n", ctx->lost);
+#endif
+    ctx->lost = 0U;
+  }
+}
+#endif
 
 /*-----------------------------------------------------------------------------
  *       SER_MsgFlush:  Flush the standard output
+ *                      (report of a concurrent test group is written
+ *                       at the test group end, or between tests when
+ *                       its buffer is more than half full)
  *----------------------------------------------------------------------------*/
-static void MsgFlush(void) {
+static void MsgFlush(uint32_t group_end) {
+#if (REPORT_BUF_EN != 0)
+  REPORT_CTX *ctx = CtxGet();
+
+  if (group_end == 0U) {
+    if (ctx != &report_ctx[0]) {
+      if ((ctx->len < (DV_REPORT_BUF_SIZE / 2U)) && (ctx->direct == 0U)) {
+        return;                         /* Concurrent test group buffer       */
+      }
+    } else if ((DV_REPORT_BUF_EN != 0) && (DV_REPORT_BUF_DRAIN == 0) && (ctx->direct == 0U)) {
+      return;                           /* Buffer written at test group end   */
+    } else {
+      // Buffer written between tests
+    }
+#if (PRINT_XML_REPORT == 1)
+    if (ctx->direct != 0U) {            /* Buffer overflowed in the test      */
+      tg_End(ctx);
+      (void)fflush(stdout);
+      ReportUnlock();                   /* Locked when the buffer was full    */
+      return;
+    }
+    if ((ctx->len < (DV_REPORT_BUF_SIZE / 2U)) ||
+        (ctx->tg_result.tests == ctx->tg_done.tests)) {
+      return;                           /* Test group part not full yet       */
+    }
+    /* Buffer more than half full: write it as a test group part */
+    ReportLock();
+    tg_Start(ctx, 1U, 0U);
+    tg_End(ctx);
+    BufWrite(ctx);
+    (void)fflush(stdout);
+    ReportUnlock();
+    return;
+#endif
+  }
+  ReportLock();
+  BufWrite(ctx);
+  (void)fflush(stdout);
+  ReportUnlock();
+#if (PRINT_XML_REPORT == 0)
+  if (ctx->direct != 0U) {              /* Locked when the buffer was full    */
+    ctx->direct = 0U;
+    ReportUnlock();
+  }
+#endif
+#else
+  (void)group_end;
   (void)fflush(stdout);
+#endif
+}
+
+/*-----------------------------------------------------------------------------
+ * Abort test report (test run is terminated, for example by a fault handler
+ * or a host signal): write the buffered report output and close the report
+ *----------------------------------------------------------------------------*/
+void __report_abort (void) {
+  REPORT_CTX *ctx;
+  uint32_t    i;
+#if (DV_CONCURRENT_EN != 0)
+  osStatus_t  status;
+
+  status = osError;
+  if ((report_mutex != NULL) && (tr_abort == 0U)) {
+    /* Do not wait long for report output of a hanging thread */
+    status = osMutexAcquire(report_mutex, osKernelGetTickFreq());
+  }
+#endif
+  tr_abort = 1U;                        /* Report is written directly         */
+
+  for (i = 0U; i < REPORT_CTX_NUM; i++) {
+    ctx = &report_ctx[i];
+    if ((tr_open == 0U) || (ctx->tg_open == 0U)) {
+#if (REPORT_BUF_EN != 0)
+      if (ctx->buf != NULL) {
+        BufWrite(ctx);
+      }
+#endif
+      continue;
+    }
+#if (PRINT_XML_REPORT == 1)
+    if (ctx->tc_open != 0U) {           /* Aborted test is reported as failed */
+      ctx->tg_result.tests++;
+      ctx->tg_result.failed++;
+    }
+    if (ctx->tg_pend != 0U) {
+      tg_Start(ctx, 1U, 0U);
+    }
+    if (ctx->tc_open != 0U) {
+      PRINT(("    <testcase name=\"%s\" classname=\"", ctx->tc_fn));
+      XmlPrint(ctx->tg_title);
+      PRINT(("\">\n"));
+      PRINT(("      <failure message=\"Test aborted\"/>\n"));
+      if (ctx->as_detail != 0U) {
+        PRINT(("      <system-out>"));
+        XmlPrint(ctx->tc_detail);
+        PRINT(("</system-out>\n"));
+      }
+      PRINT(("    </testcase>\n"));
+    }
+    PRINT(("  </testsuite>\n"));
+#else
+#if (REPORT_BUF_EN != 0)
+    if (ctx->buf != NULL) {
+      BufWrite(ctx);
+    }
+#endif
+    if (ctx->tc_open != 0U) {
+      PRINT(("ABORTED\n"));
+    }
+#endif
+    ctx->tg_open = 0U;
+    ctx->tc_open = 0U;
+  }
+
+  if (tr_open != 0U) {
+#if (PRINT_XML_REPORT == 1)
+    PRINT(("</testsuites>\n"));
+#else
+    PRINT(("\nTest Run Aborted\n"));
+#endif
+    tr_open = 0U;
+  }
+  (void)fflush(stdout);
+
+#if (DV_CONCURRENT_EN != 0)
+  if (status == osOK) {
+    (void)osMutexRelease(report_mutex);
+  }
+#endif
 }
 
 /*-----------------------------------------------------------------------------
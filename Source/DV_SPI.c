@@ -142,7 +142,15 @@ typedef struct {                // SPI Server capabilities structure
 #define _ARM_Driver_SPI_(n)         Driver_SPI##n
 #define  ARM_Driver_SPI_(n)    _ARM_Driver_SPI_(n)
 extern   ARM_DRIVER_SPI         ARM_Driver_SPI_(DRV_SPI);
+#if   (DV_TRACE_EN  != 0) && (DV_TRACE_SPI != 0)
+extern   ARM_DRIVER_SPI         DV_Trace_Driver_SPI;
+static   ARM_DRIVER_SPI *drv = &DV_Trace_Driver_SPI;
+#elif (DV_INJECT_EN != 0) && (DV_INJECT_SPI != 0)
+extern   ARM_DRIVER_SPI         DV_Inject_Driver_SPI;
+static   ARM_DRIVER_SPI *drv = &DV_Inject_Driver_SPI;
+#else
 static   ARM_DRIVER_SPI *drv = &ARM_Driver_SPI_(DRV_SPI);
+#endif
 
 // Global variables (used in this module only)
 static int8_t                   buffers_ok;
@@ -1119,22 +1127,22 @@ void SPI_DV_Initialize (void) {
   // (maximum size is incremented by 32 bytes to ensure that buffer can be aligned to 32 bytes)
 
   ptr_tx_buf_alloc = malloc(SPI_BUF_MAX + 32U);
-  if (((uint32_t)ptr_tx_buf_alloc & 31U) != 0U) {
+  if (((uintptr_t)ptr_tx_buf_alloc & 31U) != 0U) {
     // If allocated memory is not 32 byte aligned, use next 32 byte aligned address for ptr_tx_buf
-    ptr_tx_buf = (uint8_t *)((((uint32_t)ptr_tx_buf_alloc) + 31U) & (~31U));
+    ptr_tx_buf = (uint8_t *)((((uintptr_t)ptr_tx_buf_alloc) + 31U) & ~(uintptr_t)31U);
   } else {
     // If allocated memory is 32 byte aligned, use it directly
     ptr_tx_buf = (uint8_t *)ptr_tx_buf_alloc;
   }
   ptr_rx_buf_alloc = malloc(SPI_BUF_MAX + 32U);
-  if (((uint32_t)ptr_rx_buf_alloc & 31U) != 0U) {
-    ptr_rx_buf = (uint8_t *)((((uint32_t)ptr_rx_buf_alloc) + 31U) & (~31U));
+  if (((uintptr_t)ptr_rx_buf_alloc & 31U) != 0U) {
+    ptr_rx_buf = (uint8_t *)((((uintptr_t)ptr_rx_buf_alloc) + 31U) & ~(uintptr_t)31U);
   } else {
     ptr_rx_buf = (uint8_t *)ptr_rx_buf_alloc;
   }
   ptr_cmp_buf_alloc = malloc(SPI_BUF_MAX + 32U);
-  if (((uint32_t)ptr_cmp_buf_alloc & 31U) != 0U) {
-    ptr_cmp_buf = (uint8_t *)((((uint32_t)ptr_cmp_buf_alloc) + 31U) & (~31U));
+  if (((uintptr_t)ptr_cmp_buf_alloc & 31U) != 0U) {
+    ptr_cmp_buf = (uint8_t *)((((uintptr_t)ptr_cmp_buf_alloc) + 31U) & ~(uintptr_t)31U);
   } else {
     ptr_cmp_buf = (uint8_t *)ptr_cmp_buf_alloc;
   }
@@ -3653,6 +3661,7 @@ void SPI_Bus_Speed_Min (void) {
   if (duration != 0xFFFFFFFFU) {        // If Transfer finished before timeout
     if (duration != 0U) {               // If duration of transfer was more than 0 SysTick counts
       bps = ((uint64_t)systick_freq * SPI_CFG_DEF_DATA_BITS * SPI_CFG_DEF_NUM) / duration;
+      TEST_MEASUREMENT("Effective bus speed", (uint32_t)bps, "bps");
       if ((bps < ((SPI_CFG_MIN_BUS_SPEED * 3) / 4)) ||
           (bps >   SPI_CFG_MIN_BUS_SPEED)) {
         // If measured bus speed is 25% lower, or higher than requested
@@ -3717,6 +3726,7 @@ void SPI_Bus_Speed_Max (void) {
   if (duration != 0xFFFFFFFFU) {        // If Transfer finished before timeout
     if (duration != 0U) {               // If duration of transfer was more than 0 SysTick counts
       bps = ((uint64_t)systick_freq * SPI_CFG_DEF_DATA_BITS * SPI_CFG_DEF_NUM) / duration;
+      TEST_MEASUREMENT("Effective bus speed", (uint32_t)bps, "bps");
       if ((bps < ((SPI_CFG_MAX_BUS_SPEED * 3) / 4)) ||
           (bps >   SPI_CFG_MAX_BUS_SPEED)) {
         // If measured bus speed is 25% lower, or higher than requested
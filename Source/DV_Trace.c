@@ -0,0 +1,1151 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-Driver Validation
+ * Title:       Driver API trace
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+
+#include "cmsis_dv.h"
+#include "DV_Config.h"
+#include "DV_Framework.h"
+
+#if (DV_TRACE_EN != 0)
+
+#if ((DV_TRACE_NUM & (DV_TRACE_NUM - 1)) != 0)
+#error "DV_TRACE_NUM must be a power of 2!"
+#endif
+
+#if defined(RTE_CMSIS_DV_SPI) && (DV_TRACE_SPI != 0)
+#define TRC_SPI         1
+#include "DV_SPI_Config.h"
+#include "Driver_SPI.h"
+#else
+#define TRC_SPI         0
+#endif
+#if defined(RTE_CMSIS_DV_USART) && (DV_TRACE_USART != 0)
+#define TRC_USART       1
+#include "DV_USART_Config.h"
+#include "Driver_USART.h"
+#else
+#define TRC_USART       0
+#endif
+#if defined(RTE_CMSIS_DV_ETH) && (DV_TRACE_ETH != 0)
+#define TRC_ETH         1
+#include "DV_ETH_Config.h"
+#include "Driver_ETH_MAC.h"
+#else
+#define TRC_ETH         0
+#endif
+#if defined(RTE_CMSIS_DV_CAN) && (DV_TRACE_CAN != 0)
+#define TRC_CAN         1
+#include "DV_CAN_Config.h"
+#include "Driver_CAN.h"
+#else
+#define TRC_CAN         0
+#endif
+#if defined(RTE_CMSIS_DV_WIFI) && (DV_TRACE_WIFI != 0)
+#define TRC_WIFI        1
+#include "DV_WiFi_Config.h"
+#include "Driver_WiFi.h"
+#else
+#define TRC_WIFI        0
+#endif
+
+/* Trace record types */
+#define TRC_ENTRY       1U              /* Driver function entry (arg: main argument)     */
+#define TRC_EXIT        2U              /* Driver function exit  (arg: return value)      */
+#define TRC_EVENT       3U              /* Signaled event        (arg: event)             */
+#define TRC_TEST_START  4U              /* Traced test start     (aux: test name index)   */
+#define TRC_TEST_END    5U              /* Traced test end       (aux: test name index)   */
+
+/* Trace record id: driver (high byte) and function index in the driver access struct (low byte) */
+#define TRC_DRV_SPI     1U
+#define TRC_DRV_USART   2U
+#define TRC_DRV_ETH     3U
+#define TRC_DRV_CAN     4U
+#define TRC_DRV_WIFI    5U
+#define TRC_ID(drv,fn)  (uint16_t)(((drv) << 8) | (fn))
+#define TRC_FN_EVENT    0xFFU           /* Event (CAN: object event)          */
+#define TRC_FN_UNIT     0xFEU           /* CAN unit event                     */
+
+#define TRC_MAGIC       0x52545644U     /* "DVTR"                             */
+#define TRC_VERSION     1U
+#define TRC_NAME_NUM    8U              /* Number of test names               */
+#define TRC_NAME_LEN    32U             /* Length of a test name (incl. '\0') */
+
+/* Trace record (16 bytes) */
+typedef struct {
+  uint32_t time;                        /* System timer count                 */
+  uint32_t arg;                         /* Argument, return value or event    */
+  uint32_t thread;                      /* Calling thread id (0 = event)      */
+  uint16_t id;                          /* Driver and function index          */
+  uint8_t  type;                        /* Record type                        */
+  uint8_t  aux;                         /* Socket, CAN object or name index   */
+} TRC_REC;
+
+/* Trace ring (the dump starts with the header, all fields are little-endian on Cortex-M) */
+typedef struct {
+  uint32_t magic;                       /* TRC_MAGIC                          */
+  uint16_t version;                     /* Format version                     */
+  uint16_t rec_size;                    /* Size of a record                   */
+  uint32_t rec_num;                     /* Number of records in the ring      */
+  uint32_t freq;                        /* System timer frequency [Hz]        */
+  uint32_t idx;                         /* Number of recorded records         */
+  uint16_t name_num;                    /* Number of test names               */
+  uint16_t name_len;                    /* Length of a test name              */
+  uint32_t reserved[2];
+  char     name[TRC_NAME_NUM][TRC_NAME_LEN];  /* Names of traced tests        */
+  TRC_REC  rec[DV_TRACE_NUM];           /* Records (index modulo rec_num)     */
+} TRC_RING;
+
+TRC_RING DV_Trace = {
+  TRC_MAGIC, TRC_VERSION, sizeof(TRC_REC), DV_TRACE_NUM, 0U, 0U, TRC_NAME_NUM, TRC_NAME_LEN
+};
+
+static volatile uint32_t trc_on;        /* Recording active (traced test)     */
+static          uint32_t trc_test;      /* Number of traced tests             */
+
+#if (TRC_SPI != 0)
+#if (DV_INJECT_EN != 0) && (DV_INJECT_SPI != 0)
+extern ARM_DRIVER_SPI          DV_Inject_Driver_SPI;
+static ARM_DRIVER_SPI         *spi_drv = &DV_Inject_Driver_SPI;
+#else
+#define _ARM_Driver_SPI_(n)    Driver_SPI##n
+#define  ARM_Driver_SPI_(n)    _ARM_Driver_SPI_(n)
+extern   ARM_DRIVER_SPI        ARM_Driver_SPI_(DRV_SPI);
+static   ARM_DRIVER_SPI       *spi_drv = &ARM_Driver_SPI_(DRV_SPI);
+#endif
+static ARM_SPI_SignalEvent_t   spi_cb_event;
+#endif
+
+#if (TRC_USART != 0)
+#if (DV_INJECT_EN != 0) && (DV_INJECT_USART != 0)
+extern ARM_DRIVER_USART        DV_Inject_Driver_USART;
+static ARM_DRIVER_USART       *usart_drv = &DV_Inject_Driver_USART;
+#else
+#define _ARM_Driver_USART_(n)  Driver_USART##n
+#define  ARM_Driver_USART_(n)  _ARM_Driver_USART_(n)
+extern   ARM_DRIVER_USART      ARM_Driver_USART_(DRV_USART);
+static   ARM_DRIVER_USART     *usart_drv = &ARM_Driver_USART_(DRV_USART);
+#endif
+static ARM_USART_SignalEvent_t usart_cb_event;
+#endif
+
+#if (TRC_ETH != 0)
+#if (DV_INJECT_EN != 0) && (DV_INJECT_ETH != 0)
+extern ARM_DRIVER_ETH_MAC      DV_Inject_Driver_ETH_MAC;
+static ARM_DRIVER_ETH_MAC     *eth_drv = &DV_Inject_Driver_ETH_MAC;
+#else
+extern ARM_DRIVER_ETH_MAC      CREATE_SYMBOL(Driver_ETH_MAC, DRV_ETH);
+static ARM_DRIVER_ETH_MAC     *eth_drv = &CREATE_SYMBOL(Driver_ETH_MAC, DRV_ETH);
+#endif
+static ARM_ETH_MAC_SignalEvent_t eth_cb_event;
+#endif
+
+#if (TRC_CAN != 0)
+#if (DV_INJECT_EN != 0) && (DV_INJECT_CAN != 0)
+extern ARM_DRIVER_CAN          DV_Inject_Driver_CAN;
+static ARM_DRIVER_CAN         *can_drv = &DV_Inject_Driver_CAN;
+#else
+extern ARM_DRIVER_CAN          CREATE_SYMBOL(Driver_CAN, DRV_CAN);
+static ARM_DRIVER_CAN         *can_drv = &CREATE_SYMBOL(Driver_CAN, DRV_CAN);
+#endif
+static ARM_CAN_SignalUnitEvent_t   can_cb_unit_event;
+static ARM_CAN_SignalObjectEvent_t can_cb_object_event;
+#endif
+
+#if (TRC_WIFI != 0)
+#if (DV_INJECT_EN != 0) && (DV_INJECT_WIFI != 0)
+extern ARM_DRIVER_WIFI         DV_Inject_Driver_WiFi;
+static ARM_DRIVER_WIFI        *wifi_drv = &DV_Inject_Driver_WiFi;
+#else
+extern ARM_DRIVER_WIFI         ARM_Driver_WiFi_(DRV_WIFI);
+static ARM_DRIVER_WIFI        *wifi_drv = &ARM_Driver_WiFi_(DRV_WIFI);
+#endif
+static ARM_WIFI_SignalEvent_t  wifi_cb_event;
+#endif
+
+/*
+  \fn            static uint32_t TraceAlloc (void)
+  \brief         Allocate a record in the trace ring (lock-free, callable from thread and interrupt).
+  \return        record index
+*/
+static uint32_t TraceAlloc (void) {
+#if defined(__ARM_ARCH_6M__)
+  uint32_t primask, idx;
+
+  primask = __get_PRIMASK();            /* No exclusive access on ARMv6-M     */
+  __disable_irq();
+  idx = DV_Trace.idx++;
+  __set_PRIMASK(primask);
+  return (idx);
+#else
+  return (__atomic_fetch_add(&DV_Trace.idx, 1U, __ATOMIC_RELAXED));
+#endif
+}
+
+/*
+  \fn            static void TraceRec (uint8_t type, uint16_t id, uint8_t aux, uint32_t arg, uint32_t thread)
+  \brief         Write a trace record (oldest record is overwritten when the ring is full).
+  \param[in]     type   record type
+  \param[in]     id     driver and function index
+  \param[in]     aux    auxiliary information
+  \param[in]     arg    argument, return value or event
+  \param[in]     thread calling thread id
+  \return        none
+*/
+static void TraceRec (uint8_t type, uint16_t id, uint8_t aux, uint32_t arg, uint32_t thread) {
+  TRC_REC *rec;
+  uint32_t time;
+
+  time = GET_SYSTIMER();
+  rec  = &DV_Trace.rec[TraceAlloc() & (DV_TRACE_NUM - 1U)];
+  rec->time   = time;
+  rec->arg    = arg;
+  rec->thread = thread;
+  rec->id     = id;
+  rec->type   = type;
+  rec->aux    = aux;
+}
+
+/*
+  \fn            static uint32_t TraceEnter (uint16_t id, uint8_t aux, uint32_t arg)
+  \brief         Record driver function entry.
+  \param[in]     id     driver and function index
+  \param[in]     aux    auxiliary information (socket)
+  \param[in]     arg    main function argument
+  \return        calling thread id (for the exit record)
+*/
+static uint32_t TraceEnter (uint16_t id, uint8_t aux, uint32_t arg) {
+  uint32_t thread;
+
+  if (trc_on == 0U) {
+    return (0U);
+  }
+  thread = (uint32_t)(uintptr_t)osThreadGetId();
+  TraceRec(TRC_ENTRY, id, aux, arg, thread);
+  return (thread);
+}
+
+/*
+  \fn            static void TraceExit (uint16_t id, uint32_t thread, uint32_t rval)
+  \brief         Record driver function exit.
+  \param[in]     id     driver and function index
+  \param[in]     thread calling thread id (returned by TraceEnter)
+  \param[in]     rval   return value
+  \return        none
+*/
+static void TraceExit (uint16_t id, uint32_t thread, uint32_t rval) {
+  if ((trc_on == 0U) || (thread == 0U)) {
+    return;
+  }
+  TraceRec(TRC_EXIT, id, 0U, rval, thread);
+}
+
+/*
+  \fn            static void TraceEvent (uint16_t id, uint8_t aux, uint32_t event)
+  \brief         Record signaled event.
+  \param[in]     id     driver and event type
+  \param[in]     aux    auxiliary information (CAN object)
+  \param[in]     event  event
+  \return        none
+*/
+static void TraceEvent (uint16_t id, uint8_t aux, uint32_t event) {
+  if (trc_on == 0U) {
+    return;
+  }
+  TraceRec(TRC_EVENT, id, aux, event, 0U);
+}
+
+/*
+  \fn            static uint32_t TraceStatus (const volatile void *status, uint32_t size)
+  \brief         Get status or capabilities structure as return value (first 4 bytes).
+  \param[in]     status pointer to structure
+  \param[in]     size   size of structure
+  \return        structure bits
+*/
+static uint32_t TraceStatus (const volatile void *status, uint32_t size) {
+  const volatile uint8_t *ptr = (const volatile uint8_t *)status;
+  uint32_t                val, i;
+
+  val = 0U;
+  for (i = 0U; (i < size) && (i < 4U); i++) {
+    val |= (uint32_t)ptr[i] << (i * 8U);
+  }
+  return (val);
+}
+
+/*
+  \fn            void __trace_start (const char *name)
+  \brief         Start recording of a traced test.
+  \param[in]     name   test function name
+  \return        none
+*/
+void __trace_start (const char *name) {
+  uint32_t n;
+
+  n = trc_test++ % TRC_NAME_NUM;
+  strncpy(DV_Trace.name[n], name, TRC_NAME_LEN - 1U);
+  DV_Trace.name[n][TRC_NAME_LEN - 1U] = '\0';
+  DV_Trace.freq = osKernelGetSysTimerFreq();
+
+  TraceRec(TRC_TEST_START, 0U, (uint8_t)n, 0U, 0U);
+  trc_on = 1U;
+}
+
+/*
+  \fn            void __trace_done (void)
+  \brief         Stop recording at the end of a test.
+  \return        none
+*/
+void __trace_done (void) {
+  if (trc_on == 0U) {
+    return;
+  }
+  trc_on = 0U;
+  TraceRec(TRC_TEST_END, 0U, (uint8_t)((trc_test - 1U) % TRC_NAME_NUM), 0U, 0U);
+}
+
+/*
+  \fn            uint32_t __trace_dump (const void **data)
+  \brief         Get the trace ring (for a dump to a file).
+  \param[out]    data   pointer to trace ring
+  \return        size of the trace ring in bytes
+*/
+uint32_t __trace_dump (const void **data) {
+  *data = &DV_Trace;
+  return (sizeof(DV_Trace));
+}
+
+#if (TRC_SPI != 0)
+/*-----------------------------------------------------------------------------
+ *      SPI trace
+ *----------------------------------------------------------------------------*/
+#define SPI_ID(fn)      TRC_ID(TRC_DRV_SPI, fn)
+
+static void SPI_TrcEvent (uint32_t event) {
+  TraceEvent(SPI_ID(TRC_FN_EVENT), 0U, event);
+  spi_cb_event(event);
+}
+
+static ARM_DRIVER_VERSION SPI_TrcGetVersion (void) {
+  uint32_t           th = TraceEnter(SPI_ID(0U), 0U, 0U);
+  ARM_DRIVER_VERSION rv = spi_drv->GetVersion();
+  TraceExit(SPI_ID(0U), th, rv.drv);
+  return (rv);
+}
+
+static ARM_SPI_CAPABILITIES SPI_TrcGetCapabilities (void) {
+  uint32_t             th = TraceEnter(SPI_ID(1U), 0U, 0U);
+  ARM_SPI_CAPABILITIES rv = spi_drv->GetCapabilities();
+  TraceExit(SPI_ID(1U), th, TraceStatus(&rv, sizeof(rv)));
+  return (rv);
+}
+
+static int32_t SPI_TrcInitialize (ARM_SPI_SignalEvent_t cb_event) {
+  uint32_t th = TraceEnter(SPI_ID(2U), 0U, 0U);
+  int32_t  rv;
+  spi_cb_event = cb_event;
+  rv = spi_drv->Initialize((cb_event != NULL) ? SPI_TrcEvent : NULL);
+  TraceExit(SPI_ID(2U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t SPI_TrcUninitialize (void) {
+  uint32_t th = TraceEnter(SPI_ID(3U), 0U, 0U);
+  int32_t  rv = spi_drv->Uninitialize();
+  TraceExit(SPI_ID(3U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t SPI_TrcPowerControl (ARM_POWER_STATE state) {
+  uint32_t th = TraceEnter(SPI_ID(4U), 0U, (uint32_t)state);
+  int32_t  rv = spi_drv->PowerControl(state);
+  TraceExit(SPI_ID(4U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t SPI_TrcSend (const void *data, uint32_t num) {
+  uint32_t th = TraceEnter(SPI_ID(5U), 0U, num);
+  int32_t  rv = spi_drv->Send(data, num);
+  TraceExit(SPI_ID(5U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t SPI_TrcReceive (void *data, uint32_t num) {
+  uint32_t th = TraceEnter(SPI_ID(6U), 0U, num);
+  int32_t  rv = spi_drv->Receive(data, num);
+  TraceExit(SPI_ID(6U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t SPI_TrcTransfer (const void *data_out, void *data_in, uint32_t num) {
+  uint32_t th = TraceEnter(SPI_ID(7U), 0U, num);
+  int32_t  rv = spi_drv->Transfer(data_out, data_in, num);
+  TraceExit(SPI_ID(7U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static uint32_t SPI_TrcGetDataCount (void) {
+  uint32_t th = TraceEnter(SPI_ID(8U), 0U, 0U);
+  uint32_t rv = spi_drv->GetDataCount();
+  TraceExit(SPI_ID(8U), th, rv);
+  return (rv);
+}
+
+static int32_t SPI_TrcControl (uint32_t control, uint32_t arg) {
+  uint32_t th = TraceEnter(SPI_ID(9U), 0U, control);
+  int32_t  rv = spi_drv->Control(control, arg);
+  TraceExit(SPI_ID(9U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static ARM_SPI_STATUS SPI_TrcGetStatus (void) {
+  uint32_t       th = TraceEnter(SPI_ID(10U), 0U, 0U);
+  ARM_SPI_STATUS rv = spi_drv->GetStatus();
+  TraceExit(SPI_ID(10U), th, TraceStatus(&rv, sizeof(rv)));
+  return (rv);
+}
+
+ARM_DRIVER_SPI DV_Trace_Driver_SPI = {
+  SPI_TrcGetVersion,
+  SPI_TrcGetCapabilities,
+  SPI_TrcInitialize,
+  SPI_TrcUninitialize,
+  SPI_TrcPowerControl,
+  SPI_TrcSend,
+  SPI_TrcReceive,
+  SPI_TrcTransfer,
+  SPI_TrcGetDataCount,
+  SPI_TrcControl,
+  SPI_TrcGetStatus
+};
+#endif
+
+#if (TRC_USART != 0)
+/*-----------------------------------------------------------------------------
+ *      USART trace
+ *----------------------------------------------------------------------------*/
+#define USART_ID(fn)    TRC_ID(TRC_DRV_USART, fn)
+
+static void USART_TrcEvent (uint32_t event) {
+  TraceEvent(USART_ID(TRC_FN_EVENT), 0U, event);
+  usart_cb_event(event);
+}
+
+static ARM_DRIVER_VERSION USART_TrcGetVersion (void) {
+  uint32_t           th = TraceEnter(USART_ID(0U), 0U, 0U);
+  ARM_DRIVER_VERSION rv = usart_drv->GetVersion();
+  TraceExit(USART_ID(0U), th, rv.drv);
+  return (rv);
+}
+
+static ARM_USART_CAPABILITIES USART_TrcGetCapabilities (void) {
+  uint32_t               th = TraceEnter(USART_ID(1U), 0U, 0U);
+  ARM_USART_CAPABILITIES rv = usart_drv->GetCapabilities();
+  TraceExit(USART_ID(1U), th, TraceStatus(&rv, sizeof(rv)));
+  return (rv);
+}
+
+static int32_t USART_TrcInitialize (ARM_USART_SignalEvent_t cb_event) {
+  uint32_t th = TraceEnter(USART_ID(2U), 0U, 0U);
+  int32_t  rv;
+  usart_cb_event = cb_event;
+  rv = usart_drv->Initialize((cb_event != NULL) ? USART_TrcEvent : NULL);
+  TraceExit(USART_ID(2U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t USART_TrcUninitialize (void) {
+  uint32_t th = TraceEnter(USART_ID(3U), 0U, 0U);
+  int32_t  rv = usart_drv->Uninitialize();
+  TraceExit(USART_ID(3U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t USART_TrcPowerControl (ARM_POWER_STATE state) {
+  uint32_t th = TraceEnter(USART_ID(4U), 0U, (uint32_t)state);
+  int32_t  rv = usart_drv->PowerControl(state);
+  TraceExit(USART_ID(4U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t USART_TrcSend (const void *data, uint32_t num) {
+  uint32_t th = TraceEnter(USART_ID(5U), 0U, num);
+  int32_t  rv = usart_drv->Send(data, num);
+  TraceExit(USART_ID(5U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t USART_TrcReceive (void *data, uint32_t num) {
+  uint32_t th = TraceEnter(USART_ID(6U), 0U, num);
+  int32_t  rv = usart_drv->Receive(data, num);
+  TraceExit(USART_ID(6U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t USART_TrcTransfer (const void *data_out, void *data_in, uint32_t num) {
+  uint32_t th = TraceEnter(USART_ID(7U), 0U, num);
+  int32_t  rv = usart_drv->Transfer(data_out, data_in, num);
+  TraceExit(USART_ID(7U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static uint32_t USART_TrcGetTxCount (void) {
+  uint32_t th = TraceEnter(USART_ID(8U), 0U, 0U);
+  uint32_t rv = usart_drv->GetTxCount();
+  TraceExit(USART_ID(8U), th, rv);
+  return (rv);
+}
+
+static uint32_t USART_TrcGetRxCount (void) {
+  uint32_t th = TraceEnter(USART_ID(9U), 0U, 0U);
+  uint32_t rv = usart_drv->GetRxCount();
+  TraceExit(USART_ID(9U), th, rv);
+  return (rv);
+}
+
+static int32_t USART_TrcControl (uint32_t control, uint32_t arg) {
+  uint32_t th = TraceEnter(USART_ID(10U), 0U, control);
+  int32_t  rv = usart_drv->Control(control, arg);
+  TraceExit(USART_ID(10U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static ARM_USART_STATUS USART_TrcGetStatus (void) {
+  uint32_t         th = TraceEnter(USART_ID(11U), 0U, 0U);
+  ARM_USART_STATUS rv = usart_drv->GetStatus();
+  TraceExit(USART_ID(11U), th, TraceStatus(&rv, sizeof(rv)));
+  return (rv);
+}
+
+static int32_t USART_TrcSetModemControl (ARM_USART_MODEM_CONTROL control) {
+  uint32_t th = TraceEnter(USART_ID(12U), 0U, (uint32_t)control);
+  int32_t  rv = usart_drv->SetModemControl(control);
+  TraceExit(USART_ID(12U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static ARM_USART_MODEM_STATUS USART_TrcGetModemStatus (void) {
+  uint32_t               th = TraceEnter(USART_ID(13U), 0U, 0U);
+  ARM_USART_MODEM_STATUS rv = usart_drv->GetModemStatus();
+  TraceExit(USART_ID(13U), th, TraceStatus(&rv, sizeof(rv)));
+  return (rv);
+}
+
+ARM_DRIVER_USART DV_Trace_Driver_USART = {
+  USART_TrcGetVersion,
+  USART_TrcGetCapabilities,
+  USART_TrcInitialize,
+  USART_TrcUninitialize,
+  USART_TrcPowerControl,
+  USART_TrcSend,
+  USART_TrcReceive,
+  USART_TrcTransfer,
+  USART_TrcGetTxCount,
+  USART_TrcGetRxCount,
+  USART_TrcControl,
+  USART_TrcGetStatus,
+  USART_TrcSetModemControl,
+  USART_TrcGetModemStatus
+};
+#endif
+
+#if (TRC_ETH != 0)
+/*-----------------------------------------------------------------------------
+ *      ETH_MAC trace
+ *----------------------------------------------------------------------------*/
+#define ETH_ID(fn)      TRC_ID(TRC_DRV_ETH, fn)
+
+static void ETH_TrcEvent (uint32_t event) {
+  TraceEvent(ETH_ID(TRC_FN_EVENT), 0U, event);
+  eth_cb_event(event);
+}
+
+static ARM_DRIVER_VERSION ETH_TrcGetVersion (void) {
+  uint32_t           th = TraceEnter(ETH_ID(0U), 0U, 0U);
+  ARM_DRIVER_VERSION rv = eth_drv->GetVersion();
+  TraceExit(ETH_ID(0U), th, rv.drv);
+  return (rv);
+}
+
+static ARM_ETH_MAC_CAPABILITIES ETH_TrcGetCapabilities (void) {
+  uint32_t                 th = TraceEnter(ETH_ID(1U), 0U, 0U);
+  ARM_ETH_MAC_CAPABILITIES rv = eth_drv->GetCapabilities();
+  TraceExit(ETH_ID(1U), th, TraceStatus(&rv, sizeof(rv)));
+  return (rv);
+}
+
+static int32_t ETH_TrcInitialize (ARM_ETH_MAC_SignalEvent_t cb_event) {
+  uint32_t th = TraceEnter(ETH_ID(2U), 0U, 0U);
+  int32_t  rv;
+  eth_cb_event = cb_event;
+  rv = eth_drv->Initialize((cb_event != NULL) ? ETH_TrcEvent : NULL);
+  TraceExit(ETH_ID(2U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t ETH_TrcUninitialize (void) {
+  uint32_t th = TraceEnter(ETH_ID(3U), 0U, 0U);
+  int32_t  rv = eth_drv->Uninitialize();
+  TraceExit(ETH_ID(3U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t ETH_TrcPowerControl (ARM_POWER_STATE state) {
+  uint32_t th = TraceEnter(ETH_ID(4U), 0U, (uint32_t)state);
+  int32_t  rv = eth_drv->PowerControl(state);
+  TraceExit(ETH_ID(4U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t ETH_TrcGetMacAddress (ARM_ETH_MAC_ADDR *ptr_addr) {
+  uint32_t th = TraceEnter(ETH_ID(5U), 0U, 0U);
+  int32_t  rv = eth_drv->GetMacAddress(ptr_addr);
+  TraceExit(ETH_ID(5U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t ETH_TrcSetMacAddress (const ARM_ETH_MAC_ADDR *ptr_addr) {
+  uint32_t th = TraceEnter(ETH_ID(6U), 0U, 0U);
+  int32_t  rv = eth_drv->SetMacAddress(ptr_addr);
+  TraceExit(ETH_ID(6U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t ETH_TrcSetAddressFilter (const ARM_ETH_MAC_ADDR *ptr_addr, uint32_t num_addr) {
+  uint32_t th = TraceEnter(ETH_ID(7U), 0U, num_addr);
+  int32_t  rv = eth_drv->SetAddressFilter(ptr_addr, num_addr);
+  TraceExit(ETH_ID(7U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t ETH_TrcSendFrame (const uint8_t *frame, uint32_t len, uint32_t flags) {
+  uint32_t th = TraceEnter(ETH_ID(8U), 0U, len);
+  int32_t  rv = eth_drv->SendFrame(frame, len, flags);
+  TraceExit(ETH_ID(8U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t ETH_TrcReadFrame (uint8_t *frame, uint32_t len) {
+  uint32_t th = TraceEnter(ETH_ID(9U), 0U, len);
+  int32_t  rv = eth_drv->ReadFrame(frame, len);
+  TraceExit(ETH_ID(9U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static uint32_t ETH_TrcGetRxFrameSize (void) {
+  uint32_t th = TraceEnter(ETH_ID(10U), 0U, 0U);
+  uint32_t rv = eth_drv->GetRxFrameSize();
+  TraceExit(ETH_ID(10U), th, rv);
+  return (rv);
+}
+
+static int32_t ETH_TrcGetRxFrameTime (ARM_ETH_MAC_TIME *time) {
+  uint32_t th = TraceEnter(ETH_ID(11U), 0U, 0U);
+  int32_t  rv = eth_drv->GetRxFrameTime(time);
+  TraceExit(ETH_ID(11U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t ETH_TrcGetTxFrameTime (ARM_ETH_MAC_TIME *time) {
+  uint32_t th = TraceEnter(ETH_ID(12U), 0U, 0U);
+  int32_t  rv = eth_drv->GetTxFrameTime(time);
+  TraceExit(ETH_ID(12U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t ETH_TrcControlTimer (uint32_t control, ARM_ETH_MAC_TIME *time) {
+  uint32_t th = TraceEnter(ETH_ID(13U), 0U, control);
+  int32_t  rv = eth_drv->ControlTimer(control, time);
+  TraceExit(ETH_ID(13U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t ETH_TrcControl (uint32_t control, uint32_t arg) {
+  uint32_t th = TraceEnter(ETH_ID(14U), 0U, control);
+  int32_t  rv = eth_drv->Control(control, arg);
+  TraceExit(ETH_ID(14U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t ETH_TrcPHY_Read (uint8_t phy_addr, uint8_t reg_addr, uint16_t *data) {
+  uint32_t th = TraceEnter(ETH_ID(15U), phy_addr, reg_addr);
+  int32_t  rv = eth_drv->PHY_Read(phy_addr, reg_addr, data);
+  TraceExit(ETH_ID(15U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t ETH_TrcPHY_Write (uint8_t phy_addr, uint8_t reg_addr, uint16_t data) {
+  uint32_t th = TraceEnter(ETH_ID(16U), phy_addr, reg_addr);
+  int32_t  rv = eth_drv->PHY_Write(phy_addr, reg_addr, data);
+  TraceExit(ETH_ID(16U), th, (uint32_t)rv);
+  return (rv);
+}
+
+ARM_DRIVER_ETH_MAC DV_Trace_Driver_ETH_MAC = {
+  ETH_TrcGetVersion,
+  ETH_TrcGetCapabilities,
+  ETH_TrcInitialize,
+  ETH_TrcUninitialize,
+  ETH_TrcPowerControl,
+  ETH_TrcGetMacAddress,
+  ETH_TrcSetMacAddress,
+  ETH_TrcSetAddressFilter,
+  ETH_TrcSendFrame,
+  ETH_TrcReadFrame,
+  ETH_TrcGetRxFrameSize,
+  ETH_TrcGetRxFrameTime,
+  ETH_TrcGetTxFrameTime,
+  ETH_TrcControlTimer,
+  ETH_TrcControl,
+  ETH_TrcPHY_Read,
+  ETH_TrcPHY_Write
+};
+#endif
+
+#if (TRC_CAN != 0)
+/*-----------------------------------------------------------------------------
+ *      CAN trace
+ *----------------------------------------------------------------------------*/
+#define CAN_ID(fn)      TRC_ID(TRC_DRV_CAN, fn)
+
+static void CAN_TrcUnitEvent (uint32_t event) {
+  TraceEvent(CAN_ID(TRC_FN_UNIT), 0U, event);
+  can_cb_unit_event(event);
+}
+
+static void CAN_TrcObjectEvent (uint32_t obj_idx, uint32_t event) {
+  TraceEvent(CAN_ID(TRC_FN_EVENT), (uint8_t)obj_idx, event);
+  can_cb_object_event(obj_idx, event);
+}
+
+static ARM_DRIVER_VERSION CAN_TrcGetVersion (void) {
+  uint32_t           th = TraceEnter(CAN_ID(0U), 0U, 0U);
+  ARM_DRIVER_VERSION rv = can_drv->GetVersion();
+  TraceExit(CAN_ID(0U), th, rv.drv);
+  return (rv);
+}
+
+static ARM_CAN_CAPABILITIES CAN_TrcGetCapabilities (void) {
+  uint32_t             th = TraceEnter(CAN_ID(1U), 0U, 0U);
+  ARM_CAN_CAPABILITIES rv = can_drv->GetCapabilities();
+  TraceExit(CAN_ID(1U), th, TraceStatus(&rv, sizeof(rv)));
+  return (rv);
+}
+
+static int32_t CAN_TrcInitialize (ARM_CAN_SignalUnitEvent_t cb_unit_event, ARM_CAN_SignalObjectEvent_t cb_object_event) {
+  uint32_t th = TraceEnter(CAN_ID(2U), 0U, 0U);
+  int32_t  rv;
+  can_cb_unit_event   = cb_unit_event;
+  can_cb_object_event = cb_object_event;
+  rv = can_drv->Initialize((cb_unit_event   != NULL) ? CAN_TrcUnitEvent   : NULL,
+                           (cb_object_event != NULL) ? CAN_TrcObjectEvent : NULL);
+  TraceExit(CAN_ID(2U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t CAN_TrcUninitialize (void) {
+  uint32_t th = TraceEnter(CAN_ID(3U), 0U, 0U);
+  int32_t  rv = can_drv->Uninitialize();
+  TraceExit(CAN_ID(3U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t CAN_TrcPowerControl (ARM_POWER_STATE state) {
+  uint32_t th = TraceEnter(CAN_ID(4U), 0U, (uint32_t)state);
+  int32_t  rv = can_drv->PowerControl(state);
+  TraceExit(CAN_ID(4U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static uint32_t CAN_TrcGetClock (void) {
+  uint32_t th = TraceEnter(CAN_ID(5U), 0U, 0U);
+  uint32_t rv = can_drv->GetClock();
+  TraceExit(CAN_ID(5U), th, rv);
+  return (rv);
+}
+
+static int32_t CAN_TrcSetBitrate (ARM_CAN_BITRATE_SELECT select, uint32_t bitrate, uint32_t bit_segments) {
+  uint32_t th = TraceEnter(CAN_ID(6U), (uint8_t)select, bitrate);
+  int32_t  rv = can_drv->SetBitrate(select, bitrate, bit_segments);
+  TraceExit(CAN_ID(6U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t CAN_TrcSetMode (ARM_CAN_MODE mode) {
+  uint32_t th = TraceEnter(CAN_ID(7U), 0U, (uint32_t)mode);
+  int32_t  rv = can_drv->SetMode(mode);
+  TraceExit(CAN_ID(7U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static ARM_CAN_OBJ_CAPABILITIES CAN_TrcObjectGetCapabilities (uint32_t obj_idx) {
+  uint32_t                 th = TraceEnter(CAN_ID(8U), (uint8_t)obj_idx, obj_idx);
+  ARM_CAN_OBJ_CAPABILITIES rv = can_drv->ObjectGetCapabilities(obj_idx);
+  TraceExit(CAN_ID(8U), th, TraceStatus(&rv, sizeof(rv)));
+  return (rv);
+}
+
+static int32_t CAN_TrcObjectSetFilter (uint32_t obj_idx, ARM_CAN_FILTER_OPERATION operation, uint32_t id, uint32_t arg) {
+  uint32_t th = TraceEnter(CAN_ID(9U), (uint8_t)obj_idx, id);
+  int32_t  rv = can_drv->ObjectSetFilter(obj_idx, operation, id, arg);
+  TraceExit(CAN_ID(9U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t CAN_TrcObjectConfigure (uint32_t obj_idx, ARM_CAN_OBJ_CONFIG obj_cfg) {
+  uint32_t th = TraceEnter(CAN_ID(10U), (uint8_t)obj_idx, (uint32_t)obj_cfg);
+  int32_t  rv = can_drv->ObjectConfigure(obj_idx, obj_cfg);
+  TraceExit(CAN_ID(10U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t CAN_TrcMessageSend (uint32_t obj_idx, ARM_CAN_MSG_INFO *msg_info, const uint8_t *data, uint8_t size) {
+  uint32_t th = TraceEnter(CAN_ID(11U), (uint8_t)obj_idx, size);
+  int32_t  rv = can_drv->MessageSend(obj_idx, msg_info, data, size);
+  TraceExit(CAN_ID(11U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t CAN_TrcMessageRead (uint32_t obj_idx, ARM_CAN_MSG_INFO *msg_info, uint8_t *data, uint8_t size) {
+  uint32_t th = TraceEnter(CAN_ID(12U), (uint8_t)obj_idx, size);
+  int32_t  rv = can_drv->MessageRead(obj_idx, msg_info, data, size);
+  TraceExit(CAN_ID(12U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t CAN_TrcControl (uint32_t control, uint32_t arg) {
+  uint32_t th = TraceEnter(CAN_ID(13U), 0U, control);
+  int32_t  rv = can_drv->Control(control, arg);
+  TraceExit(CAN_ID(13U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static ARM_CAN_STATUS CAN_TrcGetStatus (void) {
+  uint32_t       th = TraceEnter(CAN_ID(14U), 0U, 0U);
+  ARM_CAN_STATUS rv = can_drv->GetStatus();
+  TraceExit(CAN_ID(14U), th, TraceStatus(&rv, sizeof(rv)));
+  return (rv);
+}
+
+ARM_DRIVER_CAN DV_Trace_Driver_CAN = {
+  CAN_TrcGetVersion,
+  CAN_TrcGetCapabilities,
+  CAN_TrcInitialize,
+  CAN_TrcUninitialize,
+  CAN_TrcPowerControl,
+  CAN_TrcGetClock,
+  CAN_TrcSetBitrate,
+  CAN_TrcSetMode,
+  CAN_TrcObjectGetCapabilities,
+  CAN_TrcObjectSetFilter,
+  CAN_TrcObjectConfigure,
+  CAN_TrcMessageSend,
+  CAN_TrcMessageRead,
+  CAN_TrcControl,
+  CAN_TrcGetStatus
+};
+#endif
+
+#if (TRC_WIFI != 0)
+/*-----------------------------------------------------------------------------
+ *      WiFi trace
+ *----------------------------------------------------------------------------*/
+#define WIFI_ID(fn)     TRC_ID(TRC_DRV_WIFI, fn)
+
+static void WIFI_TrcEvent (uint32_t event, void *arg) {
+  TraceEvent(WIFI_ID(TRC_FN_EVENT), 0U, event);
+  wifi_cb_event(event, arg);
+}
+
+static ARM_DRIVER_VERSION WIFI_TrcGetVersion (void) {
+  uint32_t           th = TraceEnter(WIFI_ID(0U), 0U, 0U);
+  ARM_DRIVER_VERSION rv = wifi_drv->GetVersion();
+  TraceExit(WIFI_ID(0U), th, rv.drv);
+  return (rv);
+}
+
+static ARM_WIFI_CAPABILITIES WIFI_TrcGetCapabilities (void) {
+  uint32_t              th = TraceEnter(WIFI_ID(1U), 0U, 0U);
+  ARM_WIFI_CAPABILITIES rv = wifi_drv->GetCapabilities();
+  TraceExit(WIFI_ID(1U), th, TraceStatus(&rv, sizeof(rv)));
+  return (rv);
+}
+
+static int32_t WIFI_TrcInitialize (ARM_WIFI_SignalEvent_t cb_event) {
+  uint32_t th = TraceEnter(WIFI_ID(2U), 0U, 0U);
+  int32_t  rv;
+  wifi_cb_event = cb_event;
+  rv = wifi_drv->Initialize((cb_event != NULL) ? WIFI_TrcEvent : NULL);
+  TraceExit(WIFI_ID(2U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t WIFI_TrcUninitialize (void) {
+  uint32_t th = TraceEnter(WIFI_ID(3U), 0U, 0U);
+  int32_t  rv = wifi_drv->Uninitialize();
+  TraceExit(WIFI_ID(3U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t WIFI_TrcPowerControl (ARM_POWER_STATE state) {
+  uint32_t th = TraceEnter(WIFI_ID(4U), 0U, (uint32_t)state);
+  int32_t  rv = wifi_drv->PowerControl(state);
+  TraceExit(WIFI_ID(4U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t WIFI_TrcGetModuleInfo (char *module_info, uint32_t max_len) {
+  uint32_t th = TraceEnter(WIFI_ID(5U), 0U, max_len);
+  int32_t  rv = wifi_drv->GetModuleInfo(module_info, max_len);
+  TraceExit(WIFI_ID(5U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t WIFI_TrcSetOption (uint32_t interface, uint32_t option, const void *data, uint32_t len) {
+  uint32_t th = TraceEnter(WIFI_ID(6U), (uint8_t)interface, option);
+  int32_t  rv = wifi_drv->SetOption(interface, option, data, len);
+  TraceExit(WIFI_ID(6U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t WIFI_TrcGetOption (uint32_t interface, uint32_t option, void *data, uint32_t *len) {
+  uint32_t th = TraceEnter(WIFI_ID(7U), (uint8_t)interface, option);
+  int32_t  rv = wifi_drv->GetOption(interface, option, data, len);
+  TraceExit(WIFI_ID(7U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t WIFI_TrcScan (ARM_WIFI_SCAN_INFO_t scan_info[], uint32_t max_num) {
+  uint32_t th = TraceEnter(WIFI_ID(8U), 0U, max_num);
+  int32_t  rv = wifi_drv->Scan(scan_info, max_num);
+  TraceExit(WIFI_ID(8U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t WIFI_TrcActivate (uint32_t interface, const ARM_WIFI_CONFIG_t *config) {
+  uint32_t th = TraceEnter(WIFI_ID(9U), (uint8_t)interface, interface);
+  int32_t  rv = wifi_drv->Activate(interface, config);
+  TraceExit(WIFI_ID(9U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t WIFI_TrcDeactivate (uint32_t interface) {
+  uint32_t th = TraceEnter(WIFI_ID(10U), (uint8_t)interface, interface);
+  int32_t  rv = wifi_drv->Deactivate(interface);
+  TraceExit(WIFI_ID(10U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static uint32_t WIFI_TrcIsConnected (void) {
+  uint32_t th = TraceEnter(WIFI_ID(11U), 0U, 0U);
+  uint32_t rv = wifi_drv->IsConnected();
+  TraceExit(WIFI_ID(11U), th, rv);
+  return (rv);
+}
+
+static int32_t WIFI_TrcGetNetInfo (ARM_WIFI_NET_INFO_t *net_info) {
+  uint32_t th = TraceEnter(WIFI_ID(12U), 0U, 0U);
+  int32_t  rv = wifi_drv->GetNetInfo(net_info);
+  TraceExit(WIFI_ID(12U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t WIFI_TrcBypassControl (uint32_t interface, uint32_t mode) {
+  uint32_t th = TraceEnter(WIFI_ID(13U), (uint8_t)interface, mode);
+  int32_t  rv = wifi_drv->BypassControl(interface, mode);
+  TraceExit(WIFI_ID(13U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t WIFI_TrcEthSendFrame (uint32_t interface, const uint8_t *frame, uint32_t len) {
+  uint32_t th = TraceEnter(WIFI_ID(14U), (uint8_t)interface, len);
+  int32_t  rv = wifi_drv->EthSendFrame(interface, frame, len);
+  TraceExit(WIFI_ID(14U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t WIFI_TrcEthReadFrame (uint32_t interface, uint8_t *frame, uint32_t len) {
+  uint32_t th = TraceEnter(WIFI_ID(15U), (uint8_t)interface, len);
+  int32_t  rv = wifi_drv->EthReadFrame(interface, frame, len);
+  TraceExit(WIFI_ID(15U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static uint32_t WIFI_TrcEthGetRxFrameSize (uint32_t interface) {
+  uint32_t th = TraceEnter(WIFI_ID(16U), (uint8_t)interface, interface);
+  uint32_t rv = wifi_drv->EthGetRxFrameSize(interface);
+  TraceExit(WIFI_ID(16U), th, rv);
+  return (rv);
+}
+
+static int32_t WIFI_TrcSocketCreate (int32_t af, int32_t type, int32_t protocol) {
+  uint32_t th = TraceEnter(WIFI_ID(17U), 0U, (uint32_t)type);
+  int32_t  rv = wifi_drv->SocketCreate(af, type, protocol);
+  TraceExit(WIFI_ID(17U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t WIFI_TrcSocketBind (int32_t socket, const uint8_t *ip, uint32_t ip_len, uint16_t port) {
+  uint32_t th = TraceEnter(WIFI_ID(18U), (uint8_t)socket, port);
+  int32_t  rv = wifi_drv->SocketBind(socket, ip, ip_len, port);
+  TraceExit(WIFI_ID(18U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t WIFI_TrcSocketListen (int32_t socket, int32_t backlog) {
+  uint32_t th = TraceEnter(WIFI_ID(19U), (uint8_t)socket, (uint32_t)backlog);
+  int32_t  rv = wifi_drv->SocketListen(socket, backlog);
+  TraceExit(WIFI_ID(19U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t WIFI_TrcSocketAccept (int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t *port) {
+  uint32_t th = TraceEnter(WIFI_ID(20U), (uint8_t)socket, 0U);
+  int32_t  rv = wifi_drv->SocketAccept(socket, ip, ip_len, port);
+  TraceExit(WIFI_ID(20U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t WIFI_TrcSocketConnect (int32_t socket, const uint8_t *ip, uint32_t ip_len, uint16_t port) {
+  uint32_t th = TraceEnter(WIFI_ID(21U), (uint8_t)socket, port);
+  int32_t  rv = wifi_drv->SocketConnect(socket, ip, ip_len, port);
+  TraceExit(WIFI_ID(21U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t WIFI_TrcSocketRecv (int32_t socket, void *buf, uint32_t len) {
+  uint32_t th = TraceEnter(WIFI_ID(22U), (uint8_t)socket, len);
+  int32_t  rv = wifi_drv->SocketRecv(socket, buf, len);
+  TraceExit(WIFI_ID(22U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t WIFI_TrcSocketRecvFrom (int32_t socket, void *buf, uint32_t len, uint8_t *ip, uint32_t *ip_len, uint16_t *port) {
+  uint32_t th = TraceEnter(WIFI_ID(23U), (uint8_t)socket, len);
+  int32_t  rv = wifi_drv->SocketRecvFrom(socket, buf, len, ip, ip_len, port);
+  TraceExit(WIFI_ID(23U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t WIFI_TrcSocketSend (int32_t socket, const void *buf, uint32_t len) {
+  uint32_t th = TraceEnter(WIFI_ID(24U), (uint8_t)socket, len);
+  int32_t  rv = wifi_drv->SocketSend(socket, buf, len);
+  TraceExit(WIFI_ID(24U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t WIFI_TrcSocketSendTo (int32_t socket, const void *buf, uint32_t len, const uint8_t *ip, uint32_t ip_len, uint16_t port) {
+  uint32_t th = TraceEnter(WIFI_ID(25U), (uint8_t)socket, len);
+  int32_t  rv = wifi_drv->SocketSendTo(socket, buf, len, ip, ip_len, port);
+  TraceExit(WIFI_ID(25U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t WIFI_TrcSocketGetSockName (int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t *port) {
+  uint32_t th = TraceEnter(WIFI_ID(26U), (uint8_t)socket, 0U);
+  int32_t  rv = wifi_drv->SocketGetSockName(socket, ip, ip_len, port);
+  TraceExit(WIFI_ID(26U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t WIFI_TrcSocketGetPeerName (int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t *port) {
+  uint32_t th = TraceEnter(WIFI_ID(27U), (uint8_t)socket, 0U);
+  int32_t  rv = wifi_drv->SocketGetPeerName(socket, ip, ip_len, port);
+  TraceExit(WIFI_ID(27U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t WIFI_TrcSocketGetOpt (int32_t socket, int32_t opt_id, void *opt_val, uint32_t *opt_len) {
+  uint32_t th = TraceEnter(WIFI_ID(28U), (uint8_t)socket, (uint32_t)opt_id);
+  int32_t  rv = wifi_drv->SocketGetOpt(socket, opt_id, opt_val, opt_len);
+  TraceExit(WIFI_ID(28U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t WIFI_TrcSocketSetOpt (int32_t socket, int32_t opt_id, const void *opt_val, uint32_t opt_len) {
+  uint32_t th = TraceEnter(WIFI_ID(29U), (uint8_t)socket, (uint32_t)opt_id);
+  int32_t  rv = wifi_drv->SocketSetOpt(socket, opt_id, opt_val, opt_len);
+  TraceExit(WIFI_ID(29U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t WIFI_TrcSocketClose (int32_t socket) {
+  uint32_t th = TraceEnter(WIFI_ID(30U), (uint8_t)socket, 0U);
+  int32_t  rv = wifi_drv->SocketClose(socket);
+  TraceExit(WIFI_ID(30U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t WIFI_TrcSocketGetHostByName (const char *name, int32_t af, uint8_t *ip, uint32_t *ip_len) {
+  uint32_t th = TraceEnter(WIFI_ID(31U), 0U, (uint32_t)af);
+  int32_t  rv = wifi_drv->SocketGetHostByName(name, af, ip, ip_len);
+  TraceExit(WIFI_ID(31U), th, (uint32_t)rv);
+  return (rv);
+}
+
+static int32_t WIFI_TrcPing (const uint8_t *ip, uint32_t ip_len) {
+  uint32_t th = TraceEnter(WIFI_ID(32U), 0U, ip_len);
+  int32_t  rv = wifi_drv->Ping(ip, ip_len);
+  TraceExit(WIFI_ID(32U), th, (uint32_t)rv);
+  return (rv);
+}
+
+ARM_DRIVER_WIFI DV_Trace_Driver_WiFi = {
+  WIFI_TrcGetVersion,
+  WIFI_TrcGetCapabilities,
+  WIFI_TrcInitialize,
+  WIFI_TrcUninitialize,
+  WIFI_TrcPowerControl,
+  WIFI_TrcGetModuleInfo,
+  WIFI_TrcSetOption,
+  WIFI_TrcGetOption,
+  WIFI_TrcScan,
+  WIFI_TrcActivate,
+  WIFI_TrcDeactivate,
+  WIFI_TrcIsConnected,
+  WIFI_TrcGetNetInfo,
+  WIFI_TrcBypassControl,
+  WIFI_TrcEthSendFrame,
+  WIFI_TrcEthReadFrame,
+  WIFI_TrcEthGetRxFrameSize,
+  WIFI_TrcSocketCreate,
+  WIFI_TrcSocketBind,
+  WIFI_TrcSocketListen,
+  WIFI_TrcSocketAccept,
+  WIFI_TrcSocketConnect,
+  WIFI_TrcSocketRecv,
+  WIFI_TrcSocketRecvFrom,
+  WIFI_TrcSocketSend,
+  WIFI_TrcSocketSendTo,
+  WIFI_TrcSocketGetSockName,
+  WIFI_TrcSocketGetPeerName,
+  WIFI_TrcSocketGetOpt,
+  WIFI_TrcSocketSetOpt,
+  WIFI_TrcSocketClose,
+  WIFI_TrcSocketGetHostByName,
+  WIFI_TrcPing
+};
+#endif
+
+#endif /* DV_TRACE_EN */
@@ -212,7 +212,15 @@ typedef struct {                // USART Server capabilities structure
 #define _ARM_Driver_USART_(n)         Driver_USART##n
 #define  ARM_Driver_USART_(n)    _ARM_Driver_USART_(n)
 extern   ARM_DRIVER_USART         ARM_Driver_USART_(DRV_USART);
+#if   (DV_TRACE_EN  != 0) && (DV_TRACE_USART != 0)
+extern   ARM_DRIVER_USART         DV_Trace_Driver_USART;
+static   ARM_DRIVER_USART *drv = &DV_Trace_Driver_USART;
+#elif (DV_INJECT_EN != 0) && (DV_INJECT_USART != 0)
+extern   ARM_DRIVER_USART         DV_Inject_Driver_USART;
+static   ARM_DRIVER_USART *drv = &DV_Inject_Driver_USART;
+#else
 static   ARM_DRIVER_USART *drv = &ARM_Driver_USART_(DRV_USART);
+#endif
 
 // Local variables (used in this module only)
 static int8_t                   buffers_ok;
@@ -1671,22 +1679,22 @@ void USART_DV_Initialize (void) {
   // (maximum size is incremented by 32 bytes to ensure that buffer can be aligned to 32 bytes)
 
   ptr_tx_buf_alloc = malloc(USART_BUF_MAX + 32U);
-  if (((uint32_t)ptr_tx_buf_alloc & 31U) != 0U) {
+  if (((uintptr_t)ptr_tx_buf_alloc & 31U) != 0U) {
     // If allocated memory is not 32 byte aligned, use next 32 byte aligned address for ptr_tx_buf
-    ptr_tx_buf = (uint8_t *)((((uint32_t)ptr_tx_buf_alloc) + 31U) & (~31U));
+    ptr_tx_buf = (uint8_t *)((((uintptr_t)ptr_tx_buf_alloc) + 31U) & ~(uintptr_t)31U);
   } else {
     // If allocated memory is 32 byte aligned, use it directly
     ptr_tx_buf = (uint8_t *)ptr_tx_buf_alloc;
   }
   ptr_rx_buf_alloc = malloc(USART_BUF_MAX + 32U);
-  if (((uint32_t)ptr_rx_buf_alloc & 31U) != 0U) {
-    ptr_rx_buf = (uint8_t *)((((uint32_t)ptr_rx_buf_alloc) + 31U) & (~31U));
+  if (((uintptr_t)ptr_rx_buf_alloc & 31U) != 0U) {
+    ptr_rx_buf = (uint8_t *)((((uintptr_t)ptr_rx_buf_alloc) + 31U) & ~(uintptr_t)31U);
   } else {
     ptr_rx_buf = (uint8_t *)ptr_rx_buf_alloc;
   }
   ptr_cmp_buf_alloc = malloc(USART_BUF_MAX + 32U);
-  if (((uint32_t)ptr_cmp_buf_alloc & 31U) != 0U) {
-    ptr_cmp_buf = (uint8_t *)((((uint32_t)ptr_cmp_buf_alloc) + 31U) & (~31U));
+  if (((uintptr_t)ptr_cmp_buf_alloc & 31U) != 0U) {
+    ptr_cmp_buf = (uint8_t *)((((uintptr_t)ptr_cmp_buf_alloc) + 31U) & ~(uintptr_t)31U);
   } else {
     ptr_cmp_buf = (uint8_t *)ptr_cmp_buf_alloc;
   }
@@ -4152,6 +4160,7 @@ void USART_Baudrate_Min (void) {
   if (duration != 0xFFFFFFFFU) {        // If Transfer finished before timeout
     if (duration != 0U) {               // If duration of transfer was more than 0 SysTick counts
       br = ((uint64_t)systick_freq * (1U + USART_CFG_DEF_DATA_BITS + USART_CFG_DEF_STOP_BITS + (uint32_t)(USART_CFG_DEF_PARITY != PARITY_NONE)) * USART_CFG_DEF_NUM) / duration;
+      TEST_MEASUREMENT("Effective baudrate", (uint32_t)br, "baud");
       if ((br < ((USART_CFG_MIN_BAUDRATE * 3) / 4)) ||
           (br >   USART_CFG_MIN_BAUDRATE)) {
         // If measured baudrate is 25% lower, or higher than requested
@@ -4197,6 +4206,7 @@ void USART_Baudrate_Max (void) {
   if (duration != 0xFFFFFFFFU) {        // If Transfer finished before timeout
     if (duration != 0U) {               // If duration of transfer was more than 0 SysTick counts
       br = ((uint64_t)systick_freq * (1U + USART_CFG_DEF_DATA_BITS + USART_CFG_DEF_STOP_BITS + (uint32_t)(USART_CFG_DEF_PARITY != PARITY_NONE)) * USART_CFG_DEF_NUM) / duration;
+      TEST_MEASUREMENT("Effective baudrate", (uint32_t)br, "baud");
       if ((br < ((USART_CFG_MAX_BAUDRATE * 3) / 4)) ||
           (br >   USART_CFG_MAX_BAUDRATE)) {
         // If measured baudrate is 25% lower, or higher than requested
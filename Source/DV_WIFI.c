@@ -91,7 +91,15 @@
 
 /* Register Driver_WiFi# */
 extern ARM_DRIVER_WIFI         ARM_Driver_WiFi_(DRV_WIFI);
+#if   (DV_TRACE_EN  != 0) && (DV_TRACE_WIFI != 0)
+extern ARM_DRIVER_WIFI         DV_Trace_Driver_WiFi;
+static ARM_DRIVER_WIFI* drv = &DV_Trace_Driver_WiFi;
+#elif (DV_INJECT_EN != 0) && (DV_INJECT_WIFI != 0)
+extern ARM_DRIVER_WIFI         DV_Inject_Driver_WiFi;
+static ARM_DRIVER_WIFI* drv = &DV_Inject_Driver_WiFi;
+#else
 static ARM_DRIVER_WIFI* drv = &ARM_Driver_WiFi_(DRV_WIFI);
+#endif
 
 /* Local variables */
 static uint8_t                  powered   = 0U;
@@ -3107,8 +3115,8 @@ __NO_RETURN static void Th_Create (IO_CREATE *io) {
     /* Done, send signal to owner thread */
     flags = (xid == io->xid) ? TH_OK : TH_TOUT;
     osDelay(1);
-    osThreadFlagsSet (io->owner, flags);
     osThreadFlagsClear (F_ALL);
+    osThreadFlagsSet (io->owner, flags);
   }
 }
 
@@ -3259,6 +3267,7 @@ void WIFI_SocketCreate (void) {
   }
 
   /* Terminate worker thread */
+  TEST_THREAD_STACK (worker);
   osThreadTerminate (worker);
 }
 
@@ -3318,8 +3327,8 @@ __NO_RETURN static void Th_Bind (IO_BIND *io) {
     /* Done, send signal to owner thread */
     flags = (xid == io->xid) ? TH_OK : TH_TOUT;
     osDelay(1);
-    osThreadFlagsSet (io->owner, flags);
     osThreadFlagsClear (F_ALL);
+    osThreadFlagsSet (io->owner, flags);
   }
 }
 
@@ -3568,6 +3577,7 @@ void WIFI_SocketBind (void) {
   }
 
   /* Terminate worker thread */
+  TEST_THREAD_STACK (worker);
   osThreadTerminate (worker);
 }
 
@@ -3628,8 +3638,8 @@ __NO_RETURN static void Th_Listen (IO_LISTEN *io) {
     /* Done, send signal to owner thread */
     flags = (xid == io->xid) ? TH_OK : TH_TOUT;
     osDelay(1);
-    osThreadFlagsSet (io->owner, flags);
     osThreadFlagsClear (F_ALL);
+    osThreadFlagsSet (io->owner, flags);
   }
 }
 
@@ -3795,6 +3805,7 @@ void WIFI_SocketListen (void) {
   }
 
   /* Terminate worker thread */
+  TEST_THREAD_STACK (worker);
   osThreadTerminate (worker);
 }
 
@@ -3910,8 +3921,8 @@ __NO_RETURN static void Th_Accept (IO_ACCEPT *io) {
     /* Done, send signal to owner thread */
     flags = (xid == io->xid) ? TH_OK : TH_TOUT;
     osDelay(1);
-    osThreadFlagsSet (io->owner, flags);
     osThreadFlagsClear (F_ALL);
+    osThreadFlagsSet (io->owner, flags);
   }
 }
 
@@ -4141,6 +4152,7 @@ void WIFI_SocketAccept (void) {
   }
 
   /* Terminate worker thread */
+  TEST_THREAD_STACK (worker);
   osThreadTerminate (worker);
 }
 
@@ -4350,6 +4362,7 @@ void WIFI_SocketAccept_nbio (void) {
   }
 
   /* Terminate worker thread */
+  TEST_THREAD_STACK (worker);
   osThreadTerminate (worker);
 }
 
@@ -4427,8 +4440,8 @@ __NO_RETURN static void Th_Connect (IO_CONNECT *io) {
     /* Done, send signal to owner thread */
     flags = (xid == io->xid) ? TH_OK : TH_TOUT;
     osDelay(1);
-    osThreadFlagsSet (io->owner, flags);
     osThreadFlagsClear (F_ALL);
+    osThreadFlagsSet (io->owner, flags);
   }
 }
 
@@ -4742,6 +4755,7 @@ void WIFI_SocketConnect (void) {
   }
 
   /* Terminate worker thread */
+  TEST_THREAD_STACK (worker);
   osThreadTerminate (worker);
 }
 
@@ -5036,6 +5050,7 @@ void WIFI_SocketConnect_nbio (void) {
   }
 
   /* Terminate worker thread */
+  TEST_THREAD_STACK (worker);
   osThreadTerminate (worker);
 }
 
@@ -5114,8 +5129,8 @@ __NO_RETURN static void Th_Recv (IO_RECV *io) {
     /* Done, send signal to owner thread */
     flags = (xid == io->xid) ? TH_OK : TH_TOUT;
     osDelay(1);
-    osThreadFlagsSet (io->owner, flags);
     osThreadFlagsClear (F_ALL);
+    osThreadFlagsSet (io->owner, flags);
   }
 }
 
@@ -5326,6 +5341,7 @@ void WIFI_SocketRecv (void) {
   }
 
   /* Terminate worker thread */
+  TEST_THREAD_STACK (worker);
   osThreadTerminate (worker);
 }
 
@@ -5568,6 +5584,7 @@ void WIFI_SocketRecv_nbio (void) {
   }
 
   /* Terminate worker thread */
+  TEST_THREAD_STACK (worker);
   osThreadTerminate (worker);
 }
 
@@ -5647,8 +5664,8 @@ __NO_RETURN static void Th_RecvFrom (IO_RECVFROM *io) {
     /* Done, send signal to owner thread */
     flags = (xid == io->xid) ? TH_OK : TH_TOUT;
     osDelay(1);
-    osThreadFlagsSet (io->owner, flags);
     osThreadFlagsClear (F_ALL);
+    osThreadFlagsSet (io->owner, flags);
   }
 }
 
@@ -5794,6 +5811,7 @@ void WIFI_SocketRecvFrom (void) {
   }
 
   /* Terminate worker thread */
+  TEST_THREAD_STACK (worker);
   osThreadTerminate (worker);
 }
 
@@ -5949,6 +5967,7 @@ void WIFI_SocketRecvFrom_nbio (void) {
   }
 
   /* Terminate worker thread */
+  TEST_THREAD_STACK (worker);
   osThreadTerminate (worker);
 }
 
@@ -6017,8 +6036,8 @@ __NO_RETURN static void Th_Send (IO_SEND *io) {
     /* Done, send signal to owner thread */
     flags = (xid == io->xid) ? TH_OK : TH_TOUT;
     osDelay(1);
-    osThreadFlagsSet (io->owner, flags);
     osThreadFlagsClear (F_ALL);
+    osThreadFlagsSet (io->owner, flags);
   }
 }
 
@@ -6236,6 +6255,7 @@ void WIFI_SocketSend (void) {
   }
 
   /* Terminate worker thread */
+  TEST_THREAD_STACK (worker);
   osThreadTerminate (worker);
 }
 
@@ -6301,8 +6321,8 @@ __NO_RETURN static void Th_SendTo (IO_SENDTO *io) {
     /* Done, send signal to owner thread */
     flags = (xid == io->xid) ? TH_OK : TH_TOUT;
     osDelay(1);
-    osThreadFlagsSet (io->owner, flags);
     osThreadFlagsClear (F_ALL);
+    osThreadFlagsSet (io->owner, flags);
   }
 }
 
@@ -6411,6 +6431,7 @@ void WIFI_SocketSendTo (void) {
   }
 
   /* Terminate worker thread */
+  TEST_THREAD_STACK (worker);
   osThreadTerminate (worker);
 }
 
@@ -6481,8 +6502,8 @@ __NO_RETURN static void Th_GetSockName (IO_GETSOCKNAME *io) {
     /* Done, send signal to owner thread */
     flags = (xid == io->xid) ? TH_OK : TH_TOUT;
     osDelay(1);
-    osThreadFlagsSet (io->owner, flags);
     osThreadFlagsClear (F_ALL);
+    osThreadFlagsSet (io->owner, flags);
   }
 }
 
@@ -6783,6 +6804,7 @@ void WIFI_SocketGetSockName (void) {
   }
 
   /* Terminate worker thread */
+  TEST_THREAD_STACK (worker);
   osThreadTerminate (worker);
 }
 
@@ -6858,8 +6880,8 @@ __NO_RETURN static void Th_GetPeerName (IO_GETPEERNAME *io) {
     /* Done, send signal to owner thread */
     flags = (xid == io->xid) ? TH_OK : TH_TOUT;
     osDelay(1);
-    osThreadFlagsSet (io->owner, flags);
     osThreadFlagsClear (F_ALL);
+    osThreadFlagsSet (io->owner, flags);
   }
 }
 
@@ -7116,6 +7138,7 @@ void WIFI_SocketGetPeerName (void) {
   }
 
   /* Terminate worker thread */
+  TEST_THREAD_STACK (worker);
   osThreadTerminate (worker);
 }
 
@@ -7176,8 +7199,8 @@ __NO_RETURN static void Th_GetOpt (IO_GETOPT *io) {
     /* Done, send signal to owner thread */
     flags = (xid == io->xid) ? TH_OK : TH_TOUT;
     osDelay(1);
-    osThreadFlagsSet (io->owner, flags);
     osThreadFlagsClear (F_ALL);
+    osThreadFlagsSet (io->owner, flags);
   }
 }
 
@@ -7385,6 +7408,7 @@ void WIFI_SocketGetOpt (void) {
   }
 
   /* Terminate worker thread */
+  TEST_THREAD_STACK (worker);
   osThreadTerminate (worker);
 }
 
@@ -7444,8 +7468,8 @@ __NO_RETURN static void Th_SetOpt (IO_SETOPT *io) {
     /* Done, send signal to owner thread */
     flags = (xid == io->xid) ? TH_OK : TH_TOUT;
     osDelay(1);
-    osThreadFlagsSet (io->owner, flags);
     osThreadFlagsClear (F_ALL);
+    osThreadFlagsSet (io->owner, flags);
   }
 }
 
@@ -7630,6 +7654,7 @@ void WIFI_SocketSetOpt (void) {
   }
 
   /* Terminate worker thread */
+  TEST_THREAD_STACK (worker);
   osThreadTerminate (worker);
 }
 
@@ -7694,8 +7719,8 @@ __NO_RETURN static void Th_Close (IO_CLOSE *io) {
     /* Done, send signal to owner thread */
     flags = (xid == io->xid) ? TH_OK : TH_TOUT;
     osDelay(1);
-    osThreadFlagsSet (io->owner, flags);
     osThreadFlagsClear (F_ALL);
+    osThreadFlagsSet (io->owner, flags);
   }
 }
 
@@ -7876,6 +7901,7 @@ void WIFI_SocketClose (void) {
   }
 
   /* Terminate worker thread */
+  TEST_THREAD_STACK (worker);
   osThreadTerminate (worker);
 }
 
@@ -7920,8 +7946,8 @@ __NO_RETURN static void Th_GetHostByName (IO_GETHOST *io) {
     /* Done, send signal to owner thread */
     flags = (xid == io->xid) ? TH_OK : TH_TOUT;
     osDelay(1);
-    osThreadFlagsSet (io->owner, flags);
     osThreadFlagsClear (F_ALL);
+    osThreadFlagsSet (io->owner, flags);
   }
 }
 
@@ -8033,6 +8059,7 @@ void WIFI_SocketGetHostByName (void) {
   }
 
   /* Terminate worker thread */
+  TEST_THREAD_STACK (worker);
   osThreadTerminate (worker);
 }
 
@@ -8073,8 +8100,8 @@ __NO_RETURN static void Th_Ping (IO_PING *io) {
     /* Done, send signal to owner thread */
     flags = (xid == io->xid) ? TH_OK : TH_TOUT;
     osDelay(1);
-    osThreadFlagsSet (io->owner, flags);
     osThreadFlagsClear (F_ALL);
+    osThreadFlagsSet (io->owner, flags);
   }
 }
 
@@ -8140,6 +8167,7 @@ void WIFI_Ping (void) {
   }
 
   /* Terminate worker thread */
+  TEST_THREAD_STACK (worker);
   osThreadTerminate (worker);
 }
 
@@ -8301,8 +8329,8 @@ __NO_RETURN static void Th_Transfer (IO_TRANSFER *io) {
     /* Done, send signal to owner thread */
     flags = (xid == io->xid) ? TH_OK : TH_TOUT;
     osDelay(1);
-    osThreadFlagsSet (io->owner, flags);
     osThreadFlagsClear (F_ALL);
+    osThreadFlagsSet (io->owner, flags);
   }
 }
 
@@ -8447,6 +8475,7 @@ void WIFI_Transfer_Fixed (void) {
   }
 
   /* Terminate worker thread */
+  TEST_THREAD_STACK (worker);
   osThreadTerminate (worker);
 }
 
@@ -8602,6 +8631,7 @@ void WIFI_Transfer_Incremental (void) {
   }
 
   /* Terminate worker thread */
+  TEST_THREAD_STACK (worker);
   osThreadTerminate (worker);
 }
 
@@ -8684,6 +8714,7 @@ void WIFI_Send_Fragmented (void) {
   }
 
   /* Terminate worker thread */
+  TEST_THREAD_STACK (worker);
   osThreadTerminate (worker);
 }
 
@@ -8766,6 +8797,7 @@ void WIFI_Recv_Fragmented (void) {
   }
 
   /* Terminate worker thread */
+  TEST_THREAD_STACK (worker);
   osThreadTerminate (worker);
 }
 
@@ -8832,6 +8864,7 @@ void WIFI_Test_Speed (void) {
       else           break;
     } while (GET_SYSTICK() - ticks < tout);
     /* Check transfer rate */
+    TEST_MEASUREMENT("Transfer rate", n_bytes / 2048, "KB/s");
     if (n_bytes < 10000) {
       snprintf(msg_buf, sizeof(msg_buf), "[WARNING] Slow Transfer rate (%d KB/s)", n_bytes / 2048);
       TEST_MESSAGE(msg_buf);
@@ -8869,6 +8902,7 @@ void WIFI_Test_Speed (void) {
       else           break;
     } while (GET_SYSTICK() - ticks < tout);
     /* Check transfer rate */
+    TEST_MEASUREMENT("Transfer rate", n_bytes / 2048, "KB/s");
     if (n_bytes < 10000) {
       snprintf(msg_buf, sizeof(msg_buf), "[WARNING] Slow Transfer rate (%d KB/s)", n_bytes / 2048);
       TEST_MESSAGE(msg_buf);
@@ -8887,6 +8921,7 @@ void WIFI_Test_Speed (void) {
   }
 
   /* Terminate worker thread */
+  TEST_THREAD_STACK (worker);
   osThreadTerminate (worker);
 }
 
@@ -9010,6 +9045,7 @@ void WIFI_Concurrent_Socket (void) {
       else           break;
     } while (GET_SYSTICK() - ticks < tout);
     /* Check main transfer rate */
+    TEST_MEASUREMENT("Transfer rate", n_bytes / 2048, "KB/s");
     if (n_bytes < 10000) {
       snprintf(msg_buf, sizeof(msg_buf), "[WARNING] Slow Transfer rate (%d KB/s)", n_bytes / 2048);
       TEST_MESSAGE(msg_buf);
@@ -9025,6 +9061,7 @@ void WIFI_Concurrent_Socket (void) {
     /* Terminate spawned thread */
     osThreadFlagsSet (spawn, SK_TERMINATE);
     osDelay(100);
+    TEST_THREAD_STACK (spawn);
     osThreadTerminate (spawn);
 
     /* Close stream sockets */
@@ -9086,6 +9123,7 @@ void WIFI_Concurrent_Socket (void) {
       else           break;
     } while (GET_SYSTICK() - ticks < tout);
     /* Check main transfer rate */
+    TEST_MEASUREMENT("Transfer rate", n_bytes / 2048, "KB/s");
     if (n_bytes < 10000) {
       snprintf(msg_buf, sizeof(msg_buf), "[WARNING] Slow Transfer rate (%d KB/s)", n_bytes / 2048);
       TEST_MESSAGE(msg_buf);
@@ -9101,6 +9139,7 @@ void WIFI_Concurrent_Socket (void) {
     /* Terminate spawned thread */
     osThreadFlagsSet (spawn, SK_TERMINATE);
     osDelay(100);
+    TEST_THREAD_STACK (spawn);
     osThreadTerminate (spawn);
 
     /* Close sockets */
@@ -9120,6 +9159,7 @@ void WIFI_Concurrent_Socket (void) {
   }
 
   /* Terminate worker thread */
+  TEST_THREAD_STACK (worker);
   osThreadTerminate (worker);
 }
 
@@ -9135,18 +9175,19 @@ void WIFI_Concurrent_Socket (void) {
 typedef struct {
   int32_t      sock;
   int32_t      rc;
+  uint32_t     cnt;
   /* Control */
   osThreadId_t owner;
   uint32_t     xid;
-  int32_t      loss;
+  uint32_t     loss;
   const char  *cmd;
 } IO_STREAMRATE;
 #endif
 
 /* StreamRate coworker thread */
 __NO_RETURN static void Th_StreamRate (IO_STREAMRATE *io) {
-  uint32_t flags,xid,ticks,tout;
-  int32_t  n,rc,i,val;
+  uint32_t flags,xid,ticks,tout,n,val;
+  int32_t  rc,i;
 
   for (;;) {
     flags = osThreadFlagsWait (F_CREATE_TCP | F_DOWNLOAD | F_UPLOAD |
@@ -9160,17 +9201,18 @@ __NO_RETURN static void Th_StreamRate (IO_STREAMRATE *io) {
 
       case F_DOWNLOAD:
         /* Downstream test, server is sender */
-        for (n = 0; ; n += rc) {
+        for (n = 0U; ; n += (uint32_t)rc) {
           rc = drv->SocketRecv (io->sock, buffer, TEST_BSIZE);
           if (strncmp ((char *)buffer, "STAT", 4) == 0) {
             /* Server completed the test */
-            sscanf ((char *)buffer+4, "%d", &val);
+            sscanf ((char *)buffer+4, "%u", &val);
             if (val > n) io->loss = val - n;
             break;
           }
           if (rc <= 0) break;
         }
-        io->rc = n;
+        io->cnt = n;
+        io->rc  = (n != 0U) ? 1 : 0;
         break;
 
       case F_UPLOAD:
@@ -9178,21 +9220,23 @@ __NO_RETURN static void Th_StreamRate (IO_STREAMRATE *io) {
         memset ((void *)buffer, 'a', TEST_BSIZE);
         tout  = SYSTICK_MS(4000);
         ticks = GET_SYSTICK();
-        i = n = 0;
+        i = 0;
+        n = 0U;
         do {
           snprintf ((char *)buffer, sizeof(buffer), "Block[%d]", ++i);
           rc = drv->SocketSend (io->sock, buffer, TEST_BSIZE);
-          if (rc > 0) n += rc;
+          if (rc > 0) n += (uint32_t)rc;
         } while (GET_SYSTICK() - ticks < tout);
-        rc = snprintf ((char *)buffer, sizeof(buffer), "STOP %d bytes.", n);
+        rc = snprintf ((char *)buffer, sizeof(buffer), "STOP %u bytes.", n);
         drv->SocketSend (io->sock, buffer, (uint32_t)rc);
         /* Receive report from server */
         drv->SocketRecv (io->sock, buffer, TEST_BSIZE);
         if (strncmp ((char *)buffer, "STAT", 4) == 0) {
-          sscanf ((char *)buffer+4, "%d", &val);
+          sscanf ((char *)buffer+4, "%u", &val);
           if (n > val) io->loss = n - val;
         }
-        io->rc = n;
+        io->cnt = n;
+        io->rc  = (n != 0U) ? 1 : 0;
         break;
 
       case F_CLOSE:
@@ -9209,8 +9253,8 @@ __NO_RETURN static void Th_StreamRate (IO_STREAMRATE *io) {
     /* Done, send signal to owner thread */
     flags = (xid == io->xid) ? TH_OK : TH_TOUT;
     osDelay(1);
-    osThreadFlagsSet (io->owner, flags);
     osThreadFlagsClear (F_ALL);
+    osThreadFlagsSet (io->owner, flags);
   }
 }
 
@@ -9259,11 +9303,13 @@ void WIFI_Downstream_Rate (void) {
 
     /* Check data loss */
     if (io.loss) {
-      snprintf(msg_buf, sizeof(msg_buf), "[FAILED] Data loss %d byte(s)", io.loss);
+      snprintf(msg_buf, sizeof(msg_buf), "[FAILED] Data loss %u byte(s)", io.loss);
       TEST_ASSERT_MESSAGE(0,msg_buf);
     }
     else if (rval != 0) {
-      snprintf(msg_buf, sizeof(msg_buf), "[INFO] Speed %d KB/s", io.rc/4096);
+      /* Bytes transferred in 4 seconds */
+      TEST_MEASUREMENT("Speed", io.cnt/4096U, "KB/s");
+      snprintf(msg_buf, sizeof(msg_buf), "[INFO] Speed %u KB/s", io.cnt/4096U);
       TEST_MESSAGE(msg_buf);
     }
 
@@ -9279,6 +9325,7 @@ void WIFI_Downstream_Rate (void) {
   }
 
   /* Terminate worker thread */
+  TEST_THREAD_STACK (worker);
   osThreadTerminate (worker);
 }
 
@@ -9327,11 +9374,13 @@ void WIFI_Upstream_Rate (void) {
 
     /* Check data loss */
     if (io.loss) {
-      snprintf(msg_buf, sizeof(msg_buf), "[FAILED] Data loss %d byte(s)", io.loss);
+      snprintf(msg_buf, sizeof(msg_buf), "[FAILED] Data loss %u byte(s)", io.loss);
       TEST_ASSERT_MESSAGE(0,msg_buf);
     }
     else if (rval != 0) {
-      snprintf(msg_buf, sizeof(msg_buf), "[INFO] Speed %d KB/s", io.rc/4096);
+      /* Bytes transferred in 4 seconds */
+      TEST_MEASUREMENT("Speed", io.cnt/4096U, "KB/s");
+      snprintf(msg_buf, sizeof(msg_buf), "[INFO] Speed %u KB/s", io.cnt/4096U);
       TEST_MESSAGE(msg_buf);
     }
 
@@ -9347,5 +9396,6 @@ void WIFI_Upstream_Rate (void) {
   }
 
   /* Terminate worker thread */
+  TEST_THREAD_STACK (worker);
   osThreadTerminate (worker);
 }
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-Driver Validation
+ * Title:       General-Purpose Input/Output (GPIO) driver validation
+ *              configuration for the virtual GPIO (Linux host)
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef HOST_DV_GPIO_CONFIG_H_
+#define HOST_DV_GPIO_CONFIG_H_
+
+// DV_GPIO_Config.h of the root Config folder with host overrides
+#include_next "DV_GPIO_Config.h"
+
+// Driver instance (vGPIO is Driver_GPIO0)
+#ifdef  HOST_DRV_GPIO
+#undef  DRV_GPIO
+#define DRV_GPIO                        HOST_DRV_GPIO
+#endif
+
+// Pin Under Test and Auxiliary Pin: pins 0 and 1 are connected by wire 0 (PUT-AUX)
+#undef  GPIO_CFG_PIN_UNDER_TEST
+#ifdef  HOST_GPIO_CFG_PIN_UNDER_TEST
+#define GPIO_CFG_PIN_UNDER_TEST         HOST_GPIO_CFG_PIN_UNDER_TEST
+#else
+#define GPIO_CFG_PIN_UNDER_TEST         0
+#endif
+#undef  GPIO_CFG_PIN_AUX
+#ifdef  HOST_GPIO_CFG_PIN_AUX
+#define GPIO_CFG_PIN_AUX                HOST_GPIO_CFG_PIN_AUX
+#else
+#define GPIO_CFG_PIN_AUX                1
+#endif
+
+#endif /* HOST_DV_GPIO_CONFIG_H_ */
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-Driver Validation
+ * Title:       Serial Peripheral Interface Bus (SPI) driver validation
+ *              configuration for the virtual SPI bus (Linux host)
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef HOST_DV_SPI_CONFIG_H_
+#define HOST_DV_SPI_CONFIG_H_
+
+// DV_SPI_Config.h of the root Config folder with host overrides
+#include_next "DV_SPI_Config.h"
+
+// Data bits tests: vSPI supports 1 to 32 data bits, the SPI Server compares the
+// transferred 'S'/'T' bytes unmasked, so data bits 7, 8, 15, 16, 31 and 32 are
+// enabled (all others fail with the SPI Server as on hardware)
+#ifdef  HOST_SPI_TC_DATA_BIT_EN_MASK
+#undef  SPI_TC_DATA_BIT_EN_MASK
+#define SPI_TC_DATA_BIT_EN_MASK         HOST_SPI_TC_DATA_BIT_EN_MASK
+#else
+#undef  SPI_TC_DATA_BIT_EN_MASK
+#define SPI_TC_DATA_BIT_EN_MASK         0xC000C0C0
+#endif
+
+#endif /* HOST_DV_SPI_CONFIG_H_ */
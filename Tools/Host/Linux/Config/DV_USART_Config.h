@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-Driver Validation
+ * Title:       Universal Synchronous Asynchronous Receiver/Transmitter (USART)
+ *              driver validation configuration for the virtual USART (Linux host)
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef HOST_DV_USART_CONFIG_H_
+#define HOST_DV_USART_CONFIG_H_
+
+// DV_USART_Config.h of the root Config folder with host overrides
+#include_next "DV_USART_Config.h"
+
+// All tests supported by vUSART in asynchronous mode (0 = selection of the root Config):
+// data bits 7 and 9, flow control, modem lines and line events (tests for the synchronous
+// modes, GetTxRxCount, AbortTransfer and Tx underflow stay disabled)
+#ifndef HOST_USART_ALL_TESTS
+#define HOST_USART_ALL_TESTS            1
+#endif
+
+#if    (HOST_USART_ALL_TESTS != 0)
+#undef  USART_TC_DATA_BITS_7_EN
+#define USART_TC_DATA_BITS_7_EN         1
+#undef  USART_TC_DATA_BITS_9_EN
+#define USART_TC_DATA_BITS_9_EN         1
+#undef  USART_TG_FLOW_CTRL_EN
+#define USART_TG_FLOW_CTRL_EN           1
+#undef  USART_TG_MODEM_EN
+#define USART_TG_MODEM_EN               1
+#undef  USART_TC_MODEM_DTR_EN
+#define USART_TC_MODEM_DTR_EN           1
+#undef  USART_TC_MODEM_DSR_EN
+#define USART_TC_MODEM_DSR_EN           1
+#undef  USART_TC_MODEM_DCD_EN
+#define USART_TC_MODEM_DCD_EN           1
+#undef  USART_TC_MODEM_RI_EN
+#define USART_TC_MODEM_RI_EN            1
+#undef  USART_TG_EVENT_EN
+#define USART_TG_EVENT_EN               1
+#undef  USART_TC_EVENT_CTS_EN
+#define USART_TC_EVENT_CTS_EN           1
+#undef  USART_TC_EVENT_DSR_EN
+#define USART_TC_EVENT_DSR_EN           1
+#undef  USART_TC_EVENT_DCD_EN
+#define USART_TC_EVENT_DCD_EN           1
+#undef  USART_TC_EVENT_RI_EN
+#define USART_TC_EVENT_RI_EN            1
+#endif
+
+// Command timeout: the GET BUF response of 1024 bytes takes about 89 ms at 115200 bps
+// plus the USART Server delay of 10 ms
+#undef  USART_CFG_SRV_CMD_TOUT
+#define USART_CFG_SRV_CMD_TOUT          200
+
+#endif /* HOST_DV_USART_CONFIG_H_ */
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-Driver Validation
+ * Title:       WiFi driver validation configuration
+ *              for the host WiFi driver (Linux host)
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef HOST_DV_WIFI_CONFIG_H_
+#define HOST_DV_WIFI_CONFIG_H_
+
+// DV_WiFi_Config.h of the root Config folder with host overrides
+#include_next "DV_WiFi_Config.h"
+
+// Driver instance (vWiFi is Driver_WiFi0 by default)
+#ifdef  HOST_DRV_WIFI
+#undef  DRV_WIFI
+#define DRV_WIFI                        HOST_DRV_WIFI
+#endif
+
+// SockServer on the local host (see README.md for its setup)
+#undef  WIFI_SOCKET_SERVER_IP
+#ifdef  HOST_WIFI_SOCKET_SERVER_IP
+#define WIFI_SOCKET_SERVER_IP           HOST_WIFI_SOCKET_SERVER_IP
+#else
+#define WIFI_SOCKET_SERVER_IP           "127.0.0.1"
+#endif
+
+#endif /* HOST_DV_WIFI_CONFIG_H_ */
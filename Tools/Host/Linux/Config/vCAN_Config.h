@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-Driver Validation
+ * Title:       Virtual CAN (vCAN) configuration file
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef VCAN_CONFIG_H_
+#define VCAN_CONFIG_H_
+
+//-------- <<< Use Configuration Wizard in Context Menu >>> --------------------
+//------ With VS Code: Open Preview for Configuration Wizard -------------------
+
+// <h> Virtual CAN
+// <i> Driver_CAN instance with internal loopback or connected to a Linux SocketCAN interface
+//   <o> Driver_CAN# <0-255>
+//   <i> Driver instance used by the Driver Validation (DRV_CAN in DV_CAN_Config.h)
+#ifndef VCAN_DRV_NUM
+#define VCAN_DRV_NUM                    0
+#endif
+//   <o> Bus <0=> None (internal loopback only) <1=> SocketCAN interface
+//   <i> SocketCAN interface: messages are exchanged with the Linux CAN stack (vcan or CAN adapter),
+//   <i> external loopback mode receives the own messages back from the interface
+#ifndef VCAN_BACKEND
+#define VCAN_BACKEND                    0
+#endif
+//     <s> SocketCAN interface name
+//     <i> Interface must exist and be up (ip link add dev vcan0 type vcan; ip link set vcan0 up)
+#ifndef VCAN_IF_NAME
+#define VCAN_IF_NAME                    "vcan0"
+#endif
+//   <o> CAN base clock [Hz] <1000000-160000000>
+//   <i> Clock returned by GetClock, SetBitrate accepts bitrates with an integer prescaler
+#ifndef VCAN_CLOCK
+#define VCAN_CLOCK                      80000000
+#endif
+//   <o> Transmit objects <1-127>
+//   <i> Objects 0 .. n-1 transmit messages
+#ifndef VCAN_TX_OBJ_NUM
+#define VCAN_TX_OBJ_NUM                 4
+#endif
+//   <o> Transmit FIFO depth <1-255>
+//   <i> Messages queued per transmit object (MessageSend returns ARM_DRIVER_ERROR_BUSY when full)
+#ifndef VCAN_TX_FIFO_DEPTH
+#define VCAN_TX_FIFO_DEPTH              4
+#endif
+//   <o> Receive objects <1-127>
+//   <i> Objects following the transmit objects receive messages
+#ifndef VCAN_RX_OBJ_NUM
+#define VCAN_RX_OBJ_NUM                 4
+#endif
+//   <o> Receive FIFO depth <1-255>
+//   <i> Messages stored per receive object (further messages are lost, ARM_CAN_EVENT_RECEIVE_OVERRUN)
+#ifndef VCAN_RX_FIFO_DEPTH
+#define VCAN_RX_FIFO_DEPTH              16
+#endif
+//   <o> Filters per receive object <1-64>
+#ifndef VCAN_FILTER_NUM
+#define VCAN_FILTER_NUM                 8
+#endif
+//   <q> Bit timing simulation
+//   <i> Enabled: messages are transmitted in the frame time at the configured bitrates
+//   <i> Disabled: messages are transmitted as fast as possible (for load tests of test logic)
+#ifndef VCAN_BIT_TIMING_SIM
+#define VCAN_BIT_TIMING_SIM             1
+#endif
+// </h>
+
+#endif /* VCAN_CONFIG_H_ */
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-Driver Validation
+ * Title:       Virtual Ethernet (vETH) configuration file
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef VETH_CONFIG_H_
+#define VETH_CONFIG_H_
+
+//-------- <<< Use Configuration Wizard in Context Menu >>> --------------------
+//------ With VS Code: Open Preview for Configuration Wizard -------------------
+
+// <h> Virtual Ethernet
+// <i> Driver_ETH_MAC and Driver_ETH_PHY instances connected to a memory loopback or a Linux TAP interface
+//   <o> Driver_ETH_MAC# and Driver_ETH_PHY# <0-255>
+//   <i> Driver instances used by the Driver Validation (DRV_ETH in DV_ETH_Config.h)
+#ifndef VETH_DRV_NUM
+#define VETH_DRV_NUM                    0
+#endif
+//   <o> Network <0=> Memory loopback <1=> TAP interface
+//   <i> Memory loopback: frames sent on the link are received back (like with an Ethernet loopback plug)
+//   <i> TAP interface: frames are exchanged with the Linux network stack
+#ifndef VETH_BACKEND
+#define VETH_BACKEND                    0
+#endif
+//     <s> TAP interface name
+//     <i> Interface must exist and be accessible (ip tuntap add dev <name> mode tap user <user>)
+#ifndef VETH_TAP_NAME
+#define VETH_TAP_NAME                   "dvtap0"
+#endif
+//   <o> Link speed <0=> 10 Mbps <1=> 100 Mbps <2=> 1 Gbps
+//   <i> Link speed resolved by the PHY auto-negotiation
+#ifndef VETH_LINK_SPEED
+#define VETH_LINK_SPEED                 2
+#endif
+//   <o> Transmit descriptors <1-256>
+//   <i> Frames queued for transmission (SendFrame returns ARM_DRIVER_ERROR_BUSY when all are used)
+#ifndef VETH_TX_DESC_NUM
+#define VETH_TX_DESC_NUM                8
+#endif
+//   <o> Receive descriptors <1-256>
+//   <i> Frames received and not yet read (further frames are dropped)
+#ifndef VETH_RX_DESC_NUM
+#define VETH_RX_DESC_NUM                16
+#endif
+//   <o> Multicast address filter entries <1-64>
+//   <i> SetAddressFilter with more addresses receives all multicast frames
+#ifndef VETH_MCAST_NUM
+#define VETH_MCAST_NUM                  32
+#endif
+//   <o> PHY address <0-31>
+#ifndef VETH_PHY_ADDR
+#define VETH_PHY_ADDR                   0
+#endif
+//   <q> Wire timing simulation
+//   <i> Enabled: frames are transmitted in the frame time at the configured MAC speed
+//   <i> Disabled: frames are transmitted as fast as possible (for profiling of test logic)
+#ifndef VETH_WIRE_SIM
+#define VETH_WIRE_SIM                   1
+#endif
+// </h>
+
+#endif /* VETH_CONFIG_H_ */
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-Driver Validation
+ * Title:       Virtual GPIO (vGPIO) configuration file
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef VGPIO_CONFIG_H_
+#define VGPIO_CONFIG_H_
+
+//-------- <<< Use Configuration Wizard in Context Menu >>> --------------------
+//------ With VS Code: Open Preview for Configuration Wizard -------------------
+
+// <h> Virtual GPIO
+// <i> Driver_GPIO instance with pins connected by wires (the DV_GPIO loopback resistor)
+//   <o> Driver_GPIO# <0-255>
+//   <i> Driver instance used by the Driver Validation (DRV_GPIO in DV_GPIO_Config.h)
+#ifndef VGPIO_DRV_NUM
+#define VGPIO_DRV_NUM                   0
+#endif
+//   <o> Number of pins <1-64>
+//   <i> Pins 0 .. n-1, unconnected pins read back their own level
+#ifndef VGPIO_PIN_NUM
+#define VGPIO_PIN_NUM                   16
+#endif
+//   <e> Wire 0
+//   <i> Connects Pin A and Pin B (a pin can be connected to more pins by several wires)
+#ifndef VGPIO_WIRE0_EN
+#define VGPIO_WIRE0_EN                  1
+#endif
+//     <s> Name
+//     <i> Wire name used in diagnostic messages
+#ifndef VGPIO_WIRE0_NAME
+#define VGPIO_WIRE0_NAME                "PUT-AUX"
+#endif
+//     <o> Pin A <0-63>
+#ifndef VGPIO_WIRE0_PIN_A
+#define VGPIO_WIRE0_PIN_A               0
+#endif
+//     <o> Pin B <0-63>
+#ifndef VGPIO_WIRE0_PIN_B
+#define VGPIO_WIRE0_PIN_B               1
+#endif
+//   </e>
+//   <e> Wire 1
+//   <i> Connects Pin A and Pin B (a pin can be connected to more pins by several wires)
+#ifndef VGPIO_WIRE1_EN
+#define VGPIO_WIRE1_EN                  0
+#endif
+//     <s> Name
+//     <i> Wire name used in diagnostic messages
+#ifndef VGPIO_WIRE1_NAME
+#define VGPIO_WIRE1_NAME                "WIRE1"
+#endif
+//     <o> Pin A <0-63>
+#ifndef VGPIO_WIRE1_PIN_A
+#define VGPIO_WIRE1_PIN_A               2
+#endif
+//     <o> Pin B <0-63>
+#ifndef VGPIO_WIRE1_PIN_B
+#define VGPIO_WIRE1_PIN_B               3
+#endif
+//   </e>
+//   <e> Wire 2
+//   <i> Connects Pin A and Pin B (a pin can be connected to more pins by several wires)
+#ifndef VGPIO_WIRE2_EN
+#define VGPIO_WIRE2_EN                  0
+#endif
+//     <s> Name
+//     <i> Wire name used in diagnostic messages
+#ifndef VGPIO_WIRE2_NAME
+#define VGPIO_WIRE2_NAME                "WIRE2"
+#endif
+//     <o> Pin A <0-63>
+#ifndef VGPIO_WIRE2_PIN_A
+#define VGPIO_WIRE2_PIN_A               4
+#endif
+//     <o> Pin B <0-63>
+#ifndef VGPIO_WIRE2_PIN_B
+#define VGPIO_WIRE2_PIN_B               5
+#endif
+//   </e>
+//   <e> Wire 3
+//   <i> Connects Pin A and Pin B (a pin can be connected to more pins by several wires)
+#ifndef VGPIO_WIRE3_EN
+#define VGPIO_WIRE3_EN                  0
+#endif
+//     <s> Name
+//     <i> Wire name used in diagnostic messages
+#ifndef VGPIO_WIRE3_NAME
+#define VGPIO_WIRE3_NAME                "WIRE3"
+#endif
+//     <o> Pin A <0-63>
+#ifndef VGPIO_WIRE3_PIN_A
+#define VGPIO_WIRE3_PIN_A               6
+#endif
+//     <o> Pin B <0-63>
+#ifndef VGPIO_WIRE3_PIN_B
+#define VGPIO_WIRE3_PIN_B               7
+#endif
+//   </e>
+//   <h> Event signaling
+//   <i> Events are signaled from the GPIO thread after the interrupt latency
+//   <i> (delay + random jitter); edges within the latency are merged into one event
+//     <o> Interrupt delay [us] <0-1000000>
+#ifndef VGPIO_IRQ_DELAY
+#define VGPIO_IRQ_DELAY                 5
+#endif
+//     <o> Interrupt jitter [us] <0-1000000>
+//     <i> Uniformly distributed additional delay 0 .. jitter
+#ifndef VGPIO_IRQ_JITTER
+#define VGPIO_IRQ_JITTER                0
+#endif
+//     <o> Jitter random seed <1-0xFFFFFFFF>
+//     <i> Same seed gives the same jitter sequence in every run
+#ifndef VGPIO_IRQ_SEED
+#define VGPIO_IRQ_SEED                  1
+#endif
+//   </h>
+// </h>
+
+#endif /* VGPIO_CONFIG_H_ */
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-Driver Validation
+ * Title:       Virtual SPI bus (vSPI) configuration file
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef VSPI_CONFIG_H_
+#define VSPI_CONFIG_H_
+
+//-------- <<< Use Configuration Wizard in Context Menu >>> --------------------
+//------ With VS Code: Open Preview for Configuration Wizard -------------------
+
+// <h> Virtual SPI Bus
+// <i> Two Driver_SPI instances connected by an in-process SPI bus (SCK, MOSI, MISO and Slave Select)
+//   <o> Driver_SPI# of bus end A <0-255>
+//   <i> Driver instance used by the Driver Validation (DRV_SPI in DV_SPI_Config.h)
+#ifndef VSPI_DRV_NUM_A
+#define VSPI_DRV_NUM_A                  0
+#endif
+//   <o> Driver_SPI# of bus end B <0-255>
+//   <i> Driver instance used by the SPI Server
+#ifndef VSPI_DRV_NUM_B
+#define VSPI_DRV_NUM_B                  1
+#endif
+//   <o> Minimum bus speed [bps] <1000-100000000>
+//   <i> Master mode bus speeds below this value are rejected by the Control function
+#ifndef VSPI_BUS_SPEED_MIN
+#define VSPI_BUS_SPEED_MIN              10000
+#endif
+//   <o> Maximum bus speed [bps] <1000-100000000>
+//   <i> Master mode bus speeds above this value are rejected by the Control function
+#ifndef VSPI_BUS_SPEED_MAX
+#define VSPI_BUS_SPEED_MAX              50000000
+#endif
+//   <q> Bus clock simulation
+//   <i> Enabled: data items are shifted at the configured master bus speed (transfer takes data bits / bus speed per item)
+//   <i> Disabled: transfers complete as fast as possible (for profiling of test and server logic)
+#ifndef VSPI_CLOCK_SIM
+#define VSPI_CLOCK_SIM                  1
+#endif
+// </h>
+
+#endif /* VSPI_CONFIG_H_ */
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-Driver Validation
+ * Title:       Virtual USART (vUSART) configuration file
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef VUSART_CONFIG_H_
+#define VUSART_CONFIG_H_
+
+//-------- <<< Use Configuration Wizard in Context Menu >>> --------------------
+//------ With VS Code: Open Preview for Configuration Wizard -------------------
+
+// <h> Virtual USART
+// <i> Two Driver_USART instances connected by a pseudo-terminal pair (TX, RX, RTS/CTS, DTR/DSR, DCD and RI lines)
+//   <o> Driver_USART# of line end A <0-255>
+//   <i> Driver instance used by the Driver Validation (DRV_USART in DV_USART_Config.h)
+#ifndef VUSART_DRV_NUM_A
+#define VUSART_DRV_NUM_A                0
+#endif
+//   <o> Driver_USART# of line end B <0-255>
+//   <i> Driver instance used by the USART Server
+#ifndef VUSART_DRV_NUM_B
+#define VUSART_DRV_NUM_B                1
+#endif
+//   <o> Minimum baudrate [bps] <50-4000000>
+//   <i> Baudrates below this value are rejected by the Control function
+#ifndef VUSART_BAUDRATE_MIN
+#define VUSART_BAUDRATE_MIN             1200
+#endif
+//   <o> Maximum baudrate [bps] <50-4000000>
+//   <i> Baudrates above this value are rejected by the Control function
+#ifndef VUSART_BAUDRATE_MAX
+#define VUSART_BAUDRATE_MAX             4000000
+#endif
+//   <o> Receive timeout [character times] <1-255>
+//   <i> Idle time after a received character which signals ARM_USART_EVENT_RX_TIMEOUT
+#ifndef VUSART_RX_TIMEOUT
+#define VUSART_RX_TIMEOUT               4
+#endif
+//   <q> Baudrate timing simulation
+//   <i> Enabled: characters are sent at the configured baudrate (character takes frame bits / baudrate)
+//   <i> Disabled: characters are sent as fast as possible (for profiling of test and server logic)
+#ifndef VUSART_CLOCK_SIM
+#define VUSART_CLOCK_SIM                1
+#endif
+//   <e> Serial device for line end A
+//   <i> Line end A uses a serial device instead of the pseudo-terminal, line end B is not available
+//   <i> (for example an USB to serial adapter connected to an USART Server on target hardware)
+#ifndef VUSART_TTY_EN
+#define VUSART_TTY_EN                   0
+#endif
+//     <s> Device path
+#ifndef VUSART_TTY_DEV
+#define VUSART_TTY_DEV                  "/dev/ttyUSB0"
+#endif
+//   </e>
+// </h>
+
+#endif /* VUSART_CONFIG_H_ */
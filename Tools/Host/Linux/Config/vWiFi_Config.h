@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-Driver Validation
+ * Title:       Virtual WiFi (vWiFi) configuration file
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef VWIFI_CONFIG_H_
+#define VWIFI_CONFIG_H_
+
+//-------- <<< Use Configuration Wizard in Context Menu >>> --------------------
+//------ With VS Code: Open Preview for Configuration Wizard -------------------
+
+// <h> Virtual WiFi
+// <i> Driver_WiFi instance (station) with the socket functions on Linux BSD sockets
+//   <o> Driver_WiFi# <0-255>
+//   <i> Driver instance used by the Driver Validation (DRV_WIFI in DV_WiFi_Config.h)
+#ifndef VWIFI_DRV_NUM
+#define VWIFI_DRV_NUM                   0
+#endif
+
+//   <h> Access Point
+//   <i> Simulated access point returned by Scan, Activate connects only with matching credentials
+//     <s.32> SSID
+#ifndef VWIFI_AP_SSID
+#define VWIFI_AP_SSID                   "SSID"
+#endif
+//     <s.64> Password
+#ifndef VWIFI_AP_PASS
+#define VWIFI_AP_PASS                   "Password"
+#endif
+//     <o> Security Type <0=> Open <1=> WEP <2=> WPA <3=> WPA2
+#ifndef VWIFI_AP_SECURITY
+#define VWIFI_AP_SECURITY               3
+#endif
+//     <o> Channel <1-165>
+#ifndef VWIFI_AP_CH
+#define VWIFI_AP_CH                     6
+#endif
+//     <o> Signal strength (RSSI) <1-255>
+#ifndef VWIFI_AP_RSSI
+#define VWIFI_AP_RSSI                   60
+#endif
+//     <s.17> BSSID
+//     <i> MAC address of the access point (format: xx-xx-xx-xx-xx-xx)
+#ifndef VWIFI_AP_BSSID
+#define VWIFI_AP_BSSID                  "02-44-56-00-00-01"
+#endif
+//   </h>
+
+//   <h> Station
+//     <s.15> IP address
+//     <i> Local address of the sockets (unspecified address binds and source address of connections),
+//     <i> a loopback address other than the SockServer address separates the ports of both ends
+//     <i> 0.0.0.0: sockets use the addresses selected by Linux
+#ifndef VWIFI_STA_IP
+#define VWIFI_STA_IP                    "127.0.0.2"
+#endif
+//     <s.17> MAC address
+//     <i> Value of option ARM_WIFI_MAC (format: xx-xx-xx-xx-xx-xx)
+#ifndef VWIFI_STA_MAC
+#define VWIFI_STA_MAC                   "02-44-56-00-00-02"
+#endif
+//   </h>
+
+//   <o> Number of sockets <1-64>
+//   <i> SocketCreate and SocketAccept return ARM_SOCKET_ENOMEM when all sockets are used
+#ifndef VWIFI_SOCKET_NUM
+#define VWIFI_SOCKET_NUM                8
+#endif
+//   <o> Connect timeout [ms] <100-60000>
+//   <i> SocketConnect returns ARM_SOCKET_ETIMEDOUT when the connection is not established in time
+#ifndef VWIFI_CONNECT_TIMEOUT
+#define VWIFI_CONNECT_TIMEOUT           10000
+#endif
+//   <o> Ping timeout [ms] <100-60000>
+#ifndef VWIFI_PING_TIMEOUT
+#define VWIFI_PING_TIMEOUT              2000
+#endif
+//   <o> Link rate [kbit/s] <0-10000000>
+//   <i> Data sent and received on sockets is paced to the link rate of a WiFi module (0: not limited)
+//   <i> Default: 65000 (802.11n, one spatial stream, 20 MHz channel)
+#ifndef VWIFI_RATE_MAX
+#define VWIFI_RATE_MAX                  65000
+#endif
+// </h>
+
+#endif /* VWIFI_CONFIG_H_ */
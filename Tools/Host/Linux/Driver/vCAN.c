@@ -0,0 +1,1122 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-Driver Validation
+ * Title:       Virtual CAN (vCAN) CMSIS-Driver for the Linux host
+ * Purpose:     Driver_CAN instance with:
+ *               - transmit objects with FIFO, transmitted by ID priority
+ *                 (bus arbitration)
+ *               - receive objects with FIFO and exact, range and mask filters
+ *               - CAN FD with bit rate switching
+ *               - bit timing obeying SetBitrate (frame time at the nominal
+ *                 and data bitrate)
+ *               - internal loopback, external loopback, normal and monitor
+ *                 mode
+ *
+ *              The bus is a Linux SocketCAN interface (VCAN_BACKEND), for
+ *              example vcan0 or an USB to CAN adapter. Without bus only the
+ *              internal loopback mode transfers messages.
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#define _GNU_SOURCE
+
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/prctl.h>
+#include <sys/socket.h>
+#include <net/if.h>
+#include <linux/can.h>
+#include <linux/can/raw.h>
+
+#include "Driver_CAN.h"
+#include "vCAN_Config.h"
+
+#define ARM_CAN_DRV_VERSION ARM_DRIVER_VERSION_MAJOR_MINOR(1, 0)
+
+/* CAN flags */
+#define VCAN_FLAG_INIT          (1U << 0)       /* Driver initialized         */
+#define VCAN_FLAG_POWER         (1U << 1)       /* Driver powered             */
+
+/* Pending events */
+#define VCAN_PEND_UNIT          (1U << 0)       /* Unit event                 */
+#define VCAN_PEND_OBJ           (1U << 1)       /* Object events              */
+
+#define VCAN_OBJ_NUM            (VCAN_TX_OBJ_NUM + VCAN_RX_OBJ_NUM)
+#define VCAN_BITRATE_MAX        1000000U        /* Maximum nominal bitrate    */
+#define VCAN_BITRATE_FD_MAX     12000000U       /* Maximum FD data bitrate    */
+
+/* Message */
+typedef struct {
+  uint64_t        t;                    /* Time queued for transmission [ns]  */
+  uint32_t        id;                   /* Identifier (ARM_CAN_xxx_ID)        */
+  uint8_t         rtr;                  /* Remote frame                       */
+  uint8_t         edl;                  /* CAN FD frame                       */
+  uint8_t         brs;                  /* Bit rate switching                 */
+  uint8_t         len;                  /* Data length (DLC of remote frames) */
+  uint8_t         data[64];             /* Data                               */
+} VCAN_MSG;
+
+/* Receive filter */
+typedef struct {
+  uint32_t        op;                   /* ARM_CAN_FILTER_ID_xxx_ADD          */
+  uint32_t        id;                   /* Identifier                         */
+  uint32_t        arg;                  /* Range end or mask                  */
+} VCAN_FILTER;
+
+/* Message object */
+typedef struct {
+  uint32_t        cfg;                  /* ARM_CAN_OBJ_CONFIG                 */
+  VCAN_MSG       *fifo;                 /* Message FIFO                       */
+  uint32_t        depth;                /* Message FIFO depth                 */
+  uint32_t        idx;                  /* First message in FIFO              */
+  uint32_t        num;                  /* Messages in FIFO                   */
+  uint32_t        event;                /* Events pending to be signaled      */
+  uint32_t        filter_num;           /* Filters used                       */
+  VCAN_FILTER     filter[VCAN_FILTER_NUM]; /* Receive filters                 */
+} VCAN_OBJ;
+
+/* CAN information */
+typedef struct {
+  pthread_mutex_t mutex;                /* CAN lock                           */
+  ARM_CAN_SignalUnitEvent_t   cb_unit_event;   /* Unit event callback         */
+  ARM_CAN_SignalObjectEvent_t cb_object_event; /* Object event callback       */
+  uint32_t        flags;                /* Driver flags                       */
+  int             sock;                 /* SocketCAN socket (-1: none)        */
+  int             wake[2];              /* CAN thread wake-up pipe            */
+  uint32_t        mode;                 /* ARM_CAN_MODE                       */
+  uint32_t        fd_mode;              /* CAN FD mode                        */
+  uint32_t        bitrate;              /* Nominal bitrate [bps]              */
+  uint32_t        bitrate_fd;           /* FD data bitrate [bps]              */
+  int32_t         tx_obj;               /* Object transmitting (-1: none)     */
+  uint64_t        tx_end;               /* End of transmission [ns]           */
+  uint64_t        bus_free;             /* Bus idle after this time [ns]      */
+  uint32_t        lec;                  /* Last error code                    */
+  uint32_t        unit_event;           /* Unit event pending to be signaled  */
+  uint32_t        pending;              /* Pending events (VCAN_PEND_x)       */
+  VCAN_OBJ        obj[VCAN_OBJ_NUM];    /* Message objects                    */
+  VCAN_MSG        tx_fifo[VCAN_TX_OBJ_NUM][VCAN_TX_FIFO_DEPTH];
+  VCAN_MSG        rx_fifo[VCAN_RX_OBJ_NUM][VCAN_RX_FIFO_DEPTH];
+} VCAN_DEV;
+
+static VCAN_DEV       vcan = {
+  .mutex = PTHREAD_MUTEX_INITIALIZER,
+  .sock  = -1,
+  .wake  = { -1, -1 }
+};
+static pthread_once_t vcan_once = PTHREAD_ONCE_INIT;
+
+/* CAN FD data length of DLC codes 9 to 15 */
+static const uint8_t vcan_fd_len[7] = { 12U, 16U, 20U, 24U, 32U, 48U, 64U };
+
+static const ARM_DRIVER_VERSION DriverVersion = {
+  ARM_CAN_API_VERSION,
+  ARM_CAN_DRV_VERSION
+};
+
+static const ARM_CAN_CAPABILITIES DriverCapabilities = {
+  VCAN_OBJ_NUM,                         /* num_objects                        */
+  1U,                                   /* reentrant_operation                */
+  1U,                                   /* fd_mode                            */
+  0U,                                   /* restricted_mode                    */
+  1U,                                   /* monitor_mode                       */
+  1U,                                   /* internal_loopback                  */
+  (VCAN_BACKEND != 0) ? 1U : 0U,        /* external_loopback                  */
+  0U
+};
+
+/*-----------------------------------------------------------------------------
+ * Lock CAN (thread cancellation is disabled while locked)
+ *----------------------------------------------------------------------------*/
+static int VCAN_Lock (VCAN_DEV *can) {
+  int cancel;
+
+  (void)pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &cancel);
+  (void)pthread_mutex_lock(&can->mutex);
+  return (cancel);
+}
+
+/*-----------------------------------------------------------------------------
+ * Unlock CAN and signal pending events
+ * (callbacks are called unlocked, like from the interrupt of the device)
+ *----------------------------------------------------------------------------*/
+static void VCAN_Unlock (VCAN_DEV *can, int cancel) {
+  ARM_CAN_SignalUnitEvent_t   cb_unit_event;
+  ARM_CAN_SignalObjectEvent_t cb_object_event;
+  uint32_t                    event[VCAN_OBJ_NUM];
+  uint32_t                    unit_event, pending, i;
+
+  cb_unit_event   = can->cb_unit_event;
+  cb_object_event = can->cb_object_event;
+  pending         = can->pending;
+  unit_event      = can->unit_event;
+  can->pending    = 0U;
+  if ((pending & VCAN_PEND_OBJ) != 0U) {
+    for (i = 0U; i < VCAN_OBJ_NUM; i++) {
+      event[i]          = can->obj[i].event;
+      can->obj[i].event = 0U;
+    }
+  }
+  (void)pthread_mutex_unlock(&can->mutex);
+
+  if (((pending & VCAN_PEND_UNIT) != 0U) && (cb_unit_event != NULL)) {
+    cb_unit_event(unit_event);
+  }
+  if (((pending & VCAN_PEND_OBJ) != 0U) && (cb_object_event != NULL)) {
+    for (i = 0U; i < VCAN_OBJ_NUM; i++) {
+      if (event[i] != 0U) {
+        cb_object_event(i, event[i]);
+      }
+    }
+  }
+  (void)pthread_setcancelstate(cancel, NULL);
+}
+
+/*-----------------------------------------------------------------------------
+ * Wake up CAN thread (transmit queue or mode changed)
+ *----------------------------------------------------------------------------*/
+static void VCAN_Wake (const VCAN_DEV *can) {
+  uint8_t val = 0U;
+
+  (void)write(can->wake[1], &val, 1U);
+}
+
+/*-----------------------------------------------------------------------------
+ * Get monotonic time in nanoseconds
+ *----------------------------------------------------------------------------*/
+static uint64_t VCAN_Time (void) {
+  struct timespec now;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &now);
+  return (((uint64_t)now.tv_sec * 1000000000U) + (uint64_t)now.tv_nsec);
+}
+
+/*-----------------------------------------------------------------------------
+ * Signal object event
+ *----------------------------------------------------------------------------*/
+static void VCAN_ObjEvent (VCAN_DEV *can, uint32_t obj_idx, uint32_t event) {
+
+  can->obj[obj_idx].event |= event;
+  can->pending            |= VCAN_PEND_OBJ;
+}
+
+/*-----------------------------------------------------------------------------
+ * Signal unit event
+ *----------------------------------------------------------------------------*/
+static void VCAN_UnitEvent (VCAN_DEV *can, uint32_t event) {
+
+  can->unit_event = event;
+  can->pending   |= VCAN_PEND_UNIT;
+}
+
+/*-----------------------------------------------------------------------------
+ * Get frame time of a message [ns]
+ * (bit stuffing is not counted, like in the DV_CAN bitrate check)
+ *----------------------------------------------------------------------------*/
+static uint64_t VCAN_FrameTime (const VCAN_DEV *can, const VCAN_MSG *msg) {
+  uint32_t ext, len, nom, dat;
+
+  ext = ((msg->id & ARM_CAN_ID_IDE_Msk) != 0U) ? 1U : 0U;
+  len = (msg->rtr != 0U) ? 0U : msg->len;
+
+  if (msg->edl == 0U) {
+    // SOF, arbitration, control, data, CRC, delimiters, ACK, EOF and intermission
+    nom = ((ext != 0U) ? 67U : 47U) + (len * 8U);
+    dat = 0U;
+  } else {
+    // Arbitration and control field up to BRS and ACK, EOF and intermission at nominal bitrate,
+    // ESI, DLC, data, stuff count, CRC and CRC delimiter at data bitrate (with bit rate switching)
+    nom = ((ext != 0U) ? 36U : 17U) + 12U;
+    dat = 5U + (len * 8U) + ((len > 16U) ? 25U : 21U) + 1U;
+    if (msg->brs == 0U) {
+      nom += dat;
+      dat  = 0U;
+    }
+  }
+
+  return (((uint64_t)nom * 1000000000U) / can->bitrate) + (((uint64_t)dat * 1000000000U) / can->bitrate_fd);
+}
+
+/*-----------------------------------------------------------------------------
+ * Check message identifier against the filters of a receive object
+ *----------------------------------------------------------------------------*/
+static uint32_t VCAN_FilterMatch (const VCAN_OBJ *obj, uint32_t id) {
+  const VCAN_FILTER *f;
+  uint32_t           i;
+
+  for (i = 0U; i < obj->filter_num; i++) {
+    f = &obj->filter[i];
+    switch (f->op) {
+      case ARM_CAN_FILTER_ID_EXACT_ADD:
+        if (id == f->id) {
+          return (1U);
+        }
+        break;
+      case ARM_CAN_FILTER_ID_RANGE_ADD:
+        if (((id & ARM_CAN_ID_IDE_Msk) == (f->id & ARM_CAN_ID_IDE_Msk)) && (id >= f->id) && (id <= f->arg)) {
+          return (1U);
+        }
+        break;
+      case ARM_CAN_FILTER_ID_MASKABLE_ADD:
+        if (((id ^ f->id) & (f->arg | ARM_CAN_ID_IDE_Msk)) == 0U) {
+          return (1U);
+        }
+        break;
+      default:
+        break;
+    }
+  }
+  return (0U);
+}
+
+/*-----------------------------------------------------------------------------
+ * Receive a message from the bus: stored by the first receive object with
+ * matching filter
+ *----------------------------------------------------------------------------*/
+static void VCAN_Receive (VCAN_DEV *can, const VCAN_MSG *msg) {
+  VCAN_OBJ *obj;
+  uint32_t  i;
+
+  if ((msg->edl != 0U) && (can->fd_mode == 0U)) {
+    return;                             // CAN FD frame is a format error for a classic controller
+  }
+
+  for (i = VCAN_TX_OBJ_NUM; i < VCAN_OBJ_NUM; i++) {
+    obj = &can->obj[i];
+    if ((obj->cfg != ARM_CAN_OBJ_RX) || (VCAN_FilterMatch(obj, msg->id) == 0U)) {
+      continue;
+    }
+    if (obj->num == obj->depth) {
+      VCAN_ObjEvent(can, i, ARM_CAN_EVENT_RECEIVE_OVERRUN);
+    } else {
+      obj->fifo[(obj->idx + obj->num) % obj->depth] = *msg;
+      obj->num++;
+      VCAN_ObjEvent(can, i, ARM_CAN_EVENT_RECEIVE);
+    }
+    break;
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ * Write a message to the SocketCAN interface (returns 0 on success)
+ *----------------------------------------------------------------------------*/
+static int VCAN_SocketWrite (const VCAN_DEV *can, const VCAN_MSG *msg) {
+  struct canfd_frame frame;
+  size_t             size;
+
+  memset(&frame, 0, sizeof(frame));
+  if ((msg->id & ARM_CAN_ID_IDE_Msk) != 0U) {
+    frame.can_id = (msg->id & CAN_EFF_MASK) | CAN_EFF_FLAG;
+  } else {
+    frame.can_id =  msg->id & CAN_SFF_MASK;
+  }
+  if (msg->rtr != 0U) {
+    frame.can_id |= CAN_RTR_FLAG;
+  }
+  frame.len = msg->len;
+  if (msg->edl != 0U) {
+#ifdef CANFD_FDF
+    frame.flags = CANFD_FDF;
+#endif
+    if (msg->brs != 0U) {
+      frame.flags |= CANFD_BRS;
+    }
+    size = CANFD_MTU;
+  } else {
+    size = CAN_MTU;
+  }
+  if (msg->rtr == 0U) {
+    memcpy(frame.data, msg->data, msg->len);
+  }
+
+  return ((write(can->sock, &frame, size) == (ssize_t)size) ? 0 : -1);
+}
+
+/*-----------------------------------------------------------------------------
+ * Read messages received by the SocketCAN interface
+ *----------------------------------------------------------------------------*/
+static void VCAN_SocketRead (VCAN_DEV *can) {
+  struct canfd_frame frame;
+  VCAN_MSG           msg;
+  ssize_t            n;
+  uint32_t           i, rx_en;
+
+  // Messages from the bus are not received in initialization and internal loopback mode
+  rx_en = ((can->mode == ARM_CAN_MODE_NORMAL) || (can->mode == ARM_CAN_MODE_MONITOR) ||
+           (can->mode == ARM_CAN_MODE_LOOPBACK_EXTERNAL)) ? 1U : 0U;
+
+  // Limited number of messages per call, so the driver functions are not blocked by traffic
+  for (i = 0U; i < 64U; i++) {
+    n = read(can->sock, &frame, sizeof(frame));
+    if (n <= 0) {
+      break;
+    }
+    if ((rx_en == 0U) || ((n != (ssize_t)CAN_MTU) && (n != (ssize_t)CANFD_MTU))) {
+      continue;
+    }
+    if ((frame.can_id & CAN_EFF_FLAG) != 0U) {
+      msg.id = ARM_CAN_EXTENDED_ID(frame.can_id & CAN_EFF_MASK);
+    } else {
+      msg.id = ARM_CAN_STANDARD_ID(frame.can_id & CAN_SFF_MASK);
+    }
+    msg.rtr = ((frame.can_id & CAN_RTR_FLAG) != 0U) ? 1U : 0U;
+    msg.edl = (n == (ssize_t)CANFD_MTU) ? 1U : 0U;
+    msg.brs = ((msg.edl != 0U) && ((frame.flags & CANFD_BRS) != 0U)) ? 1U : 0U;
+    msg.len = (frame.len > 64U) ? 64U : frame.len;
+    memcpy(msg.data, frame.data, msg.len);
+    VCAN_Receive(can, &msg);
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ * Complete transmission of the message of the transmitting object
+ *----------------------------------------------------------------------------*/
+static void VCAN_TxComplete (VCAN_DEV *can) {
+  VCAN_OBJ *obj;
+  VCAN_MSG *msg;
+  uint32_t  lec;
+
+  obj = &can->obj[can->tx_obj];
+  msg = &obj->fifo[obj->idx];
+  lec = ARM_CAN_LEC_NO_ERROR;
+
+  if (can->mode == ARM_CAN_MODE_LOOPBACK_INTERNAL) {
+    VCAN_Receive(can, msg);
+  } else if (can->sock >= 0) {
+    // External loopback receives the own message back from the interface
+    if (VCAN_SocketWrite(can, msg) != 0) {
+      lec = ARM_CAN_LEC_BIT_ERROR;
+    }
+  } else {
+    // No bus: message is not acknowledged
+    lec = ARM_CAN_LEC_ACK_ERROR;
+  }
+
+  obj->idx = (obj->idx + 1U) % obj->depth;
+  obj->num--;
+  if (lec == ARM_CAN_LEC_NO_ERROR) {
+    VCAN_ObjEvent(can, (uint32_t)can->tx_obj, ARM_CAN_EVENT_SEND_COMPLETE);
+  }
+  can->lec      = lec;
+  can->bus_free = can->tx_end;
+  can->tx_obj   = -1;
+}
+
+/*-----------------------------------------------------------------------------
+ * Get arbitration priority of a message (lower value wins)
+ *----------------------------------------------------------------------------*/
+static uint32_t VCAN_Priority (const VCAN_MSG *msg) {
+  uint32_t id;
+
+  if ((msg->id & ARM_CAN_ID_IDE_Msk) != 0U) {
+    // Base identifier, recessive SRR and IDE, identifier extension
+    id = msg->id & 0x1FFFFFFFU;
+    return (((id >> 18) << 20) | (3U << 18) | (id & 0x3FFFFU));
+  }
+  // Identifier, RTR (dominant for data frames) and dominant IDE
+  return ((msg->id << 20) | ((uint32_t)msg->rtr << 19));
+}
+
+/*-----------------------------------------------------------------------------
+ * Update CAN: complete transmission and start next transmission
+ * (returns monotonic time of the next update or 0 if not needed)
+ *----------------------------------------------------------------------------*/
+static uint64_t VCAN_Update (VCAN_DEV *can) {
+  VCAN_OBJ *obj;
+  VCAN_MSG *msg;
+  uint64_t  now, t;
+  uint32_t  prio, best_prio, i;
+  int32_t   best;
+
+  now = VCAN_Time();
+
+  for (;;) {
+    if (can->tx_obj >= 0) {
+      if ((VCAN_BIT_TIMING_SIM != 0) && (now < can->tx_end)) {
+        return (can->tx_end);
+      }
+      VCAN_TxComplete(can);
+    }
+
+    if ((can->mode != ARM_CAN_MODE_NORMAL) && (can->mode != ARM_CAN_MODE_LOOPBACK_INTERNAL) &&
+        (can->mode != ARM_CAN_MODE_LOOPBACK_EXTERNAL)) {
+      break;
+    }
+
+    // Arbitration: message with the highest priority of all transmit objects is sent next
+    best      = -1;
+    best_prio = 0U;
+    for (i = 0U; i < VCAN_TX_OBJ_NUM; i++) {
+      obj = &can->obj[i];
+      if ((obj->cfg == ARM_CAN_OBJ_TX) && (obj->num != 0U)) {
+        prio = VCAN_Priority(&obj->fifo[obj->idx]);
+        if ((best < 0) || (prio < best_prio)) {
+          best      = (int32_t)i;
+          best_prio = prio;
+        }
+      }
+    }
+    if (best < 0) {
+      break;
+    }
+
+    obj = &can->obj[best];
+    msg = &obj->fifo[obj->idx];
+    t   = (can->bus_free > msg->t) ? can->bus_free : msg->t;
+    can->tx_obj = best;
+    can->tx_end = t + VCAN_FrameTime(can, msg);
+  }
+
+  return (0U);
+}
+
+/*-----------------------------------------------------------------------------
+ * CAN thread: completes transmission in time and receives messages from the
+ * SocketCAN interface
+ *----------------------------------------------------------------------------*/
+static void *VCAN_Thread (void *arg) {
+  VCAN_DEV        *can = (VCAN_DEV *)arg;
+  struct pollfd    fds[2];
+  struct timespec  ts;
+  uint8_t          buf[64];
+  uint64_t         next, now;
+  int              cancel;
+
+  // Frame times are down to some microseconds: no timer slack (default 50 us)
+  (void)prctl(PR_SET_TIMERSLACK, 1UL);
+
+  fds[0].fd      = -1;
+  fds[0].events  = POLLIN;
+  fds[0].revents = 0;
+  fds[1].fd      = can->wake[0];
+  fds[1].events  = POLLIN;
+  fds[1].revents = 0;
+
+  for (;;) {
+    if ((fds[1].revents & POLLIN) != 0) {
+      while (read(can->wake[0], buf, sizeof(buf)) > 0) {}
+    }
+
+    cancel = VCAN_Lock(can);
+    if (((fds[0].revents & POLLIN) != 0) && (can->sock >= 0) && (fds[0].fd == can->sock)) {
+      VCAN_SocketRead(can);
+    }
+    next      = VCAN_Update(can);
+    fds[0].fd = can->sock;
+    VCAN_Unlock(can, cancel);
+
+    if (next != 0U) {
+      now = VCAN_Time();
+      next = (next > now) ? (next - now) : 0U;
+      ts.tv_sec  = (time_t)(next / 1000000000U);
+      ts.tv_nsec = (long)(next % 1000000000U);
+      (void)ppoll(fds, 2U, &ts, NULL);
+    } else {
+      (void)ppoll(fds, 2U, NULL, NULL);
+    }
+  }
+
+  return (NULL);
+}
+
+/*-----------------------------------------------------------------------------
+ * Set up message objects and start CAN thread, executed once
+ *----------------------------------------------------------------------------*/
+static void VCAN_Init (void) {
+  pthread_t thread;
+  uint32_t  i;
+
+  for (i = 0U; i < VCAN_TX_OBJ_NUM; i++) {
+    vcan.obj[i].fifo  = vcan.tx_fifo[i];
+    vcan.obj[i].depth = VCAN_TX_FIFO_DEPTH;
+  }
+  for (i = 0U; i < VCAN_RX_OBJ_NUM; i++) {
+    vcan.obj[VCAN_TX_OBJ_NUM + i].fifo  = vcan.rx_fifo[i];
+    vcan.obj[VCAN_TX_OBJ_NUM + i].depth = VCAN_RX_FIFO_DEPTH;
+  }
+  vcan.tx_obj = -1;
+
+  if (pipe2(vcan.wake, O_NONBLOCK | O_CLOEXEC) != 0) {
+    vcan.wake[0] = -1;
+    return;
+  }
+  if (pthread_create(&thread, NULL, VCAN_Thread, &vcan) != 0) {
+    (void)close(vcan.wake[0]);
+    (void)close(vcan.wake[1]);
+    vcan.wake[0] = -1;
+    return;
+  }
+  (void)pthread_detach(thread);
+}
+
+/*-----------------------------------------------------------------------------
+ * Open SocketCAN interface VCAN_IF_NAME (returns socket or -1)
+ *----------------------------------------------------------------------------*/
+static int VCAN_SocketOpen (void) {
+  struct sockaddr_can addr;
+  struct ifreq        ifr;
+  int                 sock, on;
+
+  sock = socket(PF_CAN, SOCK_RAW | SOCK_NONBLOCK | SOCK_CLOEXEC, CAN_RAW);
+  if (sock < 0) {
+    return (-1);
+  }
+  memset(&ifr, 0, sizeof(ifr));
+  strncpy(ifr.ifr_name, VCAN_IF_NAME, IFNAMSIZ - 1);
+  if (ioctl(sock, SIOCGIFINDEX, &ifr) != 0) {
+    (void)close(sock);
+    return (-1);
+  }
+  memset(&addr, 0, sizeof(addr));
+  addr.can_family  = AF_CAN;
+  addr.can_ifindex = ifr.ifr_ifindex;
+  if (bind(sock, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+    (void)close(sock);
+    return (-1);
+  }
+  // CAN FD frames are not available on classic CAN interfaces
+  on = 1;
+  (void)setsockopt(sock, SOL_CAN_RAW, CAN_RAW_FD_FRAMES, &on, sizeof(on));
+  return (sock);
+}
+
+/*-----------------------------------------------------------------------------
+ * Clear message objects
+ *----------------------------------------------------------------------------*/
+static void VCAN_ObjReset (VCAN_DEV *can) {
+  uint32_t i;
+
+  for (i = 0U; i < VCAN_OBJ_NUM; i++) {
+    can->obj[i].cfg        = ARM_CAN_OBJ_INACTIVE;
+    can->obj[i].idx        = 0U;
+    can->obj[i].num        = 0U;
+    can->obj[i].event      = 0U;
+    can->obj[i].filter_num = 0U;
+  }
+  can->tx_obj = -1;
+}
+
+/* Driver functions */
+
+static ARM_DRIVER_VERSION CAN_GetVersion (void) {
+  return DriverVersion;
+}
+
+static ARM_CAN_CAPABILITIES CAN_GetCapabilities (void) {
+  return DriverCapabilities;
+}
+
+static int32_t CAN_Initialize (ARM_CAN_SignalUnitEvent_t cb_unit_event, ARM_CAN_SignalObjectEvent_t cb_object_event) {
+  VCAN_DEV *can = &vcan;
+  int       cancel;
+
+  (void)pthread_once(&vcan_once, VCAN_Init);
+  if (can->wake[0] < 0) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  cancel = VCAN_Lock(can);
+  can->cb_unit_event   = cb_unit_event;
+  can->cb_object_event = cb_object_event;
+  can->flags          |= VCAN_FLAG_INIT;
+  VCAN_Unlock(can, cancel);
+
+  return ARM_DRIVER_OK;
+}
+
+static int32_t CAN_PowerControl (ARM_POWER_STATE state) {
+  VCAN_DEV *can = &vcan;
+  int32_t   ret;
+  int       cancel;
+
+  cancel = VCAN_Lock(can);
+  switch (state) {
+    case ARM_POWER_OFF:
+      if (can->sock >= 0) {
+        (void)close(can->sock);
+        can->sock = -1;
+      }
+      VCAN_ObjReset(can);
+      can->flags  &= ~VCAN_FLAG_POWER;
+      can->mode    = ARM_CAN_MODE_INITIALIZATION;
+      can->fd_mode = 0U;
+      can->pending = 0U;
+      VCAN_Wake(can);
+      ret = ARM_DRIVER_OK;
+      break;
+
+    case ARM_POWER_FULL:
+      if ((can->flags & VCAN_FLAG_INIT) == 0U) {
+        ret = ARM_DRIVER_ERROR;
+        break;
+      }
+      if ((can->flags & VCAN_FLAG_POWER) == 0U) {
+        if (VCAN_BACKEND != 0) {
+          can->sock = VCAN_SocketOpen();
+          if (can->sock < 0) {
+            ret = ARM_DRIVER_ERROR;
+            break;
+          }
+          VCAN_Wake(can);
+        }
+        VCAN_ObjReset(can);
+        can->flags     |= VCAN_FLAG_POWER;
+        can->mode       = ARM_CAN_MODE_INITIALIZATION;
+        can->fd_mode    = 0U;
+        can->bitrate    = 500000U;
+        can->bitrate_fd = 500000U;
+        can->bus_free   = 0U;
+        can->lec        = ARM_CAN_LEC_NO_ERROR;
+      }
+      ret = ARM_DRIVER_OK;
+      break;
+
+    case ARM_POWER_LOW:
+    default:
+      ret = ARM_DRIVER_ERROR_UNSUPPORTED;
+      break;
+  }
+  VCAN_Unlock(can, cancel);
+
+  return ret;
+}
+
+static int32_t CAN_Uninitialize (void) {
+  VCAN_DEV *can = &vcan;
+  int       cancel;
+
+  (void)CAN_PowerControl(ARM_POWER_OFF);
+
+  cancel = VCAN_Lock(can);
+  can->cb_unit_event   = NULL;
+  can->cb_object_event = NULL;
+  can->flags           = 0U;
+  VCAN_Unlock(can, cancel);
+
+  return ARM_DRIVER_OK;
+}
+
+static uint32_t CAN_GetClock (void) {
+  return VCAN_CLOCK;
+}
+
+static int32_t CAN_SetBitrate (ARM_CAN_BITRATE_SELECT select, uint32_t bitrate, uint32_t bit_segments) {
+  VCAN_DEV *can = &vcan;
+  uint32_t  prop, ph1, ph2, sjw, tq, max, fd;
+  int32_t   ret;
+  int       cancel;
+
+  if ((select != ARM_CAN_BITRATE_NOMINAL) && (select != ARM_CAN_BITRATE_FD_DATA)) {
+    return ARM_CAN_INVALID_BITRATE_SELECT;
+  }
+  fd   = (select == ARM_CAN_BITRATE_FD_DATA) ? 1U : 0U;
+  prop = (bit_segments & ARM_CAN_BIT_PROP_SEG_Msk)   >> ARM_CAN_BIT_PROP_SEG_Pos;
+  ph1  = (bit_segments & ARM_CAN_BIT_PHASE_SEG1_Msk) >> ARM_CAN_BIT_PHASE_SEG1_Pos;
+  ph2  = (bit_segments & ARM_CAN_BIT_PHASE_SEG2_Msk) >> ARM_CAN_BIT_PHASE_SEG2_Pos;
+  sjw  = (bit_segments & ARM_CAN_BIT_SJW_Msk)        >> ARM_CAN_BIT_SJW_Pos;
+
+  // Segment limits of a typical CAN FD controller (nominal / data bit time)
+  if ((prop < ((fd != 0U) ? 0U : 1U)) || (prop > ((fd != 0U) ? 31U : 64U))) {
+    return ARM_CAN_INVALID_BIT_PROP_SEG;
+  }
+  if ((ph1 < 1U) || (ph1 > ((fd != 0U) ? 16U : 32U))) {
+    return ARM_CAN_INVALID_BIT_PHASE_SEG1;
+  }
+  if ((ph2 < 1U) || (ph2 > ((fd != 0U) ? 16U : 32U))) {
+    return ARM_CAN_INVALID_BIT_PHASE_SEG2;
+  }
+  if ((sjw < 1U) || (sjw > ph2)) {
+    return ARM_CAN_INVALID_BIT_SJW;
+  }
+
+  // Bit time in time quanta: synchronization segment, propagation and phase segments
+  tq  = 1U + prop + ph1 + ph2;
+  max = (fd != 0U) ? VCAN_BITRATE_FD_MAX : VCAN_BITRATE_MAX;
+  if ((bitrate == 0U) || (bitrate > max) || (((uint64_t)VCAN_CLOCK % ((uint64_t)tq * bitrate)) != 0U) ||
+      (((uint64_t)VCAN_CLOCK / ((uint64_t)tq * bitrate)) > ((fd != 0U) ? 32U : 1024U))) {
+    return ARM_CAN_INVALID_BITRATE;
+  }
+
+  cancel = VCAN_Lock(can);
+  if ((can->flags & VCAN_FLAG_POWER) == 0U) {
+    ret = ARM_DRIVER_ERROR;
+  } else {
+    // Accepted in all modes (like drivers entering initialization mode temporarily),
+    // transmission in progress completes at the previous bitrate
+    if (fd != 0U) {
+      can->bitrate_fd = bitrate;
+    } else {
+      can->bitrate    = bitrate;
+    }
+    ret = ARM_DRIVER_OK;
+  }
+  VCAN_Unlock(can, cancel);
+
+  return ret;
+}
+
+static int32_t CAN_SetMode (ARM_CAN_MODE mode) {
+  VCAN_DEV *can = &vcan;
+  int32_t   ret;
+  int       cancel, on;
+
+  cancel = VCAN_Lock(can);
+  ret    = ARM_DRIVER_OK;
+  if ((can->flags & VCAN_FLAG_POWER) == 0U) {
+    ret = ARM_DRIVER_ERROR;
+  } else {
+    switch (mode) {
+      case ARM_CAN_MODE_INITIALIZATION:
+        VCAN_UnitEvent(can, ARM_CAN_EVENT_UNIT_INACTIVE);
+        break;
+      case ARM_CAN_MODE_NORMAL:
+      case ARM_CAN_MODE_MONITOR:
+      case ARM_CAN_MODE_LOOPBACK_INTERNAL:
+        VCAN_UnitEvent(can, ARM_CAN_EVENT_UNIT_ACTIVE);
+        break;
+      case ARM_CAN_MODE_LOOPBACK_EXTERNAL:
+        if (can->sock < 0) {
+          ret = ARM_DRIVER_ERROR_UNSUPPORTED;
+        } else {
+          VCAN_UnitEvent(can, ARM_CAN_EVENT_UNIT_ACTIVE);
+        }
+        break;
+      case ARM_CAN_MODE_RESTRICTED:
+      default:
+        ret = ARM_DRIVER_ERROR_UNSUPPORTED;
+        break;
+    }
+    if (ret == ARM_DRIVER_OK) {
+      can->mode = mode;
+      can->lec  = ARM_CAN_LEC_NO_ERROR;
+      if (can->sock >= 0) {
+        on = (mode == ARM_CAN_MODE_LOOPBACK_EXTERNAL) ? 1 : 0;
+        (void)setsockopt(can->sock, SOL_CAN_RAW, CAN_RAW_RECV_OWN_MSGS, &on, sizeof(on));
+      }
+      VCAN_Wake(can);
+    }
+  }
+  VCAN_Unlock(can, cancel);
+
+  return ret;
+}
+
+static ARM_CAN_OBJ_CAPABILITIES CAN_ObjectGetCapabilities (uint32_t obj_idx) {
+  ARM_CAN_OBJ_CAPABILITIES obj_cap;
+
+  memset(&obj_cap, 0, sizeof(obj_cap));
+  if (obj_idx < VCAN_TX_OBJ_NUM) {
+    obj_cap.tx               = 1U;
+    obj_cap.message_depth    = VCAN_TX_FIFO_DEPTH;
+  } else if (obj_idx < VCAN_OBJ_NUM) {
+    obj_cap.rx               = 1U;
+    obj_cap.multiple_filters = (VCAN_FILTER_NUM > 1) ? 1U : 0U;
+    obj_cap.exact_filtering  = 1U;
+    obj_cap.range_filtering  = 1U;
+    obj_cap.mask_filtering   = 1U;
+    obj_cap.message_depth    = VCAN_RX_FIFO_DEPTH;
+  }
+  return obj_cap;
+}
+
+static int32_t CAN_ObjectSetFilter (uint32_t obj_idx, ARM_CAN_FILTER_OPERATION operation, uint32_t id, uint32_t arg) {
+  VCAN_DEV    *can = &vcan;
+  VCAN_OBJ    *obj;
+  VCAN_FILTER *f;
+  uint32_t     op, i;
+  int32_t      ret;
+  int          cancel;
+
+  if (obj_idx >= VCAN_OBJ_NUM) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  if (obj_idx < VCAN_TX_OBJ_NUM) {
+    return ARM_DRIVER_ERROR_UNSUPPORTED;
+  }
+  switch (operation) {
+    case ARM_CAN_FILTER_ID_EXACT_ADD:
+    case ARM_CAN_FILTER_ID_EXACT_REMOVE:
+      op  = ARM_CAN_FILTER_ID_EXACT_ADD;
+      arg = 0U;
+      break;
+    case ARM_CAN_FILTER_ID_RANGE_ADD:
+    case ARM_CAN_FILTER_ID_RANGE_REMOVE:
+      op  = ARM_CAN_FILTER_ID_RANGE_ADD;
+      break;
+    case ARM_CAN_FILTER_ID_MASKABLE_ADD:
+    case ARM_CAN_FILTER_ID_MASKABLE_REMOVE:
+      op  = ARM_CAN_FILTER_ID_MASKABLE_ADD;
+      break;
+    default:
+      return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  cancel = VCAN_Lock(can);
+  obj    = &can->obj[obj_idx];
+  ret    = ARM_DRIVER_OK;
+  if ((can->flags & VCAN_FLAG_POWER) == 0U) {
+    ret = ARM_DRIVER_ERROR;
+  } else if (operation == op) {
+    // Add filter
+    if (obj->filter_num == VCAN_FILTER_NUM) {
+      ret = ARM_DRIVER_ERROR;           // No free filter
+    } else {
+      f      = &obj->filter[obj->filter_num++];
+      f->op  = op;
+      f->id  = id;
+      f->arg = arg;
+    }
+  } else {
+    // Remove filter
+    for (i = 0U; i < obj->filter_num; i++) {
+      f = &obj->filter[i];
+      if ((f->op == op) && (f->id == id) && (f->arg == arg)) {
+        break;
+      }
+    }
+    if (i == obj->filter_num) {
+      ret = ARM_DRIVER_ERROR;           // Filter not found
+    } else {
+      obj->filter_num--;
+      memmove(&obj->filter[i], &obj->filter[i + 1U], (obj->filter_num - i) * sizeof(VCAN_FILTER));
+    }
+  }
+  VCAN_Unlock(can, cancel);
+
+  return ret;
+}
+
+static int32_t CAN_ObjectConfigure (uint32_t obj_idx, ARM_CAN_OBJ_CONFIG obj_cfg) {
+  VCAN_DEV *can = &vcan;
+  VCAN_OBJ *obj;
+  int32_t   ret;
+  int       cancel;
+
+  if (obj_idx >= VCAN_OBJ_NUM) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  if ((obj_cfg != ARM_CAN_OBJ_INACTIVE) &&
+      (obj_cfg != ((obj_idx < VCAN_TX_OBJ_NUM) ? ARM_CAN_OBJ_TX : ARM_CAN_OBJ_RX))) {
+    return ARM_DRIVER_ERROR_UNSUPPORTED;
+  }
+
+  cancel = VCAN_Lock(can);
+  obj    = &can->obj[obj_idx];
+  if ((can->flags & VCAN_FLAG_POWER) == 0U) {
+    ret = ARM_DRIVER_ERROR;
+  } else {
+    if ((obj_cfg == ARM_CAN_OBJ_INACTIVE) && ((int32_t)obj_idx != can->tx_obj)) {
+      obj->num = 0U;                    // Pending messages are discarded
+    }
+    obj->cfg = obj_cfg;
+    ret      = ARM_DRIVER_OK;
+  }
+  VCAN_Unlock(can, cancel);
+
+  return ret;
+}
+
+static int32_t CAN_MessageSend (uint32_t obj_idx, ARM_CAN_MSG_INFO *msg_info, const uint8_t *data, uint8_t size) {
+  VCAN_DEV *can = &vcan;
+  VCAN_OBJ *obj;
+  VCAN_MSG *msg;
+  uint32_t  edl, len, i;
+  int32_t   ret;
+  int       cancel;
+
+  if ((obj_idx >= VCAN_TX_OBJ_NUM) || (msg_info == NULL) || (size > 64U) ||
+      ((data == NULL) && (size != 0U) && (msg_info->rtr == 0U))) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  cancel = VCAN_Lock(can);
+  (void)VCAN_Update(can);
+  obj = &can->obj[obj_idx];
+  // CAN FD frame when requested or when the data does not fit into a classic frame
+  edl = ((can->fd_mode != 0U) && ((msg_info->edl != 0U) || (size > 8U))) ? 1U : 0U;
+  if (((can->flags & VCAN_FLAG_POWER) == 0U) || (obj->cfg != ARM_CAN_OBJ_TX) ||
+      (can->mode == ARM_CAN_MODE_INITIALIZATION) || (can->mode == ARM_CAN_MODE_MONITOR)) {
+    ret = ARM_DRIVER_ERROR;
+  } else if ((edl == 0U) && (size > 8U)) {
+    ret = ARM_DRIVER_ERROR_PARAMETER;
+  } else if ((edl != 0U) && (msg_info->rtr != 0U)) {
+    ret = ARM_DRIVER_ERROR_PARAMETER;   // No remote frames in CAN FD
+  } else if (obj->num == obj->depth) {
+    ret = ARM_DRIVER_ERROR_BUSY;
+  } else {
+    msg      = &obj->fifo[(obj->idx + obj->num) % obj->depth];
+    msg->t   = VCAN_Time();
+    msg->id  = msg_info->id;
+    msg->rtr = msg_info->rtr;
+    msg->edl = (uint8_t)edl;
+    // Bit rate switching when requested or when a different data bitrate is set
+    msg->brs = ((edl != 0U) && ((msg_info->brs != 0U) || (can->bitrate_fd != can->bitrate))) ? 1U : 0U;
+    len      = size;
+    if (len > 8U) {
+      // Padded to the next CAN FD data length
+      for (i = 0U; vcan_fd_len[i] < len; i++) {}
+      len = vcan_fd_len[i];
+    }
+    msg->len = (uint8_t)len;
+    if (msg->rtr == 0U) {
+      memcpy(msg->data, data, size);
+      memset(&msg->data[size], 0, len - size);
+    }
+    obj->num++;
+    (void)VCAN_Update(can);
+    VCAN_Wake(can);
+    ret = size;
+  }
+  VCAN_Unlock(can, cancel);
+
+  return ret;
+}
+
+static int32_t CAN_MessageRead (uint32_t obj_idx, ARM_CAN_MSG_INFO *msg_info, uint8_t *data, uint8_t size) {
+  VCAN_DEV *can = &vcan;
+  VCAN_OBJ *obj;
+  VCAN_MSG *msg;
+  uint32_t  dlc, i;
+  int32_t   ret;
+  int       cancel;
+
+  if ((obj_idx < VCAN_TX_OBJ_NUM) || (obj_idx >= VCAN_OBJ_NUM) || (msg_info == NULL) ||
+      ((data == NULL) && (size != 0U))) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  cancel = VCAN_Lock(can);
+  (void)VCAN_Update(can);
+  obj = &can->obj[obj_idx];
+  if (((can->flags & VCAN_FLAG_POWER) == 0U) || (obj->cfg != ARM_CAN_OBJ_RX)) {
+    ret = ARM_DRIVER_ERROR;
+  } else if (obj->num == 0U) {
+    ret = ARM_CAN_NO_MESSAGE_AVAILABLE;
+  } else {
+    msg = &obj->fifo[obj->idx];
+    dlc = msg->len;
+    if (dlc > 8U) {
+      for (i = 0U; vcan_fd_len[i] < dlc; i++) {}
+      dlc = 9U + i;
+    }
+    memset(msg_info, 0, sizeof(ARM_CAN_MSG_INFO));
+    msg_info->id  = msg->id;
+    msg_info->rtr = msg->rtr;
+    msg_info->edl = msg->edl;
+    msg_info->brs = msg->brs;
+    msg_info->dlc = dlc;
+    ret = 0;
+    if (msg->rtr == 0U) {
+      ret = (size < msg->len) ? size : msg->len;
+      memcpy(data, msg->data, (uint32_t)ret);
+    }
+    obj->idx = (obj->idx + 1U) % obj->depth;
+    obj->num--;
+  }
+  VCAN_Unlock(can, cancel);
+
+  return ret;
+}
+
+static int32_t CAN_Control (uint32_t control, uint32_t arg) {
+  VCAN_DEV *can = &vcan;
+  VCAN_OBJ *obj;
+  int32_t   ret;
+  int       cancel;
+
+  cancel = VCAN_Lock(can);
+  (void)VCAN_Update(can);
+  ret = ARM_DRIVER_OK;
+  if ((can->flags & VCAN_FLAG_POWER) == 0U) {
+    VCAN_Unlock(can, cancel);
+    return ARM_DRIVER_ERROR;
+  }
+
+  switch (control & ARM_CAN_CONTROL_Msk) {
+    case ARM_CAN_SET_FD_MODE:
+      can->fd_mode = (arg != 0U) ? 1U : 0U;
+      break;
+
+    case ARM_CAN_ABORT_MESSAGE_SEND:
+      if (arg >= VCAN_TX_OBJ_NUM) {
+        ret = ARM_DRIVER_ERROR_PARAMETER;
+        break;
+      }
+      // Message on the bus is completed, pending messages are discarded
+      obj      = &can->obj[arg];
+      obj->num = ((int32_t)arg == can->tx_obj) ? 1U : 0U;
+      break;
+
+    case ARM_CAN_CONTROL_RETRANSMISSION:
+    case ARM_CAN_SET_TRANSCEIVER_DELAY:
+      break;                            // No bus errors to retransmit, no transceiver
+
+    default:
+      ret = ARM_DRIVER_ERROR_UNSUPPORTED;
+      break;
+  }
+  VCAN_Unlock(can, cancel);
+
+  return ret;
+}
+
+static ARM_CAN_STATUS CAN_GetStatus (void) {
+  VCAN_DEV       *can = &vcan;
+  ARM_CAN_STATUS  status;
+  int             cancel;
+
+  cancel = VCAN_Lock(can);
+  (void)VCAN_Update(can);
+  status.unit_state      = (((can->flags & VCAN_FLAG_POWER) == 0U) || (can->mode == ARM_CAN_MODE_INITIALIZATION)) ?
+                           ARM_CAN_UNIT_STATE_INACTIVE : ARM_CAN_UNIT_STATE_ACTIVE;
+  status.last_error_code = can->lec;
+  status.tx_error_count  = 0U;
+  status.rx_error_count  = 0U;
+  status.reserved        = 0U;
+  VCAN_Unlock(can, cancel);
+
+  return status;
+}
+
+/* Driver Control Block */
+
+extern ARM_DRIVER_CAN ARM_Driver_CAN_(VCAN_DRV_NUM);
+       ARM_DRIVER_CAN ARM_Driver_CAN_(VCAN_DRV_NUM) = {
+  CAN_GetVersion,
+  CAN_GetCapabilities,
+  CAN_Initialize,
+  CAN_Uninitialize,
+  CAN_PowerControl,
+  CAN_GetClock,
+  CAN_SetBitrate,
+  CAN_SetMode,
+  CAN_ObjectGetCapabilities,
+  CAN_ObjectSetFilter,
+  CAN_ObjectConfigure,
+  CAN_MessageSend,
+  CAN_MessageRead,
+  CAN_Control,
+  CAN_GetStatus
+};
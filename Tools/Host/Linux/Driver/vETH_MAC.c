@@ -0,0 +1,1076 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-Driver Validation
+ * Title:       Virtual Ethernet MAC (vETH) CMSIS-Driver for the Linux host
+ * Purpose:     Driver_ETH_MAC instance with:
+ *               - transmit and receive descriptor rings, fragmented frames
+ *               - wire timing simulation at the configured speed
+ *               - MAC loopback, broadcast, multicast (address list) and
+ *                 promiscuous address filtering, VLAN filtering
+ *               - software PTP clock (set, increment, decrement, clock rate
+ *                 adjustment, alarm) with transmit and receive timestamps
+ *               - management interface to the virtual PHY device
+ *                 (registers in vETH_PHY.h, driver in vETH_PHY.c)
+ *
+ *              The PHY device connects the MAC to the network (VETH_BACKEND):
+ *               - memory loopback: frames sent on the link are received back,
+ *                 like with an Ethernet loopback plug
+ *               - TAP interface: frames are exchanged with the Linux network
+ *                 stack (interface VETH_TAP_NAME)
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#define _GNU_SOURCE
+
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <net/if.h>
+#include <linux/if_tun.h>
+
+#include "Driver_ETH_MAC.h"
+#include "vETH_Config.h"
+#include "vETH_PHY.h"
+
+#define ARM_ETH_MAC_DRV_VERSION ARM_DRIVER_VERSION_MAJOR_MINOR(1, 0)
+
+/* MAC flags */
+#define VETH_FLAG_INIT          (1U << 0)       /* Driver initialized         */
+#define VETH_FLAG_POWER         (1U << 1)       /* Driver powered             */
+
+#define VETH_FRAME_SIZE         1522U           /* Frame size (VLAN, no FCS)  */
+#define VETH_FRAME_MIN          60U             /* Minimum frame size (pad)   */
+#define VETH_WIRE_OVERHEAD      24U             /* Preamble, SFD, FCS and IFG */
+#define VETH_PTP_RATE_1         0x80000000U     /* PTP clock rate 1.0 (q31)   */
+
+/* Transmit descriptor */
+typedef struct {
+  uint64_t        t_start;              /* Start of transmission [ns]         */
+  uint64_t        t_end;                /* End of transmission [ns]           */
+  uint32_t        flags;                /* ARM_ETH_MAC_TX_FRAME_x flags       */
+  uint32_t        len;                  /* Frame length                       */
+  uint8_t         data[VETH_FRAME_SIZE];/* Frame data                         */
+} VETH_TX_DESC;
+
+/* Receive descriptor */
+typedef struct {
+  ARM_ETH_MAC_TIME time;                /* Receive timestamp                  */
+  uint32_t        len;                  /* Frame length                       */
+  uint8_t         data[VETH_FRAME_SIZE];/* Frame data                         */
+} VETH_RX_DESC;
+
+/* MAC information */
+typedef struct {
+  pthread_mutex_t mutex;                /* MAC lock                           */
+  pthread_cond_t  poll_cond;            /* MAC thread poll cycle completed    */
+  uint32_t        poll_cnt;             /* MAC thread poll cycles             */
+  ARM_ETH_MAC_SignalEvent_t cb_event;   /* Event callback                     */
+  uint32_t        flags;                /* Driver flags                       */
+  int             fd;                   /* TAP interface (-1: none)           */
+  int             wake[2];              /* MAC thread wake-up pipe            */
+  uint32_t        config;               /* ARM_ETH_MAC_CONFIGURE argument     */
+  uint32_t        tx_en;                /* Transmitter enabled                */
+  uint32_t        rx_en;                /* Receiver enabled                   */
+  uint32_t        vlan;                 /* VLAN filter (0: disabled)          */
+  ARM_ETH_MAC_ADDR addr;                /* MAC address                        */
+  ARM_ETH_MAC_ADDR mcast[VETH_MCAST_NUM]; /* Multicast address filter         */
+  uint32_t        mcast_num;            /* Multicast filter entries used      */
+  uint32_t        mcast_all;            /* All multicast (filter overflow)    */
+  VETH_TX_DESC    tx[VETH_TX_DESC_NUM]; /* Transmit descriptor ring           */
+  uint32_t        tx_idx;               /* First used transmit descriptor     */
+  uint32_t        tx_num;               /* Used transmit descriptors          */
+  uint32_t        tx_frag;              /* Fragments length of next frame     */
+  uint64_t        tx_wire;              /* Wire free after this time [ns]     */
+  ARM_ETH_MAC_TIME tx_time;             /* Transmit timestamp                 */
+  uint32_t        tx_time_valid;        /* Transmit timestamp available       */
+  VETH_RX_DESC    rx[VETH_RX_DESC_NUM]; /* Receive descriptor ring            */
+  uint32_t        rx_idx;               /* First used receive descriptor      */
+  uint32_t        rx_num;               /* Used receive descriptors           */
+  uint64_t        ptp_ref;              /* PTP reference: monotonic time [ns] */
+  uint64_t        ptp_base;             /* PTP time at reference [ns]         */
+  uint32_t        ptp_rate;             /* PTP clock rate (q31)               */
+  uint64_t        alarm;                /* PTP alarm time [ns]                */
+  uint32_t        alarm_en;             /* PTP alarm active                   */
+  uint16_t        phy_bmcr;             /* PHY Basic Mode Control register    */
+  uint16_t        phy_anar;             /* PHY Auto-Negotiation Advertisement */
+  uint32_t        event;                /* Events pending to be signaled      */
+} VETH_MAC;
+
+static VETH_MAC       veth_mac = {
+  .mutex     = PTHREAD_MUTEX_INITIALIZER,
+  .poll_cond = PTHREAD_COND_INITIALIZER,
+  .fd        = -1,
+  .wake      = { -1, -1 },
+  .phy_bmcr  = VETH_BMCR_ANEG_EN,
+  .phy_anar  = 0x01E1U
+};
+static pthread_once_t veth_once = PTHREAD_ONCE_INIT;
+
+/* Wire time of a byte at the MAC speed (10M, 100M, 1G) [ns] */
+static const uint32_t veth_byte_time[3] = { 800U, 80U, 8U };
+
+static const ARM_DRIVER_VERSION DriverVersion = {
+  ARM_ETH_MAC_API_VERSION,
+  ARM_ETH_MAC_DRV_VERSION
+};
+
+static const ARM_ETH_MAC_CAPABILITIES DriverCapabilities = {
+  0U,                                   /* checksum_offload_rx_ip4            */
+  0U,                                   /* checksum_offload_rx_ip6            */
+  0U,                                   /* checksum_offload_rx_udp            */
+  0U,                                   /* checksum_offload_rx_tcp            */
+  0U,                                   /* checksum_offload_rx_icmp           */
+  0U,                                   /* checksum_offload_tx_ip4            */
+  0U,                                   /* checksum_offload_tx_ip6            */
+  0U,                                   /* checksum_offload_tx_udp            */
+  0U,                                   /* checksum_offload_tx_tcp            */
+  0U,                                   /* checksum_offload_tx_icmp           */
+  ARM_ETH_INTERFACE_MII,                /* media_interface                    */
+  0U,                                   /* mac_address                        */
+  1U,                                   /* event_rx_frame                     */
+  1U,                                   /* event_tx_frame                     */
+  0U,                                   /* event_wakeup                       */
+  1U,                                   /* precision_timer                    */
+  0U
+};
+
+/*-----------------------------------------------------------------------------
+ * Lock MAC (thread cancellation is disabled while locked)
+ *----------------------------------------------------------------------------*/
+static int VETH_Lock (VETH_MAC *mac) {
+  int cancel;
+
+  (void)pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &cancel);
+  (void)pthread_mutex_lock(&mac->mutex);
+  return (cancel);
+}
+
+/*-----------------------------------------------------------------------------
+ * Unlock MAC and signal pending events
+ * (callback is called unlocked, like from the interrupt of the device)
+ *----------------------------------------------------------------------------*/
+static void VETH_Unlock (VETH_MAC *mac, int cancel) {
+  ARM_ETH_MAC_SignalEvent_t cb_event;
+  uint32_t                  event;
+
+  cb_event   = mac->cb_event;
+  event      = mac->event;
+  mac->event = 0U;
+  (void)pthread_mutex_unlock(&mac->mutex);
+
+  if ((event != 0U) && (cb_event != NULL)) {
+    cb_event(event);
+  }
+  (void)pthread_setcancelstate(cancel, NULL);
+}
+
+/*-----------------------------------------------------------------------------
+ * Wake up MAC thread (transmit queue or PTP alarm changed)
+ *----------------------------------------------------------------------------*/
+static void VETH_Wake (const VETH_MAC *mac) {
+  uint8_t val = 0U;
+
+  (void)write(mac->wake[1], &val, 1U);
+}
+
+/*-----------------------------------------------------------------------------
+ * Get monotonic time in nanoseconds
+ *----------------------------------------------------------------------------*/
+static uint64_t VETH_Time (void) {
+  struct timespec now;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &now);
+  return (((uint64_t)now.tv_sec * 1000000000U) + (uint64_t)now.tv_nsec);
+}
+
+/*-----------------------------------------------------------------------------
+ * Get PTP time [ns] at the monotonic time t
+ * (PTP time advances by the clock rate: elapsed * rate / 2^31)
+ *----------------------------------------------------------------------------*/
+static uint64_t VETH_PtpTime (const VETH_MAC *mac, uint64_t t) {
+  uint64_t d;
+
+  d = (t > mac->ptp_ref) ? (t - mac->ptp_ref) : 0U;
+  return (mac->ptp_base + ((d >> 31) * mac->ptp_rate) + (((d & 0x7FFFFFFFU) * mac->ptp_rate) >> 31));
+}
+
+/*-----------------------------------------------------------------------------
+ * Move PTP reference to the monotonic time t (before PTP clock changes)
+ *----------------------------------------------------------------------------*/
+static void VETH_PtpRebase (VETH_MAC *mac, uint64_t t) {
+
+  mac->ptp_base = VETH_PtpTime(mac, t);
+  mac->ptp_ref  = t;
+}
+
+/*-----------------------------------------------------------------------------
+ * Convert PTP time [ns] to ARM_ETH_MAC_TIME
+ *----------------------------------------------------------------------------*/
+static void VETH_PtpToTime (uint64_t ptp, ARM_ETH_MAC_TIME *time) {
+
+  time->sec = (uint32_t)(ptp / 1000000000U);
+  time->ns  = (uint32_t)(ptp % 1000000000U);
+}
+
+/*-----------------------------------------------------------------------------
+ * Check if the PHY device has link (network connected and PHY operational)
+ *----------------------------------------------------------------------------*/
+static uint32_t VETH_PhyLink (const VETH_MAC *mac) {
+
+  if ((mac->phy_bmcr & (VETH_BMCR_POWER_DOWN | VETH_BMCR_LOOPBACK)) != 0U) {
+    return (0U);
+  }
+  if ((VETH_BACKEND != 0) && (mac->fd < 0)) {
+    return (0U);
+  }
+  return (1U);
+}
+
+/*-----------------------------------------------------------------------------
+ * Get PHY status register (speed and duplex of the link)
+ *----------------------------------------------------------------------------*/
+static uint16_t VETH_PhyStatus (const VETH_MAC *mac) {
+  uint16_t val;
+
+  if ((mac->phy_bmcr & VETH_BMCR_ANEG_EN) != 0U) {
+    val = (uint16_t)((VETH_LINK_SPEED << VETH_PHYSTS_SPEED_Pos) | VETH_PHYSTS_DUPLEX);
+  } else {
+    if ((mac->phy_bmcr & VETH_BMCR_SPEED_SEL_1G) != 0U) {
+      val = ARM_ETH_SPEED_1G   << VETH_PHYSTS_SPEED_Pos;
+    } else if ((mac->phy_bmcr & VETH_BMCR_SPEED_SEL) != 0U) {
+      val = ARM_ETH_SPEED_100M << VETH_PHYSTS_SPEED_Pos;
+    } else {
+      val = ARM_ETH_SPEED_10M  << VETH_PHYSTS_SPEED_Pos;
+    }
+    if ((mac->phy_bmcr & VETH_BMCR_DUPLEX) != 0U) {
+      val |= VETH_PHYSTS_DUPLEX;
+    }
+  }
+  if (VETH_PhyLink(mac) != 0U) {
+    val |= VETH_PHYSTS_LINK;
+  }
+  return (val);
+}
+
+/*-----------------------------------------------------------------------------
+ * Check received frame against the address and VLAN filters
+ *----------------------------------------------------------------------------*/
+static uint32_t VETH_RxFilter (const VETH_MAC *mac, const uint8_t *frame) {
+  static const uint8_t bcast[6] = { 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU };
+  uint32_t tci, i;
+
+  if ((mac->config & ARM_ETH_MAC_ADDRESS_ALL) != 0U) {
+    return (1U);                        // Promiscuous mode
+  }
+
+  if (memcmp(frame, bcast, 6U) == 0) {
+    if ((mac->config & ARM_ETH_MAC_ADDRESS_BROADCAST) == 0U) {
+      return (0U);
+    }
+  } else if ((frame[0] & 0x01U) != 0U) {
+    if (((mac->config & ARM_ETH_MAC_ADDRESS_MULTICAST) == 0U) && (mac->mcast_all == 0U)) {
+      for (i = 0U; i < mac->mcast_num; i++) {
+        if (memcmp(frame, mac->mcast[i].b, 6U) == 0) {
+          break;
+        }
+      }
+      if (i == mac->mcast_num) {
+        return (0U);
+      }
+    }
+  } else if (memcmp(frame, mac->addr.b, 6U) != 0) {
+    return (0U);
+  }
+
+  if (mac->vlan != 0U) {
+    // Only VLAN tagged frames with matching tag (or VLAN identifier) are received
+    if ((frame[12] != 0x81U) || (frame[13] != 0x00U)) {
+      return (0U);
+    }
+    tci = ((uint32_t)frame[14] << 8) | frame[15];
+    if ((mac->vlan & ARM_ETH_MAC_VLAN_FILTER_ID_ONLY) != 0U) {
+      if ((tci & 0x0FFFU) != (mac->vlan & 0x0FFFU)) {
+        return (0U);
+      }
+    } else if (tci != (mac->vlan & 0xFFFFU)) {
+      return (0U);
+    }
+  }
+
+  return (1U);
+}
+
+/*-----------------------------------------------------------------------------
+ * Receive a frame into the receive descriptor ring
+ * (t: monotonic time of the end of reception)
+ *----------------------------------------------------------------------------*/
+static void VETH_Receive (VETH_MAC *mac, const uint8_t *frame, uint32_t len, uint64_t t) {
+  VETH_RX_DESC *desc;
+
+  if ((mac->rx_en == 0U) || (len < 14U) || (len > VETH_FRAME_SIZE) || (VETH_RxFilter(mac, frame) == 0U)) {
+    return;
+  }
+  if (mac->rx_num == VETH_RX_DESC_NUM) {
+    return;                             // No free descriptor: frame is dropped
+  }
+
+  desc      = &mac->rx[(mac->rx_idx + mac->rx_num) % VETH_RX_DESC_NUM];
+  desc->len = len;
+  memcpy(desc->data, frame, len);
+  VETH_PtpToTime(VETH_PtpTime(mac, t), &desc->time);
+  mac->rx_num++;
+  mac->event |= ARM_ETH_MAC_EVENT_RX_FRAME;
+}
+
+/*-----------------------------------------------------------------------------
+ * Complete transmission of a frame: pass it through the MAC loopback or the
+ * PHY device to the network
+ *----------------------------------------------------------------------------*/
+static void VETH_Transmit (VETH_MAC *mac, const VETH_TX_DESC *desc) {
+
+  if ((desc->flags & ARM_ETH_MAC_TX_FRAME_TIMESTAMP) != 0U) {
+    VETH_PtpToTime(VETH_PtpTime(mac, desc->t_start), &mac->tx_time);
+    mac->tx_time_valid = 1U;
+  }
+  if ((desc->flags & ARM_ETH_MAC_TX_FRAME_EVENT) != 0U) {
+    mac->event |= ARM_ETH_MAC_EVENT_TX_FRAME;
+  }
+
+  if ((mac->config & ARM_ETH_MAC_LOOPBACK) != 0U) {
+    VETH_Receive(mac, desc->data, desc->len, desc->t_end);
+  } else if ((mac->phy_bmcr & (VETH_BMCR_POWER_DOWN | VETH_BMCR_ISOLATE)) != 0U) {
+    // PHY device is not connected to the MAC: frame is lost
+  } else if ((mac->phy_bmcr & VETH_BMCR_LOOPBACK) != 0U) {
+    VETH_Receive(mac, desc->data, desc->len, desc->t_end);
+  } else if (VETH_PhyLink(mac) == 0U) {
+    // No link: frame is lost
+  } else if (mac->fd >= 0) {
+    (void)write(mac->fd, desc->data, desc->len);
+  } else {
+    VETH_Receive(mac, desc->data, desc->len, desc->t_end);
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ * Read frames received by the TAP interface
+ *----------------------------------------------------------------------------*/
+static void VETH_TapRead (VETH_MAC *mac) {
+  uint8_t  buf[VETH_FRAME_SIZE];
+  ssize_t  n;
+  uint32_t i;
+
+  // Limited number of frames per call, so the driver functions are not blocked by traffic
+  for (i = 0U; i < VETH_RX_DESC_NUM; i++) {
+    n = read(mac->fd, buf, sizeof(buf));
+    if (n <= 0) {
+      break;
+    }
+    // Frames from the network are lost in MAC or PHY loopback mode and without link
+    if (((mac->config & ARM_ETH_MAC_LOOPBACK) == 0U) &&
+        ((mac->phy_bmcr & VETH_BMCR_ISOLATE) == 0U) && (VETH_PhyLink(mac) != 0U)) {
+      VETH_Receive(mac, buf, (uint32_t)n, VETH_Time());
+    }
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ * Update MAC: complete transmitted frames and check PTP alarm
+ * (returns monotonic time of the next update or 0 if not needed)
+ *----------------------------------------------------------------------------*/
+static uint64_t VETH_Update (VETH_MAC *mac) {
+  VETH_TX_DESC *desc;
+  uint64_t      now, ptp, due, next, d;
+
+  now  = VETH_Time();
+  next = 0U;
+
+  while (mac->tx_num != 0U) {
+    desc = &mac->tx[mac->tx_idx];
+    if ((VETH_WIRE_SIM != 0) && (now < desc->t_end)) {
+      next = desc->t_end;
+      break;
+    }
+    VETH_Transmit(mac, desc);
+    mac->tx_idx = (mac->tx_idx + 1U) % VETH_TX_DESC_NUM;
+    mac->tx_num--;
+  }
+
+  if (mac->alarm_en != 0U) {
+    ptp = VETH_PtpTime(mac, now);
+    if (ptp >= mac->alarm) {
+      mac->alarm_en = 0U;
+      mac->event   |= ARM_ETH_MAC_EVENT_TIMER_ALARM;
+    } else {
+      // Monotonic time of the alarm: PTP time difference / rate
+      d   = mac->alarm - ptp;
+      due = now + ((d / mac->ptp_rate) << 31) + (((d % mac->ptp_rate) << 31) / mac->ptp_rate) + 1U;
+      if ((next == 0U) || (due < next)) {
+        next = due;
+      }
+    }
+  }
+
+  return (next);
+}
+
+/*-----------------------------------------------------------------------------
+ * MAC thread: completes transmission in time, receives frames from the TAP
+ * interface and signals PTP alarm
+ *----------------------------------------------------------------------------*/
+static void *VETH_Thread (void *arg) {
+  VETH_MAC        *mac = (VETH_MAC *)arg;
+  struct pollfd    fds[2];
+  struct timespec  ts;
+  uint8_t          buf[64];
+  uint64_t         next, now;
+  int              cancel;
+
+  fds[0].fd      = -1;
+  fds[0].events  = POLLIN;
+  fds[0].revents = 0;
+  fds[1].fd      = mac->wake[0];
+  fds[1].events  = POLLIN;
+  fds[1].revents = 0;
+
+  for (;;) {
+    if ((fds[1].revents & POLLIN) != 0) {
+      while (read(mac->wake[0], buf, sizeof(buf)) > 0) {}
+    }
+
+    cancel = VETH_Lock(mac);
+    mac->poll_cnt++;
+    (void)pthread_cond_broadcast(&mac->poll_cond);
+    if (((fds[0].revents & POLLIN) != 0) && (mac->fd >= 0) && (fds[0].fd == mac->fd)) {
+      VETH_TapRead(mac);
+    }
+    next      = VETH_Update(mac);
+    fds[0].fd = mac->fd;
+    VETH_Unlock(mac, cancel);
+
+    if (next != 0U) {
+      now = VETH_Time();
+      next = (next > now) ? (next - now) : 0U;
+      ts.tv_sec  = (time_t)(next / 1000000000U);
+      ts.tv_nsec = (long)(next % 1000000000U);
+      (void)ppoll(fds, 2U, &ts, NULL);
+    } else {
+      (void)ppoll(fds, 2U, NULL, NULL);
+    }
+  }
+
+  return (NULL);
+}
+
+/*-----------------------------------------------------------------------------
+ * Start MAC thread, executed once
+ *----------------------------------------------------------------------------*/
+static void VETH_Init (void) {
+  pthread_t thread;
+
+  if (pipe2(veth_mac.wake, O_NONBLOCK | O_CLOEXEC) != 0) {
+    veth_mac.wake[0] = -1;
+    return;
+  }
+  if (pthread_create(&thread, NULL, VETH_Thread, &veth_mac) != 0) {
+    (void)close(veth_mac.wake[0]);
+    (void)close(veth_mac.wake[1]);
+    veth_mac.wake[0] = -1;
+    return;
+  }
+  (void)pthread_detach(thread);
+}
+
+/*-----------------------------------------------------------------------------
+ * Open TAP interface VETH_TAP_NAME (returns file descriptor or -1)
+ *----------------------------------------------------------------------------*/
+static int VETH_TapOpen (void) {
+  struct ifreq ifr;
+  int          fd;
+
+  fd = open("/dev/net/tun", O_RDWR | O_NONBLOCK | O_CLOEXEC);
+  if (fd < 0) {
+    return (-1);
+  }
+  memset(&ifr, 0, sizeof(ifr));
+  ifr.ifr_flags = IFF_TAP | IFF_NO_PI;
+  strncpy(ifr.ifr_name, VETH_TAP_NAME, IFNAMSIZ - 1);
+  if (ioctl(fd, TUNSETIFF, &ifr) != 0) {
+    (void)close(fd);
+    return (-1);
+  }
+  return (fd);
+}
+
+/* Driver functions */
+
+static ARM_DRIVER_VERSION MAC_GetVersion (void) {
+  return DriverVersion;
+}
+
+static ARM_ETH_MAC_CAPABILITIES MAC_GetCapabilities (void) {
+  return DriverCapabilities;
+}
+
+static int32_t MAC_Initialize (ARM_ETH_MAC_SignalEvent_t cb_event) {
+  VETH_MAC *mac = &veth_mac;
+  int       cancel;
+
+  (void)pthread_once(&veth_once, VETH_Init);
+  if (mac->wake[0] < 0) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  cancel = VETH_Lock(mac);
+  mac->cb_event = cb_event;
+  mac->flags   |= VETH_FLAG_INIT;
+  VETH_Unlock(mac, cancel);
+
+  return ARM_DRIVER_OK;
+}
+
+static int32_t MAC_PowerControl (ARM_POWER_STATE state) {
+  VETH_MAC *mac = &veth_mac;
+  uint32_t  cnt;
+  int32_t   ret;
+  int       cancel;
+
+  cancel = VETH_Lock(mac);
+  switch (state) {
+    case ARM_POWER_OFF:
+      if (mac->fd >= 0) {
+        // TAP interface is released when the MAC thread no longer polls it
+        cnt = mac->poll_cnt;
+        (void)close(mac->fd);
+        mac->fd = -1;
+        VETH_Wake(mac);
+        while (mac->poll_cnt == cnt) {
+          (void)pthread_cond_wait(&mac->poll_cond, &mac->mutex);
+        }
+      }
+      mac->flags        &= ~VETH_FLAG_POWER;
+      mac->tx_en         = 0U;
+      mac->rx_en         = 0U;
+      mac->vlan          = 0U;
+      mac->mcast_num     = 0U;
+      mac->mcast_all     = 0U;
+      mac->tx_num        = 0U;
+      mac->tx_frag       = 0U;
+      mac->tx_time_valid = 0U;
+      mac->rx_num        = 0U;
+      mac->alarm_en      = 0U;
+      mac->event         = 0U;
+      VETH_Wake(mac);
+      ret = ARM_DRIVER_OK;
+      break;
+
+    case ARM_POWER_FULL:
+      if ((mac->flags & VETH_FLAG_INIT) == 0U) {
+        ret = ARM_DRIVER_ERROR;
+        break;
+      }
+      if ((mac->flags & VETH_FLAG_POWER) == 0U) {
+        if (VETH_BACKEND != 0) {
+          mac->fd = VETH_TapOpen();
+          if (mac->fd < 0) {
+            ret = ARM_DRIVER_ERROR;
+            break;
+          }
+          VETH_Wake(mac);
+        }
+        mac->flags    |= VETH_FLAG_POWER;
+        mac->config    = ARM_ETH_MAC_SPEED_100M | ARM_ETH_MAC_DUPLEX_FULL;
+        mac->tx_wire   = 0U;
+        mac->ptp_ref   = VETH_Time();
+        mac->ptp_base  = 0U;
+        mac->ptp_rate  = VETH_PTP_RATE_1;
+      }
+      ret = ARM_DRIVER_OK;
+      break;
+
+    case ARM_POWER_LOW:
+    default:
+      ret = ARM_DRIVER_ERROR_UNSUPPORTED;
+      break;
+  }
+  VETH_Unlock(mac, cancel);
+
+  return ret;
+}
+
+static int32_t MAC_Uninitialize (void) {
+  VETH_MAC *mac = &veth_mac;
+  int       cancel;
+
+  (void)MAC_PowerControl(ARM_POWER_OFF);
+
+  cancel = VETH_Lock(mac);
+  mac->cb_event = NULL;
+  mac->flags    = 0U;
+  VETH_Unlock(mac, cancel);
+
+  return ARM_DRIVER_OK;
+}
+
+static int32_t MAC_GetMacAddress (ARM_ETH_MAC_ADDR *ptr_addr) {
+  VETH_MAC *mac = &veth_mac;
+  int32_t   ret;
+  int       cancel;
+
+  if (ptr_addr == NULL) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  cancel = VETH_Lock(mac);
+  if ((mac->flags & VETH_FLAG_POWER) == 0U) {
+    ret = ARM_DRIVER_ERROR;
+  } else {
+    *ptr_addr = mac->addr;
+    ret       = ARM_DRIVER_OK;
+  }
+  VETH_Unlock(mac, cancel);
+
+  return ret;
+}
+
+static int32_t MAC_SetMacAddress (const ARM_ETH_MAC_ADDR *ptr_addr) {
+  VETH_MAC *mac = &veth_mac;
+  int32_t   ret;
+  int       cancel;
+
+  if (ptr_addr == NULL) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  cancel = VETH_Lock(mac);
+  if ((mac->flags & VETH_FLAG_POWER) == 0U) {
+    ret = ARM_DRIVER_ERROR;
+  } else {
+    mac->addr = *ptr_addr;
+    ret       = ARM_DRIVER_OK;
+  }
+  VETH_Unlock(mac, cancel);
+
+  return ret;
+}
+
+static int32_t MAC_SetAddressFilter (const ARM_ETH_MAC_ADDR *ptr_addr, uint32_t num_addr) {
+  VETH_MAC *mac = &veth_mac;
+  int32_t   ret;
+  int       cancel;
+
+  if ((ptr_addr == NULL) && (num_addr != 0U)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  cancel = VETH_Lock(mac);
+  if ((mac->flags & VETH_FLAG_POWER) == 0U) {
+    ret = ARM_DRIVER_ERROR;
+  } else {
+    if (num_addr > VETH_MCAST_NUM) {
+      // More addresses than filter entries: receive all multicast frames
+      mac->mcast_num = 0U;
+      mac->mcast_all = 1U;
+    } else {
+      if (num_addr != 0U) {
+        memcpy(mac->mcast, ptr_addr, num_addr * sizeof(ARM_ETH_MAC_ADDR));
+      }
+      mac->mcast_num = num_addr;
+      mac->mcast_all = 0U;
+    }
+    ret = ARM_DRIVER_OK;
+  }
+  VETH_Unlock(mac, cancel);
+
+  return ret;
+}
+
+static int32_t MAC_SendFrame (const uint8_t *frame, uint32_t len, uint32_t flags) {
+  VETH_MAC     *mac = &veth_mac;
+  VETH_TX_DESC *desc;
+  uint64_t      now, t;
+  uint32_t      speed;
+  int32_t       ret;
+  int           cancel;
+
+  if ((frame == NULL) || (len == 0U)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  cancel = VETH_Lock(mac);
+  (void)VETH_Update(mac);
+  if (((mac->flags & VETH_FLAG_POWER) == 0U) || (mac->tx_en == 0U)) {
+    ret = ARM_DRIVER_ERROR;
+  } else if (mac->tx_num == VETH_TX_DESC_NUM) {
+    ret = ARM_DRIVER_ERROR_BUSY;        // All transmit descriptors are used
+  } else if ((mac->tx_frag + len) > VETH_FRAME_SIZE) {
+    mac->tx_frag = 0U;
+    ret = ARM_DRIVER_ERROR_PARAMETER;
+  } else {
+    // Fragments are collected in the next free descriptor
+    desc = &mac->tx[(mac->tx_idx + mac->tx_num) % VETH_TX_DESC_NUM];
+    memcpy(&desc->data[mac->tx_frag], frame, len);
+    mac->tx_frag += len;
+    if ((flags & ARM_ETH_MAC_TX_FRAME_FRAGMENT) == 0U) {
+      // Frame is transmitted after the previous frames
+      now   = VETH_Time();
+      speed = (mac->config & ARM_ETH_MAC_SPEED_Msk) >> ARM_ETH_MAC_SPEED_Pos;
+      t     = (mac->tx_wire > now) ? mac->tx_wire : now;
+      desc->t_start = t;
+      desc->t_end   = t + ((uint64_t)(((mac->tx_frag < VETH_FRAME_MIN) ? VETH_FRAME_MIN : mac->tx_frag) +
+                                      VETH_WIRE_OVERHEAD) * veth_byte_time[speed]);
+      desc->flags   = flags;
+      desc->len     = mac->tx_frag;
+      mac->tx_wire  = desc->t_end;
+      mac->tx_frag  = 0U;
+      mac->tx_num++;
+      (void)VETH_Update(mac);
+      if (mac->tx_num != 0U) {
+        VETH_Wake(mac);
+      }
+    }
+    ret = ARM_DRIVER_OK;
+  }
+  VETH_Unlock(mac, cancel);
+
+  return ret;
+}
+
+static int32_t MAC_ReadFrame (uint8_t *frame, uint32_t len) {
+  VETH_MAC     *mac = &veth_mac;
+  VETH_RX_DESC *desc;
+  int32_t       ret;
+  int           cancel;
+
+  cancel = VETH_Lock(mac);
+  (void)VETH_Update(mac);
+  if (((mac->flags & VETH_FLAG_POWER) == 0U) || (mac->rx_num == 0U)) {
+    ret = ARM_DRIVER_ERROR;
+  } else {
+    desc = &mac->rx[mac->rx_idx];
+    ret  = 0;
+    if (frame != NULL) {
+      // Frame is truncated to the buffer length, NULL buffer discards the frame
+      if (len > desc->len) {
+        len = desc->len;
+      }
+      memcpy(frame, desc->data, len);
+      ret = (int32_t)len;
+    }
+    mac->rx_idx = (mac->rx_idx + 1U) % VETH_RX_DESC_NUM;
+    mac->rx_num--;
+  }
+  VETH_Unlock(mac, cancel);
+
+  return ret;
+}
+
+static uint32_t MAC_GetRxFrameSize (void) {
+  VETH_MAC *mac = &veth_mac;
+  uint32_t  size;
+  int       cancel;
+
+  cancel = VETH_Lock(mac);
+  (void)VETH_Update(mac);
+  size = 0U;
+  if (((mac->flags & VETH_FLAG_POWER) != 0U) && (mac->rx_num != 0U)) {
+    size = mac->rx[mac->rx_idx].len;
+  }
+  VETH_Unlock(mac, cancel);
+
+  return size;
+}
+
+static int32_t MAC_GetRxFrameTime (ARM_ETH_MAC_TIME *time) {
+  VETH_MAC *mac = &veth_mac;
+  int32_t   ret;
+  int       cancel;
+
+  if (time == NULL) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  cancel = VETH_Lock(mac);
+  if (((mac->flags & VETH_FLAG_POWER) == 0U) || (mac->rx_num == 0U)) {
+    ret = ARM_DRIVER_ERROR;
+  } else {
+    *time = mac->rx[mac->rx_idx].time;
+    ret   = ARM_DRIVER_OK;
+  }
+  VETH_Unlock(mac, cancel);
+
+  return ret;
+}
+
+static int32_t MAC_GetTxFrameTime (ARM_ETH_MAC_TIME *time) {
+  VETH_MAC *mac = &veth_mac;
+  int32_t   ret;
+  int       cancel;
+
+  if (time == NULL) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  cancel = VETH_Lock(mac);
+  (void)VETH_Update(mac);
+  if (((mac->flags & VETH_FLAG_POWER) == 0U) || (mac->tx_time_valid == 0U)) {
+    ret = ARM_DRIVER_ERROR;
+  } else {
+    *time = mac->tx_time;
+    ret   = ARM_DRIVER_OK;
+  }
+  VETH_Unlock(mac, cancel);
+
+  return ret;
+}
+
+static int32_t MAC_ControlTimer (uint32_t control, ARM_ETH_MAC_TIME *time) {
+  VETH_MAC *mac = &veth_mac;
+  uint64_t  now, t;
+  int32_t   ret;
+  int       cancel;
+
+  if (time == NULL) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  if ((control != ARM_ETH_MAC_TIMER_GET_TIME) && (control != ARM_ETH_MAC_TIMER_ADJUST_CLOCK) &&
+      (time->ns >= 1000000000U)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  t = ((uint64_t)time->sec * 1000000000U) + time->ns;
+
+  cancel = VETH_Lock(mac);
+  now = VETH_Time();
+  ret = ARM_DRIVER_OK;
+  if ((mac->flags & VETH_FLAG_POWER) == 0U) {
+    ret = ARM_DRIVER_ERROR;
+  } else {
+    switch (control) {
+      case ARM_ETH_MAC_TIMER_GET_TIME:
+        VETH_PtpToTime(VETH_PtpTime(mac, now), time);
+        break;
+      case ARM_ETH_MAC_TIMER_SET_TIME:
+        mac->ptp_ref  = now;
+        mac->ptp_base = t;
+        break;
+      case ARM_ETH_MAC_TIMER_INC_TIME:
+        VETH_PtpRebase(mac, now);
+        mac->ptp_base += t;
+        break;
+      case ARM_ETH_MAC_TIMER_DEC_TIME:
+        VETH_PtpRebase(mac, now);
+        mac->ptp_base = (mac->ptp_base > t) ? (mac->ptp_base - t) : 0U;
+        break;
+      case ARM_ETH_MAC_TIMER_SET_ALARM:
+        mac->alarm    = t;
+        mac->alarm_en = 1U;
+        break;
+      case ARM_ETH_MAC_TIMER_ADJUST_CLOCK:
+        // Correction factor in q31 format (0x80000000 = 1.0)
+        if (time->ns == 0U) {
+          ret = ARM_DRIVER_ERROR_PARAMETER;
+          break;
+        }
+        VETH_PtpRebase(mac, now);
+        mac->ptp_rate = time->ns;
+        break;
+      default:
+        ret = ARM_DRIVER_ERROR_UNSUPPORTED;
+        break;
+    }
+    if ((ret == ARM_DRIVER_OK) && (control != ARM_ETH_MAC_TIMER_GET_TIME)) {
+      VETH_Wake(mac);                   // Alarm time changed
+    }
+  }
+  VETH_Unlock(mac, cancel);
+
+  return ret;
+}
+
+static int32_t MAC_Control (uint32_t control, uint32_t arg) {
+  VETH_MAC *mac = &veth_mac;
+  int32_t   ret;
+  int       cancel;
+
+  cancel = VETH_Lock(mac);
+  (void)VETH_Update(mac);
+  ret = ARM_DRIVER_OK;
+  if ((mac->flags & VETH_FLAG_POWER) == 0U) {
+    VETH_Unlock(mac, cancel);
+    return ARM_DRIVER_ERROR;
+  }
+
+  switch (control) {
+    case ARM_ETH_MAC_CONFIGURE:
+      if (((arg & ARM_ETH_MAC_SPEED_Msk) >> ARM_ETH_MAC_SPEED_Pos) > ARM_ETH_SPEED_1G) {
+        ret = ARM_DRIVER_ERROR_UNSUPPORTED;
+      } else if ((arg & (ARM_ETH_MAC_CHECKSUM_OFFLOAD_RX | ARM_ETH_MAC_CHECKSUM_OFFLOAD_TX)) != 0U) {
+        ret = ARM_DRIVER_ERROR_UNSUPPORTED;
+      } else {
+        mac->config = arg;
+      }
+      break;
+
+    case ARM_ETH_MAC_CONTROL_TX:
+      mac->tx_en = (arg != 0U) ? 1U : 0U;
+      break;
+
+    case ARM_ETH_MAC_CONTROL_RX:
+      mac->rx_en = (arg != 0U) ? 1U : 0U;
+      break;
+
+    case ARM_ETH_MAC_FLUSH:
+      if ((arg & ARM_ETH_MAC_FLUSH_RX) != 0U) {
+        mac->rx_num = 0U;
+      }
+      if ((arg & ARM_ETH_MAC_FLUSH_TX) != 0U) {
+        mac->tx_num  = 0U;
+        mac->tx_frag = 0U;
+      }
+      break;
+
+    case ARM_ETH_MAC_VLAN_FILTER:
+      mac->vlan = arg & (ARM_ETH_MAC_VLAN_FILTER_ID_ONLY | 0xFFFFU);
+      break;
+
+    case ARM_ETH_MAC_SLEEP:
+    default:
+      ret = ARM_DRIVER_ERROR_UNSUPPORTED;
+      break;
+  }
+  VETH_Unlock(mac, cancel);
+
+  return ret;
+}
+
+static int32_t MAC_PHY_Read (uint8_t phy_addr, uint8_t reg_addr, uint16_t *data) {
+  VETH_MAC *mac = &veth_mac;
+  uint16_t  val;
+  int32_t   ret;
+  int       cancel;
+
+  if (data == NULL) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  cancel = VETH_Lock(mac);
+  if (((mac->flags & VETH_FLAG_POWER) == 0U) || (phy_addr != VETH_PHY_ADDR)) {
+    ret = ARM_DRIVER_ERROR;             // No management clock or no PHY at address
+  } else {
+    switch (reg_addr) {
+      case VETH_PHY_REG_BMCR:
+        val = mac->phy_bmcr;
+        break;
+      case VETH_PHY_REG_BMSR:
+        val = VETH_BMSR_100B_TX_FD | VETH_BMSR_100B_TX_HD | VETH_BMSR_10B_T_FD | VETH_BMSR_10B_T_HD |
+              VETH_BMSR_EXT_STAT   | VETH_BMSR_ANEG_ABIL  | VETH_BMSR_EXT_CAPAB;
+        if (VETH_PhyLink(mac) != 0U) {
+          val |= VETH_BMSR_LINK_STAT;
+          if ((mac->phy_bmcr & VETH_BMCR_ANEG_EN) != 0U) {
+            val |= VETH_BMSR_ANEG_COMPL;
+          }
+        }
+        break;
+      case VETH_PHY_REG_PHYIDR1:
+        val = VETH_PHY_ID1;
+        break;
+      case VETH_PHY_REG_PHYIDR2:
+        val = VETH_PHY_ID2;
+        break;
+      case VETH_PHY_REG_ANAR:
+        val = mac->phy_anar;
+        break;
+      case VETH_PHY_REG_ANLPAR:
+        // Link partner advertises the same abilities (loopback plug or host)
+        val = (VETH_PhyLink(mac) != 0U) ? mac->phy_anar : 0U;
+        break;
+      case VETH_PHY_REG_PHYSTS:
+        val = VETH_PhyStatus(mac);
+        break;
+      default:
+        val = 0U;
+        break;
+    }
+    *data = val;
+    ret   = ARM_DRIVER_OK;
+  }
+  VETH_Unlock(mac, cancel);
+
+  return ret;
+}
+
+static int32_t MAC_PHY_Write (uint8_t phy_addr, uint8_t reg_addr, uint16_t data) {
+  VETH_MAC *mac = &veth_mac;
+  int32_t   ret;
+  int       cancel;
+
+  cancel = VETH_Lock(mac);
+  if (((mac->flags & VETH_FLAG_POWER) == 0U) || (phy_addr != VETH_PHY_ADDR)) {
+    ret = ARM_DRIVER_ERROR;
+  } else {
+    switch (reg_addr) {
+      case VETH_PHY_REG_BMCR:
+        if ((data & VETH_BMCR_RESET) != 0U) {
+          mac->phy_bmcr = VETH_BMCR_ANEG_EN;
+          mac->phy_anar = 0x01E1U;
+        } else {
+          // Auto-negotiation completes immediately (restart bit is self-clearing)
+          mac->phy_bmcr = data & (uint16_t)~VETH_BMCR_REST_ANEG;
+        }
+        break;
+      case VETH_PHY_REG_ANAR:
+        mac->phy_anar = data;
+        break;
+      default:
+        break;
+    }
+    ret = ARM_DRIVER_OK;
+  }
+  VETH_Unlock(mac, cancel);
+
+  return ret;
+}
+
+/* Driver Control Block */
+
+extern ARM_DRIVER_ETH_MAC ARM_Driver_ETH_MAC_(VETH_DRV_NUM);
+       ARM_DRIVER_ETH_MAC ARM_Driver_ETH_MAC_(VETH_DRV_NUM) = {
+  MAC_GetVersion,
+  MAC_GetCapabilities,
+  MAC_Initialize,
+  MAC_Uninitialize,
+  MAC_PowerControl,
+  MAC_GetMacAddress,
+  MAC_SetMacAddress,
+  MAC_SetAddressFilter,
+  MAC_SendFrame,
+  MAC_ReadFrame,
+  MAC_GetRxFrameSize,
+  MAC_GetRxFrameTime,
+  MAC_GetTxFrameTime,
+  MAC_ControlTimer,
+  MAC_Control,
+  MAC_PHY_Read,
+  MAC_PHY_Write
+};
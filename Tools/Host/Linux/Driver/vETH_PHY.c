@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-Driver Validation
+ * Title:       Virtual Ethernet PHY (vETH) CMSIS-Driver for the Linux host
+ * Purpose:     Driver_ETH_PHY instance for the PHY device emulated by
+ *              vETH_MAC.c, accessed only through the management interface
+ *              (PHY_Read and PHY_Write functions of the MAC driver)
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "Driver_ETH_PHY.h"
+#include "vETH_Config.h"
+#include "vETH_PHY.h"
+
+#define ARM_ETH_PHY_DRV_VERSION ARM_DRIVER_VERSION_MAJOR_MINOR(1, 0)
+
+/* PHY flags */
+#define VETH_PHY_FLAG_INIT      (1U << 0)       /* Driver initialized         */
+#define VETH_PHY_FLAG_POWER     (1U << 1)       /* Driver powered             */
+
+/* PHY information */
+typedef struct {
+  ARM_ETH_PHY_Read_t  reg_rd;           /* PHY register read function         */
+  ARM_ETH_PHY_Write_t reg_wr;           /* PHY register write function        */
+  uint16_t            bmcr;             /* Basic Mode Control register value  */
+  uint8_t             flags;            /* Driver flags                       */
+} VETH_PHY;
+
+static VETH_PHY veth_phy;
+
+static const ARM_DRIVER_VERSION DriverVersion = {
+  ARM_ETH_PHY_API_VERSION,
+  ARM_ETH_PHY_DRV_VERSION
+};
+
+/* Driver functions */
+
+static ARM_DRIVER_VERSION PHY_GetVersion (void) {
+  return DriverVersion;
+}
+
+static int32_t PHY_Initialize (ARM_ETH_PHY_Read_t fn_read, ARM_ETH_PHY_Write_t fn_write) {
+
+  if ((fn_read == NULL) || (fn_write == NULL)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  if ((veth_phy.flags & VETH_PHY_FLAG_INIT) == 0U) {
+    veth_phy.reg_rd = fn_read;
+    veth_phy.reg_wr = fn_write;
+    veth_phy.bmcr   = 0U;
+    veth_phy.flags  = VETH_PHY_FLAG_INIT;
+  }
+
+  return ARM_DRIVER_OK;
+}
+
+static int32_t PHY_Uninitialize (void) {
+
+  veth_phy.reg_rd = NULL;
+  veth_phy.reg_wr = NULL;
+  veth_phy.bmcr   = 0U;
+  veth_phy.flags  = 0U;
+
+  return ARM_DRIVER_OK;
+}
+
+static int32_t PHY_PowerControl (ARM_POWER_STATE state) {
+  uint16_t val;
+
+  if ((veth_phy.flags & VETH_PHY_FLAG_INIT) == 0U) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  switch (state) {
+    case ARM_POWER_OFF:
+      veth_phy.flags &= ~VETH_PHY_FLAG_POWER;
+      veth_phy.bmcr   = VETH_BMCR_POWER_DOWN;
+      return veth_phy.reg_wr(VETH_PHY_ADDR, VETH_PHY_REG_BMCR, veth_phy.bmcr);
+
+    case ARM_POWER_FULL:
+      if ((veth_phy.flags & VETH_PHY_FLAG_POWER) != 0U) {
+        return ARM_DRIVER_OK;
+      }
+      // Check PHY identifier
+      if (veth_phy.reg_rd(VETH_PHY_ADDR, VETH_PHY_REG_PHYIDR1, &val) != ARM_DRIVER_OK) {
+        return ARM_DRIVER_ERROR;
+      }
+      if (val != VETH_PHY_ID1) {
+        return ARM_DRIVER_ERROR_UNSUPPORTED;
+      }
+      if (veth_phy.reg_rd(VETH_PHY_ADDR, VETH_PHY_REG_PHYIDR2, &val) != ARM_DRIVER_OK) {
+        return ARM_DRIVER_ERROR;
+      }
+      if (val != VETH_PHY_ID2) {
+        return ARM_DRIVER_ERROR_UNSUPPORTED;
+      }
+      veth_phy.bmcr = 0U;
+      if (veth_phy.reg_wr(VETH_PHY_ADDR, VETH_PHY_REG_BMCR, veth_phy.bmcr) != ARM_DRIVER_OK) {
+        return ARM_DRIVER_ERROR;
+      }
+      veth_phy.flags |= VETH_PHY_FLAG_POWER;
+      return ARM_DRIVER_OK;
+
+    case ARM_POWER_LOW:
+    default:
+      return ARM_DRIVER_ERROR_UNSUPPORTED;
+  }
+}
+
+static int32_t PHY_SetInterface (uint32_t interface) {
+
+  if ((veth_phy.flags & VETH_PHY_FLAG_POWER) == 0U) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  switch (interface) {
+    case ARM_ETH_INTERFACE_MII:
+    case ARM_ETH_INTERFACE_RMII:
+      return ARM_DRIVER_OK;
+    default:
+      return ARM_DRIVER_ERROR_UNSUPPORTED;
+  }
+}
+
+static int32_t PHY_SetMode (uint32_t mode) {
+  uint16_t val;
+
+  if ((veth_phy.flags & VETH_PHY_FLAG_POWER) == 0U) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  switch (mode & ARM_ETH_PHY_SPEED_Msk) {
+    case ARM_ETH_PHY_SPEED_10M:
+      val = 0U;
+      break;
+    case ARM_ETH_PHY_SPEED_100M:
+      val = VETH_BMCR_SPEED_SEL;
+      break;
+    case ARM_ETH_PHY_SPEED_1G:
+      val = VETH_BMCR_SPEED_SEL_1G;
+      break;
+    default:
+      return ARM_DRIVER_ERROR_UNSUPPORTED;
+  }
+
+  if ((mode & ARM_ETH_PHY_DUPLEX_Msk) == ARM_ETH_PHY_DUPLEX_FULL) {
+    val |= VETH_BMCR_DUPLEX;
+  }
+  if ((mode & ARM_ETH_PHY_AUTO_NEGOTIATE) != 0U) {
+    // Speed and duplex are resolved by auto-negotiation
+    val = VETH_BMCR_ANEG_EN | VETH_BMCR_REST_ANEG;
+  }
+  if ((mode & ARM_ETH_PHY_LOOPBACK) != 0U) {
+    val |= VETH_BMCR_LOOPBACK;
+  }
+  if ((mode & ARM_ETH_PHY_ISOLATE) != 0U) {
+    val |= VETH_BMCR_ISOLATE;
+  }
+
+  veth_phy.bmcr = val;
+  return veth_phy.reg_wr(VETH_PHY_ADDR, VETH_PHY_REG_BMCR, val);
+}
+
+static ARM_ETH_LINK_STATE PHY_GetLinkState (void) {
+  uint16_t val;
+
+  if ((veth_phy.flags & VETH_PHY_FLAG_POWER) == 0U) {
+    return ARM_ETH_LINK_DOWN;
+  }
+  if (veth_phy.reg_rd(VETH_PHY_ADDR, VETH_PHY_REG_BMSR, &val) != ARM_DRIVER_OK) {
+    return ARM_ETH_LINK_DOWN;
+  }
+
+  return (((val & VETH_BMSR_LINK_STAT) != 0U) ? ARM_ETH_LINK_UP : ARM_ETH_LINK_DOWN);
+}
+
+static ARM_ETH_LINK_INFO PHY_GetLinkInfo (void) {
+  ARM_ETH_LINK_INFO info;
+  uint16_t          val;
+
+  info.speed  = 0U;
+  info.duplex = 0U;
+  if (((veth_phy.flags & VETH_PHY_FLAG_POWER) != 0U) &&
+      (veth_phy.reg_rd(VETH_PHY_ADDR, VETH_PHY_REG_PHYSTS, &val) == ARM_DRIVER_OK)) {
+    info.speed  = (val & VETH_PHYSTS_SPEED_Msk) >> VETH_PHYSTS_SPEED_Pos;
+    info.duplex = ((val & VETH_PHYSTS_DUPLEX) != 0U) ? ARM_ETH_DUPLEX_FULL : ARM_ETH_DUPLEX_HALF;
+  }
+
+  return info;
+}
+
+/* Driver Control Block */
+
+extern ARM_DRIVER_ETH_PHY ARM_Driver_ETH_PHY_(VETH_DRV_NUM);
+       ARM_DRIVER_ETH_PHY ARM_Driver_ETH_PHY_(VETH_DRV_NUM) = {
+  PHY_GetVersion,
+  PHY_Initialize,
+  PHY_Uninitialize,
+  PHY_PowerControl,
+  PHY_SetInterface,
+  PHY_SetMode,
+  PHY_GetLinkState,
+  PHY_GetLinkInfo
+};
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-Driver Validation
+ * Title:       Virtual Ethernet PHY register definitions
+ *              (PHY device emulated by vETH_MAC.c, driven by vETH_PHY.c)
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef VETH_PHY_H_
+#define VETH_PHY_H_
+
+/* PHY registers */
+#define VETH_PHY_REG_BMCR       0x00U           /* Basic Mode Control         */
+#define VETH_PHY_REG_BMSR       0x01U           /* Basic Mode Status          */
+#define VETH_PHY_REG_PHYIDR1    0x02U           /* PHY Identifier 1           */
+#define VETH_PHY_REG_PHYIDR2    0x03U           /* PHY Identifier 2           */
+#define VETH_PHY_REG_ANAR       0x04U           /* Auto-Negotiation Advert.   */
+#define VETH_PHY_REG_ANLPAR     0x05U           /* Auto-Neg. Link Partner     */
+#define VETH_PHY_REG_PHYSTS     0x1FU           /* PHY Status (vendor)        */
+
+/* Basic Mode Control register */
+#define VETH_BMCR_RESET         0x8000U         /* Software Reset             */
+#define VETH_BMCR_LOOPBACK      0x4000U         /* Loopback mode              */
+#define VETH_BMCR_SPEED_SEL     0x2000U         /* Speed Select (1=100Mb/s)   */
+#define VETH_BMCR_ANEG_EN       0x1000U         /* Auto Negotiation Enable    */
+#define VETH_BMCR_POWER_DOWN    0x0800U         /* Power Down                 */
+#define VETH_BMCR_ISOLATE       0x0400U         /* Isolate Media interface    */
+#define VETH_BMCR_REST_ANEG     0x0200U         /* Restart Auto Negotiation   */
+#define VETH_BMCR_DUPLEX        0x0100U         /* Duplex Mode (1=Full)       */
+#define VETH_BMCR_SPEED_SEL_1G  0x0040U         /* Speed Select MSB (1Gb/s)   */
+
+/* Basic Mode Status register */
+#define VETH_BMSR_100B_TX_FD    0x4000U         /* 100BASE-TX Full Duplex     */
+#define VETH_BMSR_100B_TX_HD    0x2000U         /* 100BASE-TX Half Duplex     */
+#define VETH_BMSR_10B_T_FD      0x1000U         /* 10BASE-T Full Duplex       */
+#define VETH_BMSR_10B_T_HD      0x0800U         /* 10BASE-T Half Duplex       */
+#define VETH_BMSR_EXT_STAT      0x0100U         /* Extended Status (1Gb/s)    */
+#define VETH_BMSR_ANEG_COMPL    0x0020U         /* Auto Negotiation Complete  */
+#define VETH_BMSR_ANEG_ABIL     0x0008U         /* Auto Negotiation Ability   */
+#define VETH_BMSR_LINK_STAT     0x0004U         /* Link Status                */
+#define VETH_BMSR_EXT_CAPAB     0x0001U         /* Extended Capability        */
+
+/* PHY Status register (speed and duplex resolved by auto-negotiation) */
+#define VETH_PHYSTS_SPEED_Pos   0U              /* Speed (ARM_ETH_SPEED_x)    */
+#define VETH_PHYSTS_SPEED_Msk   0x0003U
+#define VETH_PHYSTS_DUPLEX      0x0004U         /* Full Duplex                */
+#define VETH_PHYSTS_LINK        0x0008U         /* Link up                    */
+
+/* PHY Identifier */
+#define VETH_PHY_ID1            0x0041U         /* Identifier register 1      */
+#define VETH_PHY_ID2            0x5240U         /* Identifier register 2      */
+
+#endif /* VETH_PHY_H_ */
@@ -0,0 +1,564 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-Driver Validation
+ * Title:       Virtual GPIO (vGPIO) CMSIS-Driver for the Linux host
+ * Purpose:     Driver_GPIO instance with:
+ *               - pins connected by named wires (VGPIO_WIREn_xxx), the line
+ *                 level is resolved from push-pull and open-drain outputs
+ *                 and pull-up and pull-down resistors of all connected pins
+ *               - edge events signaled from the GPIO thread after the
+ *                 interrupt latency (delay and seeded random jitter)
+ *
+ *              An undriven line without pull resistor keeps its last level.
+ *              Push-pull outputs driving different levels are a short
+ *              circuit: the line is low and a message is printed once.
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#define _GNU_SOURCE
+
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/prctl.h>
+
+#include "Driver_GPIO.h"
+#include "vGPIO_Config.h"
+
+/* Pin information */
+typedef struct {
+  ARM_GPIO_SignalEvent_t cb_event;      /* Event callback                     */
+  uint8_t         dir;                  /* ARM_GPIO_DIRECTION                 */
+  uint8_t         mode;                 /* ARM_GPIO_OUTPUT_MODE               */
+  uint8_t         pull;                 /* ARM_GPIO_PULL_RESISTOR             */
+  uint8_t         trigger;              /* ARM_GPIO_EVENT_TRIGGER             */
+  uint8_t         out;                  /* Output level                       */
+  uint8_t         level;                /* Line level                         */
+  uint8_t         net;                  /* Net (first pin of connected pins)  */
+  uint8_t         shorted;              /* Short circuit reported             */
+  uint8_t         setup;                /* Pin set up                         */
+  uint32_t        event;                /* Events pending (interrupt flags)   */
+  uint32_t        signal;               /* Events to be signaled              */
+  uint64_t        due;                  /* Time of signaling pending events   */
+} VGPIO_PIN;
+
+/* GPIO information */
+typedef struct {
+  pthread_mutex_t mutex;                /* GPIO lock                          */
+  int             wake[2];              /* GPIO thread wake-up pipe           */
+  uint32_t        seed;                 /* Jitter random generator state      */
+  uint32_t        pending;              /* Events to be signaled              */
+  VGPIO_PIN       pin[VGPIO_PIN_NUM];   /* Pins                               */
+} VGPIO_DEV;
+
+/* Wire connecting two pins */
+typedef struct {
+  uint32_t        en;                   /* Wire enabled                       */
+  const char     *name;                 /* Wire name                          */
+  uint32_t        pin_a;                /* Pin A                              */
+  uint32_t        pin_b;                /* Pin B                              */
+} VGPIO_WIRE;
+
+static const VGPIO_WIRE vgpio_wire[] = {
+  { VGPIO_WIRE0_EN, VGPIO_WIRE0_NAME, VGPIO_WIRE0_PIN_A, VGPIO_WIRE0_PIN_B },
+  { VGPIO_WIRE1_EN, VGPIO_WIRE1_NAME, VGPIO_WIRE1_PIN_A, VGPIO_WIRE1_PIN_B },
+  { VGPIO_WIRE2_EN, VGPIO_WIRE2_NAME, VGPIO_WIRE2_PIN_A, VGPIO_WIRE2_PIN_B },
+  { VGPIO_WIRE3_EN, VGPIO_WIRE3_NAME, VGPIO_WIRE3_PIN_A, VGPIO_WIRE3_PIN_B }
+};
+
+static VGPIO_DEV      vgpio = {
+  .mutex = PTHREAD_MUTEX_INITIALIZER,
+  .wake  = { -1, -1 }
+};
+static pthread_once_t vgpio_once = PTHREAD_ONCE_INIT;
+
+/*-----------------------------------------------------------------------------
+ * Lock GPIO (thread cancellation is disabled while locked)
+ *----------------------------------------------------------------------------*/
+static int VGPIO_Lock (VGPIO_DEV *gpio) {
+  int cancel;
+
+  (void)pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &cancel);
+  (void)pthread_mutex_lock(&gpio->mutex);
+  return (cancel);
+}
+
+/*-----------------------------------------------------------------------------
+ * Unlock GPIO and signal events
+ * (callbacks are called unlocked, like from the interrupt of the device)
+ *----------------------------------------------------------------------------*/
+static void VGPIO_Unlock (VGPIO_DEV *gpio, int cancel) {
+  ARM_GPIO_SignalEvent_t cb_event[VGPIO_PIN_NUM];
+  uint32_t               event[VGPIO_PIN_NUM];
+  uint32_t               pending, i;
+
+  pending       = gpio->pending;
+  gpio->pending = 0U;
+  if (pending != 0U) {
+    for (i = 0U; i < VGPIO_PIN_NUM; i++) {
+      cb_event[i]         = gpio->pin[i].cb_event;
+      event[i]            = gpio->pin[i].signal;
+      gpio->pin[i].signal = 0U;
+    }
+  }
+  (void)pthread_mutex_unlock(&gpio->mutex);
+
+  if (pending != 0U) {
+    for (i = 0U; i < VGPIO_PIN_NUM; i++) {
+      if ((event[i] != 0U) && (cb_event[i] != NULL)) {
+        cb_event[i](i, event[i]);
+      }
+    }
+  }
+  (void)pthread_setcancelstate(cancel, NULL);
+}
+
+/*-----------------------------------------------------------------------------
+ * Wake up GPIO thread (event pending)
+ *----------------------------------------------------------------------------*/
+static void VGPIO_Wake (const VGPIO_DEV *gpio) {
+  uint8_t val = 0U;
+
+  (void)write(gpio->wake[1], &val, 1U);
+}
+
+/*-----------------------------------------------------------------------------
+ * Get monotonic time in nanoseconds
+ *----------------------------------------------------------------------------*/
+static uint64_t VGPIO_Time (void) {
+  struct timespec now;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &now);
+  return (((uint64_t)now.tv_sec * 1000000000U) + (uint64_t)now.tv_nsec);
+}
+
+/*-----------------------------------------------------------------------------
+ * Get interrupt latency in nanoseconds
+ * (jitter from xorshift32 generator: same sequence for the same seed)
+ *----------------------------------------------------------------------------*/
+static uint64_t VGPIO_Latency (VGPIO_DEV *gpio) {
+  uint64_t latency;
+  uint32_t x;
+
+  latency = (uint64_t)VGPIO_IRQ_DELAY * 1000U;
+  if (VGPIO_IRQ_JITTER != 0) {
+    x  = gpio->seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    gpio->seed = x;
+    latency += (uint64_t)x % (((uint64_t)VGPIO_IRQ_JITTER * 1000U) + 1U);
+  }
+  return (latency);
+}
+
+/*-----------------------------------------------------------------------------
+ * Latch edge event of a pin (edges within the interrupt latency are merged)
+ *----------------------------------------------------------------------------*/
+static void VGPIO_Edge (VGPIO_DEV *gpio, VGPIO_PIN *pin, uint32_t rising) {
+  uint32_t event;
+
+  switch (pin->trigger) {
+    case ARM_GPIO_TRIGGER_RISING_EDGE:
+      event = (rising != 0U) ? ARM_GPIO_EVENT_RISING_EDGE : 0U;
+      break;
+    case ARM_GPIO_TRIGGER_FALLING_EDGE:
+      event = (rising == 0U) ? ARM_GPIO_EVENT_FALLING_EDGE : 0U;
+      break;
+    case ARM_GPIO_TRIGGER_EITHER_EDGE:
+      event = (rising != 0U) ? ARM_GPIO_EVENT_RISING_EDGE : ARM_GPIO_EVENT_FALLING_EDGE;
+      break;
+    default:
+      event = 0U;
+      break;
+  }
+  if (event == 0U) {
+    return;
+  }
+
+  if (pin->event == 0U) {
+    pin->due = VGPIO_Time() + VGPIO_Latency(gpio);
+    VGPIO_Wake(gpio);
+  }
+  pin->event |= event;
+}
+
+/*-----------------------------------------------------------------------------
+ * Resolve line level of a net and latch edge events of its pins
+ *----------------------------------------------------------------------------*/
+static void VGPIO_Resolve (VGPIO_DEV *gpio, uint32_t net) {
+  VGPIO_PIN *pin;
+  uint32_t   drive_hi, drive_lo, pull_up, pull_down, level, i;
+
+  drive_hi  = 0U;
+  drive_lo  = 0U;
+  pull_up   = 0U;
+  pull_down = 0U;
+  for (i = 0U; i < VGPIO_PIN_NUM; i++) {
+    pin = &gpio->pin[i];
+    if (pin->net != net) {
+      continue;
+    }
+    if (pin->dir == ARM_GPIO_OUTPUT) {
+      if (pin->out == 0U) {
+        drive_lo = 1U;
+      } else if (pin->mode == ARM_GPIO_PUSH_PULL) {
+        drive_hi = 1U;
+      }
+    }
+    if (pin->pull == ARM_GPIO_PULL_UP) {
+      pull_up = 1U;
+    } else if (pin->pull == ARM_GPIO_PULL_DOWN) {
+      pull_down = 1U;
+    }
+  }
+
+  pin = &gpio->pin[net];
+  if ((drive_hi != 0U) && (drive_lo != 0U)) {
+    level = 0U;
+    if (pin->shorted == 0U) {
+      pin->shorted = 1U;
+      for (i = 0U; i < (sizeof(vgpio_wire) / sizeof(vgpio_wire[0])); i++) {
+        if ((vgpio_wire[i].en != 0U) && (vgpio_wire[i].pin_a < VGPIO_PIN_NUM) &&
+            (gpio->pin[vgpio_wire[i].pin_a].net == net)) {
+          (void)fprintf(stderr, "vGPIO: short circuit on wire %s (outputs drive high and low)\n", vgpio_wire[i].name);
+          break;
+        }
+      }
+    }
+  } else if ((drive_hi != 0U) || (drive_lo != 0U)) {
+    level = drive_hi;
+  } else if (pull_up != pull_down) {
+    level = pull_up;
+  } else {
+    // Line is floating (or both pull resistors): keeps the last level
+    level = pin->level;
+  }
+
+  for (i = 0U; i < VGPIO_PIN_NUM; i++) {
+    pin = &gpio->pin[i];
+    if ((pin->net == net) && (pin->level != level)) {
+      pin->level = (uint8_t)level;
+      VGPIO_Edge(gpio, pin, level);
+    }
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ * Update GPIO: signal events after the interrupt latency
+ * (returns monotonic time of the next update or 0 if not needed)
+ *----------------------------------------------------------------------------*/
+static uint64_t VGPIO_Update (VGPIO_DEV *gpio) {
+  VGPIO_PIN *pin;
+  uint64_t   now, next;
+  uint32_t   i;
+
+  now  = VGPIO_Time();
+  next = 0U;
+  for (i = 0U; i < VGPIO_PIN_NUM; i++) {
+    pin = &gpio->pin[i];
+    if (pin->event == 0U) {
+      continue;
+    }
+    if (pin->due <= now) {
+      pin->signal  |= pin->event;
+      pin->event    = 0U;
+      gpio->pending = 1U;
+    } else if ((next == 0U) || (pin->due < next)) {
+      next = pin->due;
+    }
+  }
+
+  return (next);
+}
+
+/*-----------------------------------------------------------------------------
+ * GPIO thread: signals events (interrupt service of the device)
+ *----------------------------------------------------------------------------*/
+static void *VGPIO_Thread (void *arg) {
+  VGPIO_DEV       *gpio = (VGPIO_DEV *)arg;
+  struct pollfd    fds[1];
+  struct timespec  ts;
+  uint8_t          buf[64];
+  uint64_t         next, now;
+  int              cancel;
+
+  // Interrupt latency is down to some microseconds: no timer slack (default 50 us)
+  (void)prctl(PR_SET_TIMERSLACK, 1UL);
+
+  fds[0].fd      = gpio->wake[0];
+  fds[0].events  = POLLIN;
+  fds[0].revents = 0;
+
+  for (;;) {
+    if ((fds[0].revents & POLLIN) != 0) {
+      while (read(gpio->wake[0], buf, sizeof(buf)) > 0) {}
+    }
+
+    cancel = VGPIO_Lock(gpio);
+    next   = VGPIO_Update(gpio);
+    VGPIO_Unlock(gpio, cancel);
+
+    if (next != 0U) {
+      now = VGPIO_Time();
+      next = (next > now) ? (next - now) : 0U;
+      ts.tv_sec  = (time_t)(next / 1000000000U);
+      ts.tv_nsec = (long)(next % 1000000000U);
+      (void)ppoll(fds, 1U, &ts, NULL);
+    } else {
+      (void)ppoll(fds, 1U, NULL, NULL);
+    }
+  }
+
+  return (NULL);
+}
+
+/*-----------------------------------------------------------------------------
+ * Connect pins by wires and start GPIO thread, executed once
+ *----------------------------------------------------------------------------*/
+static void VGPIO_Init (void) {
+  const VGPIO_WIRE *wire;
+  pthread_t         thread;
+  uint32_t          net, old, i, k;
+
+  for (i = 0U; i < VGPIO_PIN_NUM; i++) {
+    vgpio.pin[i].net = (uint8_t)i;
+  }
+  for (i = 0U; i < (sizeof(vgpio_wire) / sizeof(vgpio_wire[0])); i++) {
+    wire = &vgpio_wire[i];
+    if (wire->en == 0U) {
+      continue;
+    }
+    if ((wire->pin_a >= VGPIO_PIN_NUM) || (wire->pin_b >= VGPIO_PIN_NUM)) {
+      (void)fprintf(stderr, "vGPIO: wire %s not connected (pin number above %u)\n", wire->name, VGPIO_PIN_NUM - 1U);
+      continue;
+    }
+    // Merge both nets, the net is identified by its lowest pin
+    net = vgpio.pin[wire->pin_a].net;
+    old = vgpio.pin[wire->pin_b].net;
+    if (old < net) {
+      net = old;
+      old = vgpio.pin[wire->pin_a].net;
+    }
+    for (k = 0U; k < VGPIO_PIN_NUM; k++) {
+      if (vgpio.pin[k].net == old) {
+        vgpio.pin[k].net = (uint8_t)net;
+      }
+    }
+  }
+  vgpio.seed = VGPIO_IRQ_SEED;
+
+  if (pipe2(vgpio.wake, O_NONBLOCK | O_CLOEXEC) != 0) {
+    vgpio.wake[0] = -1;
+    return;
+  }
+  if (pthread_create(&thread, NULL, VGPIO_Thread, &vgpio) != 0) {
+    (void)close(vgpio.wake[0]);
+    (void)close(vgpio.wake[1]);
+    vgpio.wake[0] = -1;
+    return;
+  }
+  (void)pthread_detach(thread);
+}
+
+/* Driver functions */
+
+static int32_t GPIO_Setup (ARM_GPIO_Pin_t pin, ARM_GPIO_SignalEvent_t cb_event) {
+  VGPIO_DEV *gpio = &vgpio;
+  VGPIO_PIN *p;
+  int        cancel;
+
+  (void)pthread_once(&vgpio_once, VGPIO_Init);
+  if (gpio->wake[0] < 0) {
+    return ARM_DRIVER_ERROR;
+  }
+  if (pin >= VGPIO_PIN_NUM) {
+    return ARM_GPIO_ERROR_PIN;
+  }
+
+  cancel = VGPIO_Lock(gpio);
+  p = &gpio->pin[pin];
+  p->cb_event = cb_event;
+  p->dir      = ARM_GPIO_INPUT;
+  p->mode     = ARM_GPIO_PUSH_PULL;
+  p->pull     = ARM_GPIO_PULL_NONE;
+  p->trigger  = ARM_GPIO_TRIGGER_NONE;
+  p->out      = 0U;
+  p->event    = 0U;
+  p->signal   = 0U;
+  p->setup    = 1U;
+  VGPIO_Resolve(gpio, p->net);
+  VGPIO_Unlock(gpio, cancel);
+
+  return ARM_DRIVER_OK;
+}
+
+static int32_t GPIO_SetDirection (ARM_GPIO_Pin_t pin, ARM_GPIO_DIRECTION direction) {
+  VGPIO_DEV *gpio = &vgpio;
+  int32_t    ret;
+  int        cancel;
+
+  if (pin >= VGPIO_PIN_NUM) {
+    return ARM_GPIO_ERROR_PIN;
+  }
+  if ((direction != ARM_GPIO_INPUT) && (direction != ARM_GPIO_OUTPUT)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  cancel = VGPIO_Lock(gpio);
+  if (gpio->pin[pin].setup != 0U) {
+    gpio->pin[pin].dir = (uint8_t)direction;
+    VGPIO_Resolve(gpio, gpio->pin[pin].net);
+    ret = ARM_DRIVER_OK;
+  } else {
+    ret = ARM_GPIO_ERROR_PIN;
+  }
+  VGPIO_Unlock(gpio, cancel);
+
+  return ret;
+}
+
+static int32_t GPIO_SetOutputMode (ARM_GPIO_Pin_t pin, ARM_GPIO_OUTPUT_MODE mode) {
+  VGPIO_DEV *gpio = &vgpio;
+  int32_t    ret;
+  int        cancel;
+
+  if (pin >= VGPIO_PIN_NUM) {
+    return ARM_GPIO_ERROR_PIN;
+  }
+  if ((mode != ARM_GPIO_PUSH_PULL) && (mode != ARM_GPIO_OPEN_DRAIN)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  cancel = VGPIO_Lock(gpio);
+  if (gpio->pin[pin].setup != 0U) {
+    gpio->pin[pin].mode = (uint8_t)mode;
+    VGPIO_Resolve(gpio, gpio->pin[pin].net);
+    ret = ARM_DRIVER_OK;
+  } else {
+    ret = ARM_GPIO_ERROR_PIN;
+  }
+  VGPIO_Unlock(gpio, cancel);
+
+  return ret;
+}
+
+static int32_t GPIO_SetPullResistor (ARM_GPIO_Pin_t pin, ARM_GPIO_PULL_RESISTOR resistor) {
+  VGPIO_DEV *gpio = &vgpio;
+  int32_t    ret;
+  int        cancel;
+
+  if (pin >= VGPIO_PIN_NUM) {
+    return ARM_GPIO_ERROR_PIN;
+  }
+  if ((resistor != ARM_GPIO_PULL_NONE) && (resistor != ARM_GPIO_PULL_UP) && (resistor != ARM_GPIO_PULL_DOWN)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  cancel = VGPIO_Lock(gpio);
+  if (gpio->pin[pin].setup != 0U) {
+    gpio->pin[pin].pull = (uint8_t)resistor;
+    VGPIO_Resolve(gpio, gpio->pin[pin].net);
+    ret = ARM_DRIVER_OK;
+  } else {
+    ret = ARM_GPIO_ERROR_PIN;
+  }
+  VGPIO_Unlock(gpio, cancel);
+
+  return ret;
+}
+
+static int32_t GPIO_SetEventTrigger (ARM_GPIO_Pin_t pin, ARM_GPIO_EVENT_TRIGGER trigger) {
+  VGPIO_DEV *gpio = &vgpio;
+  int32_t    ret;
+  int        cancel;
+
+  if (pin >= VGPIO_PIN_NUM) {
+    return ARM_GPIO_ERROR_PIN;
+  }
+  if ((trigger != ARM_GPIO_TRIGGER_NONE)         && (trigger != ARM_GPIO_TRIGGER_RISING_EDGE) &&
+      (trigger != ARM_GPIO_TRIGGER_FALLING_EDGE) && (trigger != ARM_GPIO_TRIGGER_EITHER_EDGE)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  cancel = VGPIO_Lock(gpio);
+  if (gpio->pin[pin].setup != 0U) {
+    gpio->pin[pin].trigger = (uint8_t)trigger;
+    if (trigger == ARM_GPIO_TRIGGER_NONE) {
+      // Interrupt disabled: pending events are not signaled
+      gpio->pin[pin].event = 0U;
+    }
+    ret = ARM_DRIVER_OK;
+  } else {
+    ret = ARM_GPIO_ERROR_PIN;
+  }
+  VGPIO_Unlock(gpio, cancel);
+
+  return ret;
+}
+
+static void GPIO_SetOutput (ARM_GPIO_Pin_t pin, uint32_t val) {
+  VGPIO_DEV *gpio = &vgpio;
+  int        cancel;
+
+  if (pin >= VGPIO_PIN_NUM) {
+    return;
+  }
+
+  cancel = VGPIO_Lock(gpio);
+  if (gpio->pin[pin].setup != 0U) {
+    gpio->pin[pin].out = (val != 0U) ? 1U : 0U;
+    VGPIO_Resolve(gpio, gpio->pin[pin].net);
+  }
+  VGPIO_Unlock(gpio, cancel);
+}
+
+static uint32_t GPIO_GetInput (ARM_GPIO_Pin_t pin) {
+  VGPIO_DEV *gpio = &vgpio;
+  uint32_t   val;
+  int        cancel;
+
+  if (pin >= VGPIO_PIN_NUM) {
+    return 0U;
+  }
+
+  cancel = VGPIO_Lock(gpio);
+  val    = gpio->pin[pin].level;
+  VGPIO_Unlock(gpio, cancel);
+
+  return val;
+}
+
+/* Driver Control Block */
+
+extern ARM_DRIVER_GPIO ARM_Driver_GPIO_(VGPIO_DRV_NUM);
+       ARM_DRIVER_GPIO ARM_Driver_GPIO_(VGPIO_DRV_NUM) = {
+  GPIO_Setup,
+  GPIO_SetDirection,
+  GPIO_SetOutputMode,
+  GPIO_SetPullResistor,
+  GPIO_SetEventTrigger,
+  GPIO_SetOutput,
+  GPIO_GetInput
+};
@@ -0,0 +1,732 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-Driver Validation
+ * Title:       Virtual SPI bus (vSPI) CMSIS-Driver for the Linux host
+ * Purpose:     Two Driver_SPI instances (bus ends A and B) connected by an
+ *              in-process SPI bus model:
+ *               - master and slave mode, Slave Select line (unused, software
+ *                 and hardware controlled, hardware monitored input)
+ *               - clock / frame formats, 1 to 32 data bits, bit order
+ *               - bus clock simulation at the master bus speed
+ *               - data lost (slave selected without active transfer) and
+ *                 mode fault (Slave Select activated while master with
+ *                 hardware monitored Slave Select input) events
+ *
+ *              Data is shifted bit by bit by the bus thread, so bus ends with
+ *              different data bits or bit order exchange data like real
+ *              hardware. Bus ends with different clock / frame format sample
+ *              the data lines one bit late.
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+
+#include "Driver_SPI.h"
+#include "vSPI_Config.h"
+
+#define ARM_SPI_DRV_VERSION ARM_DRIVER_VERSION_MAJOR_MINOR(1, 0)
+
+/* Bus end flags */
+#define VSPI_FLAG_INIT          (1U << 0)       /* Driver initialized         */
+#define VSPI_FLAG_POWER         (1U << 1)       /* Driver powered             */
+
+
+/* Transfer information */
+typedef struct {
+  const uint8_t  *tx_buf;               /* Transmit buffer (NULL: default Tx) */
+  uint8_t        *rx_buf;               /* Receive buffer (NULL: discard)     */
+  uint32_t        num;                  /* Number of items                    */
+  uint32_t        cnt;                  /* Number of items transferred        */
+  uint32_t        busy;                 /* Transfer active                    */
+  uint32_t        bit;                  /* Bit position in the current item   */
+  uint32_t        tx_item;              /* Item being shifted out             */
+  uint32_t        rx_item;              /* Item being shifted in              */
+} VSPI_XFER;
+
+/* Bus end (driver instance) information */
+typedef struct {
+  ARM_SPI_SignalEvent_t cb_event;       /* Event callback                     */
+  uint32_t        flags;                /* Driver flags                       */
+  uint32_t        mode;                 /* ARM_SPI_MODE_INACTIVE/MASTER/SLAVE */
+  uint32_t        format;               /* Clock / frame format field         */
+  uint32_t        data_bits;            /* Data bits (1 .. 32)                */
+  uint32_t        lsb_first;            /* Bit order LSB to MSB               */
+  uint32_t        ss_mode;              /* Slave Select mode field            */
+  uint32_t        bus_speed;            /* Master bus speed [bps]             */
+  uint32_t        def_tx;               /* Default transmit value             */
+  uint32_t        ss_sw;                /* Software Slave Select active       */
+  uint32_t        data_lost;            /* Status: data lost                  */
+  uint32_t        mode_fault;           /* Status: mode fault                 */
+  uint32_t        event;                /* Events pending to be signaled      */
+  VSPI_XFER       xfer;                 /* Transfer information               */
+} VSPI_END;
+
+/* Bus information */
+typedef struct {
+  pthread_mutex_t mutex;                /* Bus lock                           */
+  pthread_cond_t  cond;                 /* Bus thread wake-up                 */
+  VSPI_END        end[2];               /* Bus ends A and B                   */
+  uint32_t        ss_line;              /* Slave Select line active           */
+  uint32_t        mosi;                 /* Last bit on MOSI                   */
+  uint32_t        miso;                 /* Last bit on MISO                   */
+  uint64_t        bits;                 /* Bits clocked in master transfer    */
+  struct timespec start;                /* Master transfer start time         */
+} VSPI_BUS;
+
+static VSPI_BUS       vspi_bus = { .mutex = PTHREAD_MUTEX_INITIALIZER };
+static pthread_once_t vspi_once = PTHREAD_ONCE_INIT;
+
+static const ARM_DRIVER_VERSION DriverVersion = {
+  ARM_SPI_API_VERSION,
+  ARM_SPI_DRV_VERSION
+};
+
+static const ARM_SPI_CAPABILITIES DriverCapabilities = {
+  0U,                                   /* Simplex mode                       */
+  1U,                                   /* TI Synchronous Serial Interface    */
+  1U,                                   /* Microwire Interface                */
+  1U,                                   /* Mode fault event                   */
+  0U
+};
+
+/*-----------------------------------------------------------------------------
+ * Lock bus (thread cancellation is disabled while locked)
+ *----------------------------------------------------------------------------*/
+static int VSPI_Lock (void) {
+  int cancel;
+
+  (void)pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &cancel);
+  (void)pthread_mutex_lock(&vspi_bus.mutex);
+  return (cancel);
+}
+
+/*-----------------------------------------------------------------------------
+ * Unlock bus and signal pending events of both bus ends
+ * (callbacks are called unlocked, like from the interrupt of each device)
+ *----------------------------------------------------------------------------*/
+static void VSPI_Unlock (int cancel) {
+  ARM_SPI_SignalEvent_t cb_event[2];
+  uint32_t              event[2];
+  uint32_t              i;
+
+  for (i = 0U; i < 2U; i++) {
+    cb_event[i] = vspi_bus.end[i].cb_event;
+    event[i]    = vspi_bus.end[i].event;
+    vspi_bus.end[i].event = 0U;
+  }
+  (void)pthread_mutex_unlock(&vspi_bus.mutex);
+
+  for (i = 0U; i < 2U; i++) {
+    if ((event[i] != 0U) && (cb_event[i] != NULL)) {
+      cb_event[i](event[i]);
+    }
+  }
+  (void)pthread_setcancelstate(cancel, NULL);
+}
+
+/*-----------------------------------------------------------------------------
+ * Check if bus end is a selected slave
+ *----------------------------------------------------------------------------*/
+static uint32_t VSPI_SlaveSelected (const VSPI_END *end) {
+
+  if (((end->flags & VSPI_FLAG_POWER) == 0U) || (end->mode != ARM_SPI_MODE_SLAVE)) {
+    return (0U);
+  }
+  if (end->ss_mode == ARM_SPI_SS_SLAVE_SW) {
+    return (end->ss_sw);
+  }
+  return (vspi_bus.ss_line);
+}
+
+/*-----------------------------------------------------------------------------
+ * Update Slave Select line from the masters driving it
+ *----------------------------------------------------------------------------*/
+static void VSPI_LineUpdate (void) {
+  VSPI_END *end;
+  uint32_t  line, i;
+
+  line = 0U;
+  for (i = 0U; i < 2U; i++) {
+    end = &vspi_bus.end[i];
+    if (end->mode == ARM_SPI_MODE_MASTER) {
+      if (((end->ss_mode == ARM_SPI_SS_MASTER_HW_OUTPUT) && (end->xfer.busy != 0U)) ||
+          ((end->ss_mode == ARM_SPI_SS_MASTER_SW)        && (end->ss_sw     != 0U))) {
+        line = 1U;
+      }
+    }
+  }
+  if (line == vspi_bus.ss_line) {
+    return;
+  }
+  vspi_bus.ss_line = line;
+
+  for (i = 0U; i < 2U; i++) {
+    end = &vspi_bus.end[i];
+    if ((line != 0U) && (end->mode == ARM_SPI_MODE_MASTER) && (end->ss_mode == ARM_SPI_SS_MASTER_HW_INPUT)) {
+      // Slave Select activated by another master: mode fault (transfer is stopped)
+      end->xfer.busy  = 0U;
+      end->mode_fault = 1U;
+      end->event     |= ARM_SPI_EVENT_MODE_FAULT;
+    }
+    if ((line == 0U) && (end->mode == ARM_SPI_MODE_SLAVE) && (end->ss_mode == ARM_SPI_SS_SLAVE_HW)) {
+      // Deselected slave restarts the current item
+      end->xfer.bit     = 0U;
+      end->xfer.rx_item = 0U;
+    }
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ * Get next bit shifted out by a bus end
+ *----------------------------------------------------------------------------*/
+static uint32_t VSPI_BitOut (VSPI_XFER *xfer, const VSPI_END *end) {
+  uint32_t item, pos;
+
+  if (xfer->bit == 0U) {
+    item = end->def_tx;
+    if (xfer->tx_buf != NULL) {
+      if (end->data_bits > 16U) {
+        memcpy(&item, &xfer->tx_buf[xfer->cnt * 4U], 4U);
+      } else if (end->data_bits > 8U) {
+        item = (uint32_t)xfer->tx_buf[(xfer->cnt * 2U)] | ((uint32_t)xfer->tx_buf[(xfer->cnt * 2U) + 1U] << 8);
+      } else {
+        item = xfer->tx_buf[xfer->cnt];
+      }
+    }
+    xfer->tx_item = item;
+  }
+  pos = (end->lsb_first != 0U) ? xfer->bit : (end->data_bits - 1U - xfer->bit);
+
+  return ((xfer->tx_item >> pos) & 1U);
+}
+
+/*-----------------------------------------------------------------------------
+ * Shift a bit into a bus end, store completed item and signal transfer
+ * complete after the last item
+ *----------------------------------------------------------------------------*/
+static void VSPI_BitIn (VSPI_XFER *xfer, VSPI_END *end, uint32_t bit) {
+  uint32_t pos;
+
+  pos = (end->lsb_first != 0U) ? xfer->bit : (end->data_bits - 1U - xfer->bit);
+  xfer->rx_item |= bit << pos;
+  xfer->bit++;
+  if (xfer->bit < end->data_bits) {
+    return;
+  }
+
+  if (xfer->rx_buf != NULL) {
+    if (end->data_bits > 16U) {
+      memcpy(&xfer->rx_buf[xfer->cnt * 4U], &xfer->rx_item, 4U);
+    } else if (end->data_bits > 8U) {
+      xfer->rx_buf[(xfer->cnt * 2U)]      = (uint8_t)xfer->rx_item;
+      xfer->rx_buf[(xfer->cnt * 2U) + 1U] = (uint8_t)(xfer->rx_item >> 8);
+    } else {
+      xfer->rx_buf[xfer->cnt] = (uint8_t)xfer->rx_item;
+    }
+  }
+  xfer->bit     = 0U;
+  xfer->rx_item = 0U;
+  xfer->cnt++;
+  if (xfer->cnt == xfer->num) {
+    xfer->busy  = 0U;
+    end->event |= ARM_SPI_EVENT_TRANSFER_COMPLETE;
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ * Clock one bit of the master transfer
+ *----------------------------------------------------------------------------*/
+static void VSPI_Clock (VSPI_END *master, VSPI_END *slave) {
+  uint32_t mosi, miso, mosi_in, miso_in;
+
+  mosi = VSPI_BitOut(&master->xfer, master);
+  miso = 1U;                            // MISO pulled up when not driven
+
+  if (slave != NULL) {
+    if (slave->xfer.busy != 0U) {
+      miso = VSPI_BitOut(&slave->xfer, slave);
+    } else if (slave->data_lost == 0U) {
+      // Selected slave without active transfer: receive overflow / transmit underflow
+      slave->data_lost = 1U;
+      slave->event    |= ARM_SPI_EVENT_DATA_LOST;
+    }
+  }
+
+  mosi_in = mosi;
+  miso_in = miso;
+  if ((slave != NULL) && (slave->format != master->format)) {
+    // Clock / frame format mismatch: data lines are sampled one bit late
+    mosi_in = vspi_bus.mosi;
+    miso_in = vspi_bus.miso;
+  }
+  vspi_bus.mosi = mosi;
+  vspi_bus.miso = miso;
+
+  if ((slave != NULL) && (slave->xfer.busy != 0U)) {
+    VSPI_BitIn(&slave->xfer, slave, mosi_in);
+  }
+  VSPI_BitIn(&master->xfer, master, miso_in);
+}
+
+/*-----------------------------------------------------------------------------
+ * Clock the bits of the active master transfer which are due at the master
+ * bus speed (all bits when the bus clock simulation is disabled), bus locked
+ * \return  active master or NULL when no master transfer is active
+ *----------------------------------------------------------------------------*/
+static VSPI_END *VSPI_Update (void) {
+  VSPI_END        *master, *slave;
+  struct timespec  now;
+  uint64_t         bits, due;
+  uint32_t         i;
+
+  master = NULL;
+  slave  = NULL;
+  for (i = 0U; i < 2U; i++) {
+    if ((vspi_bus.end[i].mode == ARM_SPI_MODE_MASTER) && (vspi_bus.end[i].xfer.busy != 0U)) {
+      master = &vspi_bus.end[i];
+      slave  = &vspi_bus.end[i ^ 1U];
+      break;
+    }
+  }
+  if (master == NULL) {
+    return (NULL);
+  }
+  if (VSPI_SlaveSelected(slave) == 0U) {
+    slave = NULL;
+  }
+
+  bits = ((uint64_t)master->xfer.num * master->data_bits) - vspi_bus.bits;
+  if (VSPI_CLOCK_SIM != 0) {
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    due = ((((uint64_t)(now.tv_sec - vspi_bus.start.tv_sec) * 1000000000U) + (uint64_t)now.tv_nsec - (uint64_t)vspi_bus.start.tv_nsec) * master->bus_speed) / 1000000000U;
+    if ((due - vspi_bus.bits) < bits) {
+      bits = due - vspi_bus.bits;
+    }
+  }
+  for (; (bits != 0U) && (master->xfer.busy != 0U); bits--) {
+    VSPI_Clock(master, slave);
+    vspi_bus.bits++;
+  }
+  if (master->xfer.busy == 0U) {
+    VSPI_LineUpdate();                  // Hardware controlled Slave Select output deactivated
+    return (NULL);
+  }
+
+  return (master);
+}
+
+/*-----------------------------------------------------------------------------
+ * Bus thread: completes master transfers in time and signals events
+ * (data count and status are also updated by the driver functions)
+ *----------------------------------------------------------------------------*/
+static void *VSPI_Thread (void *arg) {
+  VSPI_END        *master;
+  struct timespec  wake;
+  uint64_t         ns;
+  int              cancel;
+
+  (void)arg;
+
+  cancel = VSPI_Lock();
+  for (;;) {
+    master = VSPI_Update();
+
+    if ((vspi_bus.end[0].event | vspi_bus.end[1].event) != 0U) {
+      VSPI_Unlock(cancel);              // Signal events
+      cancel = VSPI_Lock();
+      continue;
+    }
+
+    if (master == NULL) {
+      (void)pthread_cond_wait(&vspi_bus.cond, &vspi_bus.mutex);
+    } else {
+      // Wait until the end of the master transfer
+      ns  = ((((uint64_t)master->xfer.num * master->data_bits) * 1000000000U) + master->bus_speed - 1U) / master->bus_speed;
+      ns += (uint64_t)vspi_bus.start.tv_nsec;
+      wake.tv_sec  = vspi_bus.start.tv_sec + (time_t)(ns / 1000000000U);
+      wake.tv_nsec = (long)(ns % 1000000000U);
+      (void)pthread_cond_timedwait(&vspi_bus.cond, &vspi_bus.mutex, &wake);
+    }
+  }
+
+  return (NULL);
+}
+
+/*-----------------------------------------------------------------------------
+ * Initialize bus (condition variable and bus thread), executed once
+ *----------------------------------------------------------------------------*/
+static void VSPI_BusInit (void) {
+  pthread_condattr_t attr;
+  pthread_t          thread;
+
+  (void)pthread_condattr_init(&attr);
+  (void)pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+  (void)pthread_cond_init(&vspi_bus.cond, &attr);
+  (void)pthread_condattr_destroy(&attr);
+
+  vspi_bus.mosi = 1U;
+  vspi_bus.miso = 1U;
+
+  if (pthread_create(&thread, NULL, VSPI_Thread, NULL) == 0) {
+    (void)pthread_detach(thread);
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ * Stop transfer of a bus end (bus locked)
+ *----------------------------------------------------------------------------*/
+static void VSPI_XferStop (VSPI_END *end) {
+
+  end->xfer.busy = 0U;
+  VSPI_LineUpdate();
+  (void)pthread_cond_signal(&vspi_bus.cond);
+}
+
+/*-----------------------------------------------------------------------------
+ * Start transfer of a bus end
+ *----------------------------------------------------------------------------*/
+static int32_t VSPI_XferStart (VSPI_END *end, const void *data_out, void *data_in, uint32_t num) {
+  int32_t ret;
+  int     cancel;
+
+  if (num == 0U) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  cancel = VSPI_Lock();
+  (void)VSPI_Update();
+  if (((end->flags & VSPI_FLAG_POWER) == 0U) || (end->mode == ARM_SPI_MODE_INACTIVE)) {
+    ret = ARM_DRIVER_ERROR;
+  } else if (end->xfer.busy != 0U) {
+    ret = ARM_DRIVER_ERROR_BUSY;
+  } else {
+    end->xfer.tx_buf  = (const uint8_t *)data_out;
+    end->xfer.rx_buf  = (uint8_t *)data_in;
+    end->xfer.num     = num;
+    end->xfer.cnt     = 0U;
+    end->xfer.bit     = 0U;
+    end->xfer.rx_item = 0U;
+    end->xfer.busy    = 1U;
+    end->data_lost    = 0U;
+    end->mode_fault   = 0U;
+    if (end->mode == ARM_SPI_MODE_MASTER) {
+      (void)clock_gettime(CLOCK_MONOTONIC, &vspi_bus.start);
+      vspi_bus.bits = 0U;
+      VSPI_LineUpdate();                // Hardware controlled Slave Select output activated
+      (void)pthread_cond_signal(&vspi_bus.cond);
+    }
+    ret = ARM_DRIVER_OK;
+  }
+  VSPI_Unlock(cancel);
+
+  return ret;
+}
+
+/* Driver functions (common for both bus ends) */
+
+static ARM_DRIVER_VERSION SPI_GetVersion (void) {
+  return DriverVersion;
+}
+
+static ARM_SPI_CAPABILITIES SPI_GetCapabilities (void) {
+  return DriverCapabilities;
+}
+
+static int32_t SPI_Initialize (ARM_SPI_SignalEvent_t cb_event, VSPI_END *end) {
+  int cancel;
+
+  (void)pthread_once(&vspi_once, VSPI_BusInit);
+
+  cancel = VSPI_Lock();
+  end->cb_event = cb_event;
+  end->flags   |= VSPI_FLAG_INIT;
+  VSPI_Unlock(cancel);
+
+  return ARM_DRIVER_OK;
+}
+
+static int32_t SPI_PowerControl (ARM_POWER_STATE state, VSPI_END *end) {
+  int32_t ret;
+  int     cancel;
+
+  cancel = VSPI_Lock();
+  switch (state) {
+    case ARM_POWER_OFF:
+      if (end->xfer.busy != 0U) {
+        VSPI_XferStop(end);
+      }
+      end->flags     &= ~VSPI_FLAG_POWER;
+      end->mode       = ARM_SPI_MODE_INACTIVE;
+      end->ss_sw      = 0U;
+      end->data_lost  = 0U;
+      end->mode_fault = 0U;
+      end->xfer.cnt   = 0U;
+      end->event      = 0U;
+      VSPI_LineUpdate();
+      ret = ARM_DRIVER_OK;
+      break;
+
+    case ARM_POWER_FULL:
+      if ((end->flags & VSPI_FLAG_INIT) == 0U) {
+        ret = ARM_DRIVER_ERROR;
+        break;
+      }
+      if ((end->flags & VSPI_FLAG_POWER) == 0U) {
+        end->flags    |= VSPI_FLAG_POWER;
+        end->mode      = ARM_SPI_MODE_INACTIVE;
+        end->def_tx    = 0U;
+        end->bus_speed = VSPI_BUS_SPEED_MIN;
+      }
+      ret = ARM_DRIVER_OK;
+      break;
+
+    case ARM_POWER_LOW:
+    default:
+      ret = ARM_DRIVER_ERROR_UNSUPPORTED;
+      break;
+  }
+  VSPI_Unlock(cancel);
+
+  return ret;
+}
+
+static int32_t SPI_Uninitialize (VSPI_END *end) {
+  int cancel;
+
+  (void)SPI_PowerControl(ARM_POWER_OFF, end);
+
+  cancel = VSPI_Lock();
+  end->cb_event = NULL;
+  end->flags    = 0U;
+  VSPI_Unlock(cancel);
+
+  return ARM_DRIVER_OK;
+}
+
+static int32_t SPI_Send (const void *data, uint32_t num, VSPI_END *end) {
+  if (data == NULL) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  return VSPI_XferStart(end, data, NULL, num);
+}
+
+static int32_t SPI_Receive (void *data, uint32_t num, VSPI_END *end) {
+  if (data == NULL) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  return VSPI_XferStart(end, NULL, data, num);
+}
+
+static int32_t SPI_Transfer (const void *data_out, void *data_in, uint32_t num, VSPI_END *end) {
+  if ((data_out == NULL) || (data_in == NULL)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  return VSPI_XferStart(end, data_out, data_in, num);
+}
+
+static uint32_t SPI_GetDataCount (VSPI_END *end) {
+  uint32_t cnt;
+  int      cancel;
+
+  cancel = VSPI_Lock();
+  (void)VSPI_Update();
+  cnt = end->xfer.cnt;
+  VSPI_Unlock(cancel);
+
+  return cnt;
+}
+
+static int32_t SPI_Control (uint32_t control, uint32_t arg, VSPI_END *end) {
+  uint32_t mode, format, data_bits, ss_mode;
+  int32_t  ret;
+  int      cancel;
+
+  cancel = VSPI_Lock();
+  ret    = ARM_DRIVER_OK;
+  (void)VSPI_Update();
+
+  if ((end->flags & VSPI_FLAG_POWER) == 0U) {
+    VSPI_Unlock(cancel);
+    return ARM_DRIVER_ERROR;
+  }
+
+  switch (control & ARM_SPI_CONTROL_Msk) {
+    case ARM_SPI_MODE_INACTIVE:
+      if (end->xfer.busy != 0U) {
+        VSPI_XferStop(end);
+      }
+      end->mode  = ARM_SPI_MODE_INACTIVE;
+      end->ss_sw = 0U;
+      VSPI_LineUpdate();
+      break;
+
+    case ARM_SPI_MODE_MASTER:
+    case ARM_SPI_MODE_SLAVE:
+      mode      =  control & ARM_SPI_CONTROL_Msk;
+      format    =  control & ARM_SPI_FRAME_FORMAT_Msk;
+      data_bits = (control & ARM_SPI_DATA_BITS_Msk) >> ARM_SPI_DATA_BITS_Pos;
+      if (mode == ARM_SPI_MODE_MASTER) {
+        ss_mode = control & ARM_SPI_SS_MASTER_MODE_Msk;
+      } else {
+        ss_mode = control & ARM_SPI_SS_SLAVE_MODE_Msk;
+      }
+      if (end->xfer.busy != 0U) {
+        ret = ARM_DRIVER_ERROR_BUSY;
+      } else if (format > ARM_SPI_MICROWIRE) {
+        ret = ARM_SPI_ERROR_FRAME_FORMAT;
+      } else if ((data_bits == 0U) || (data_bits > 32U)) {
+        ret = ARM_SPI_ERROR_DATA_BITS;
+      } else if ((mode == ARM_SPI_MODE_MASTER) && ((arg < VSPI_BUS_SPEED_MIN) || (arg > VSPI_BUS_SPEED_MAX))) {
+        ret = ARM_DRIVER_ERROR_UNSUPPORTED;
+      } else {
+        end->mode      = mode;
+        end->format    = format;
+        end->data_bits = data_bits;
+        end->lsb_first = ((control & ARM_SPI_BIT_ORDER_Msk) == ARM_SPI_LSB_MSB) ? 1U : 0U;
+        end->ss_mode   = ss_mode;
+        end->ss_sw     = 0U;
+        if (mode == ARM_SPI_MODE_MASTER) {
+          end->bus_speed = arg;
+        }
+        end->xfer.bit     = 0U;
+        end->xfer.rx_item = 0U;
+        VSPI_LineUpdate();
+      }
+      break;
+
+    case ARM_SPI_MODE_MASTER_SIMPLEX:
+    case ARM_SPI_MODE_SLAVE_SIMPLEX:
+      ret = ARM_SPI_ERROR_MODE;
+      break;
+
+    case ARM_SPI_SET_BUS_SPEED:
+      if ((arg < VSPI_BUS_SPEED_MIN) || (arg > VSPI_BUS_SPEED_MAX)) {
+        ret = ARM_DRIVER_ERROR_UNSUPPORTED;
+      } else {
+        end->bus_speed = arg;
+      }
+      break;
+
+    case ARM_SPI_GET_BUS_SPEED:
+      ret = (int32_t)end->bus_speed;
+      break;
+
+    case ARM_SPI_SET_DEFAULT_TX_VALUE:
+      end->def_tx = arg;
+      break;
+
+    case ARM_SPI_CONTROL_SS:
+      if (((end->mode == ARM_SPI_MODE_MASTER) && (end->ss_mode == ARM_SPI_SS_MASTER_SW)) ||
+          ((end->mode == ARM_SPI_MODE_SLAVE)  && (end->ss_mode == ARM_SPI_SS_SLAVE_SW))) {
+        end->ss_sw = (arg == ARM_SPI_SS_ACTIVE) ? 1U : 0U;
+        VSPI_LineUpdate();
+      } else {
+        ret = ARM_DRIVER_ERROR;
+      }
+      break;
+
+    case ARM_SPI_ABORT_TRANSFER:
+      if (end->xfer.busy != 0U) {
+        VSPI_XferStop(end);
+      }
+      break;
+
+    default:
+      ret = ARM_DRIVER_ERROR_UNSUPPORTED;
+      break;
+  }
+  VSPI_Unlock(cancel);
+
+  return ret;
+}
+
+static ARM_SPI_STATUS SPI_GetStatus (VSPI_END *end) {
+  ARM_SPI_STATUS status;
+  int            cancel;
+
+  cancel = VSPI_Lock();
+  (void)VSPI_Update();
+  status.busy       = end->xfer.busy;
+  status.data_lost  = end->data_lost;
+  status.mode_fault = end->mode_fault;
+  status.reserved   = 0U;
+  VSPI_Unlock(cancel);
+
+  return status;
+}
+
+/* Bus end A driver functions */
+
+static int32_t        SPI_A_Initialize   (ARM_SPI_SignalEvent_t cb_event)                { return SPI_Initialize  (cb_event,                &vspi_bus.end[0]); }
+static int32_t        SPI_A_Uninitialize (void)                                          { return SPI_Uninitialize(                         &vspi_bus.end[0]); }
+static int32_t        SPI_A_PowerControl (ARM_POWER_STATE state)                         { return SPI_PowerControl(state,                   &vspi_bus.end[0]); }
+static int32_t        SPI_A_Send         (const void *data, uint32_t num)                { return SPI_Send        (data, num,               &vspi_bus.end[0]); }
+static int32_t        SPI_A_Receive      (void *data, uint32_t num)                      { return SPI_Receive     (data, num,               &vspi_bus.end[0]); }
+static int32_t        SPI_A_Transfer     (const void *data_out, void *data_in, uint32_t num) { return SPI_Transfer (data_out, data_in, num, &vspi_bus.end[0]); }
+static uint32_t       SPI_A_GetDataCount (void)                                          { return SPI_GetDataCount(                         &vspi_bus.end[0]); }
+static int32_t        SPI_A_Control      (uint32_t control, uint32_t arg)                { return SPI_Control     (control, arg,            &vspi_bus.end[0]); }
+static ARM_SPI_STATUS SPI_A_GetStatus    (void)                                          { return SPI_GetStatus   (                         &vspi_bus.end[0]); }
+
+/* Bus end B driver functions */
+
+static int32_t        SPI_B_Initialize   (ARM_SPI_SignalEvent_t cb_event)                { return SPI_Initialize  (cb_event,                &vspi_bus.end[1]); }
+static int32_t        SPI_B_Uninitialize (void)                                          { return SPI_Uninitialize(                         &vspi_bus.end[1]); }
+static int32_t        SPI_B_PowerControl (ARM_POWER_STATE state)                         { return SPI_PowerControl(state,                   &vspi_bus.end[1]); }
+static int32_t        SPI_B_Send         (const void *data, uint32_t num)                { return SPI_Send        (data, num,               &vspi_bus.end[1]); }
+static int32_t        SPI_B_Receive      (void *data, uint32_t num)                      { return SPI_Receive     (data, num,               &vspi_bus.end[1]); }
+static int32_t        SPI_B_Transfer     (const void *data_out, void *data_in, uint32_t num) { return SPI_Transfer (data_out, data_in, num, &vspi_bus.end[1]); }
+static uint32_t       SPI_B_GetDataCount (void)                                          { return SPI_GetDataCount(                         &vspi_bus.end[1]); }
+static int32_t        SPI_B_Control      (uint32_t control, uint32_t arg)                { return SPI_Control     (control, arg,            &vspi_bus.end[1]); }
+static ARM_SPI_STATUS SPI_B_GetStatus    (void)                                          { return SPI_GetStatus   (                         &vspi_bus.end[1]); }
+
+/* Driver Control Blocks */
+
+extern ARM_DRIVER_SPI ARM_Driver_SPI_(VSPI_DRV_NUM_A);
+       ARM_DRIVER_SPI ARM_Driver_SPI_(VSPI_DRV_NUM_A) = {
+  SPI_GetVersion,
+  SPI_GetCapabilities,
+  SPI_A_Initialize,
+  SPI_A_Uninitialize,
+  SPI_A_PowerControl,
+  SPI_A_Send,
+  SPI_A_Receive,
+  SPI_A_Transfer,
+  SPI_A_GetDataCount,
+  SPI_A_Control,
+  SPI_A_GetStatus
+};
+
+extern ARM_DRIVER_SPI ARM_Driver_SPI_(VSPI_DRV_NUM_B);
+       ARM_DRIVER_SPI ARM_Driver_SPI_(VSPI_DRV_NUM_B) = {
+  SPI_GetVersion,
+  SPI_GetCapabilities,
+  SPI_B_Initialize,
+  SPI_B_Uninitialize,
+  SPI_B_PowerControl,
+  SPI_B_Send,
+  SPI_B_Receive,
+  SPI_B_Transfer,
+  SPI_B_GetDataCount,
+  SPI_B_Control,
+  SPI_B_GetStatus
+};
@@ -0,0 +1,1240 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-Driver Validation
+ * Title:       Virtual USART (vUSART) CMSIS-Driver for the Linux host
+ * Purpose:     Two Driver_USART instances (line ends A and B) connected by a
+ *              pseudo-terminal pair:
+ *               - asynchronous mode, 5 to 9 data bits, parity, stop bits
+ *               - baudrate timing simulation
+ *               - RTS/CTS flow control, RTS, CTS, DTR, DSR, DCD and RI lines
+ *               - break, receive overflow, timeout, framing and parity error
+ *
+ *              Each character is passed as a line symbol carrying the frame
+ *              bits and baudrate of the sender. The receiver samples the
+ *              frame with its own settings, so line ends with different
+ *              parity, stop bits or baudrate get framing and parity errors
+ *              like real hardware. Break and modem line changes are passed
+ *              as line symbols too.
+ *
+ *              Line end A can also use a serial device (VUSART_TTY_EN):
+ *              frame settings, break and modem lines are then handled by the
+ *              serial device driver (termios).
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+
+#include "Driver_USART.h"
+#include "Linux_Host.h"
+
+#define ARM_USART_DRV_VERSION ARM_DRIVER_VERSION_MAJOR_MINOR(1, 0)
+
+/* Line end flags */
+#define VUSART_FLAG_INIT        (1U << 0)       /* Driver initialized         */
+#define VUSART_FLAG_POWER       (1U << 1)       /* Driver powered             */
+#define VUSART_FLAG_CONFIG      (1U << 2)       /* Asynchronous mode set      */
+
+/* Line symbol types */
+#define VUSART_SYM_CHAR         1U              /* Character frame            */
+#define VUSART_SYM_BREAK        2U              /* Break start / end          */
+#define VUSART_SYM_LINES        3U              /* Modem line outputs         */
+
+#define VUSART_OUT_SIZE         256U            /* Output buffer size [bytes] */
+#define VUSART_OUT_RESERVE      32U             /* Reserved for line changes  */
+
+/* Line symbol (pseudo-terminal) */
+typedef struct {
+  uint8_t         type;                 /* VUSART_SYM_CHAR/BREAK/LINES        */
+  uint8_t         len;                  /* Frame bits after the start bit     */
+  uint16_t        bits;                 /* Frame bits (LSB first) / state     */
+  uint32_t        baudrate;             /* Baudrate of the sender             */
+} VUSART_SYM;
+
+/* Transfer information */
+typedef struct {
+  const uint8_t  *tx_buf;               /* Transmit buffer                    */
+  uint8_t        *rx_buf;               /* Receive buffer                     */
+  uint32_t        num;                  /* Number of items                    */
+  uint32_t        cnt;                  /* Number of items transferred        */
+  uint32_t        busy;                 /* Transfer active                    */
+  uint32_t        active;               /* Tx: character on the line,         */
+                                        /* Rx: receive timeout pending        */
+  uint32_t        cont;                 /* Tx: next character follows at t    */
+  uint64_t        t;                    /* Tx: character end, Rx: last char   */
+} VUSART_XFER;
+
+/* Line end (driver instance) information */
+typedef struct {
+  pthread_mutex_t mutex;                /* Line end lock                      */
+  ARM_USART_SignalEvent_t cb_event;     /* Event callback                     */
+  uint32_t        flags;                /* Driver flags                       */
+  int             fd;                   /* Line file descriptor (-1: none)    */
+  int             tty;                  /* Serial device                      */
+  int             wake[2];              /* Line thread wake-up pipe           */
+  uint32_t        data_bits;            /* Data bits (5 .. 9)                 */
+  uint32_t        parity;               /* Parity field                       */
+  uint32_t        stop_half;            /* Stop bits in half bits             */
+  uint32_t        flow_control;         /* Flow control field                 */
+  uint32_t        baudrate;             /* Baudrate [bps]                     */
+  uint32_t        tx_en;                /* Transmitter enabled                */
+  uint32_t        rx_en;                /* Receiver enabled                   */
+  uint32_t        brk;                  /* Break transmitted                  */
+  uint32_t        lines_ctrl;           /* Controlled outputs VUSART_LINE_x   */
+  uint32_t        lines_out;            /* Output state on the line           */
+  uint32_t        lines_in;             /* Input state (outputs of the peer)  */
+  uint32_t        rx_overflow;          /* Status: receive overflow           */
+  uint32_t        rx_break;             /* Status: break detected             */
+  uint32_t        rx_framing_error;     /* Status: framing error              */
+  uint32_t        rx_parity_error;      /* Status: parity error               */
+  uint32_t        event;                /* Events pending to be signaled      */
+  VUSART_XFER     tx;                   /* Send information                   */
+  VUSART_XFER     rx;                   /* Receive information                */
+  uint8_t         in[sizeof(VUSART_SYM)]; /* Partial symbol / PARMRK sequence */
+  uint32_t        in_len;               /* Bytes in the input buffer          */
+  uint8_t         out[VUSART_OUT_SIZE]; /* Bytes not yet written to the line  */
+  uint32_t        out_len;              /* Bytes in the output buffer         */
+} VUSART_END;
+
+static VUSART_END     vusart_end[2] = {
+  { .mutex = PTHREAD_MUTEX_INITIALIZER, .fd = -1, .wake = { -1, -1 } },
+  { .mutex = PTHREAD_MUTEX_INITIALIZER, .fd = -1, .wake = { -1, -1 } }
+};
+static pthread_once_t vusart_once = PTHREAD_ONCE_INIT;
+
+/* Baudrates of the serial device */
+static const struct {
+  uint32_t baudrate;
+  speed_t  speed;
+} vusart_tty_speed[] = {
+  {    1200U,    B1200 }, {    2400U,    B2400 }, {    4800U,    B4800 }, {    9600U,    B9600 },
+  {   19200U,   B19200 }, {   38400U,   B38400 }, {   57600U,   B57600 }, {  115200U,  B115200 },
+  {  230400U,  B230400 }, {  460800U,  B460800 }, {  500000U,  B500000 }, {  576000U,  B576000 },
+  {  921600U,  B921600 }, { 1000000U, B1000000 }, { 1152000U, B1152000 }, { 1500000U, B1500000 },
+  { 2000000U, B2000000 }, { 2500000U, B2500000 }, { 3000000U, B3000000 }, { 3500000U, B3500000 },
+  { 4000000U, B4000000 }
+};
+
+static const ARM_DRIVER_VERSION DriverVersion = {
+  ARM_USART_API_VERSION,
+  ARM_USART_DRV_VERSION
+};
+
+static const ARM_USART_CAPABILITIES DriverCapabilities = {
+  1U,                                   /* Asynchronous mode                  */
+  0U,                                   /* Synchronous master mode            */
+  0U,                                   /* Synchronous slave mode             */
+  0U,                                   /* Single-wire mode                   */
+  0U,                                   /* IrDA mode                          */
+  0U,                                   /* Smart card mode                    */
+  0U,                                   /* Smart card clock generator         */
+  1U,                                   /* RTS flow control                   */
+  1U,                                   /* CTS flow control                   */
+  1U,                                   /* Transmit completed event           */
+  1U,                                   /* Receive character timeout event    */
+  1U,                                   /* RTS line                           */
+  1U,                                   /* CTS line                           */
+  1U,                                   /* DTR line                           */
+  1U,                                   /* DSR line                           */
+  1U,                                   /* DCD line                           */
+  1U,                                   /* RI line                            */
+  1U,                                   /* CTS line change event              */
+  1U,                                   /* DSR line change event              */
+  1U,                                   /* DCD line change event              */
+  1U,                                   /* RI trailing edge event             */
+  0U
+};
+
+/*-----------------------------------------------------------------------------
+ * Lock line end (thread cancellation is disabled while locked)
+ *----------------------------------------------------------------------------*/
+static int VUSART_Lock (VUSART_END *end) {
+  int cancel;
+
+  (void)pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &cancel);
+  (void)pthread_mutex_lock(&end->mutex);
+  return (cancel);
+}
+
+/*-----------------------------------------------------------------------------
+ * Unlock line end and signal pending events
+ * (callback is called unlocked, like from the interrupt of the device)
+ *----------------------------------------------------------------------------*/
+static void VUSART_Unlock (VUSART_END *end, int cancel) {
+  ARM_USART_SignalEvent_t cb_event;
+  uint32_t                event;
+
+  cb_event   = end->cb_event;
+  event      = end->event;
+  end->event = 0U;
+  (void)pthread_mutex_unlock(&end->mutex);
+
+  if ((event != 0U) && (cb_event != NULL)) {
+    cb_event(event);
+  }
+  (void)pthread_setcancelstate(cancel, NULL);
+}
+
+/*-----------------------------------------------------------------------------
+ * Wake up line thread (timing of the line end changed)
+ *----------------------------------------------------------------------------*/
+static void VUSART_Wake (const VUSART_END *end) {
+  uint8_t val = 0U;
+
+  (void)write(end->wake[1], &val, 1U);
+}
+
+/*-----------------------------------------------------------------------------
+ * Get monotonic time in nanoseconds
+ *----------------------------------------------------------------------------*/
+static uint64_t VUSART_Time (void) {
+  struct timespec now;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &now);
+  return (((uint64_t)now.tv_sec * 1000000000U) + (uint64_t)now.tv_nsec);
+}
+
+/*-----------------------------------------------------------------------------
+ * Get character time (start bit, data bits, parity bit and stop bits) [ns]
+ *----------------------------------------------------------------------------*/
+static uint64_t VUSART_CharTime (const VUSART_END *end) {
+  uint32_t half_bits;
+
+  half_bits = (2U * (1U + end->data_bits + ((end->parity != ARM_USART_PARITY_NONE) ? 1U : 0U))) + end->stop_half;
+
+  return (((uint64_t)half_bits * 500000000U) / end->baudrate);
+}
+
+/*-----------------------------------------------------------------------------
+ * Write pending output to the line (output which does not fit into the
+ * device buffer stays pending until the line thread can write it)
+ *----------------------------------------------------------------------------*/
+static void VUSART_Flush (VUSART_END *end) {
+  ssize_t n;
+
+  if (end->out_len == 0U) {
+    return;
+  }
+  n = write(end->fd, end->out, end->out_len);
+  if (n > 0) {
+    end->out_len -= (uint32_t)n;
+    memmove(end->out, &end->out[n], end->out_len);
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ * Put bytes to the line output
+ *----------------------------------------------------------------------------*/
+static void VUSART_Output (VUSART_END *end, const void *data, uint32_t len) {
+
+  if ((end->out_len + len) > VUSART_OUT_SIZE) {
+    return;
+  }
+  memcpy(&end->out[end->out_len], data, len);
+  end->out_len += len;
+  VUSART_Flush(end);
+}
+
+/*-----------------------------------------------------------------------------
+ * Put a line symbol to the line output (pseudo-terminal)
+ *----------------------------------------------------------------------------*/
+static void VUSART_OutputSym (VUSART_END *end, uint32_t type, uint32_t len, uint32_t bits) {
+  VUSART_SYM sym;
+
+  sym.type     = (uint8_t)type;
+  sym.len      = (uint8_t)len;
+  sym.bits     = (uint16_t)bits;
+  sym.baudrate = end->baudrate;
+  VUSART_Output(end, &sym, sizeof(sym));
+}
+
+/*-----------------------------------------------------------------------------
+ * Update modem line outputs on the line
+ *----------------------------------------------------------------------------*/
+static void VUSART_LinesUpdate (VUSART_END *end) {
+  uint32_t lines;
+  int      bits;
+
+  // DCD and RI are driven by pins, independent of the driver state
+  lines = end->lines_ctrl & (VUSART_LINE_DCD | VUSART_LINE_RI);
+  if ((end->flags & VUSART_FLAG_POWER) != 0U) {
+    if ((end->flow_control == ARM_USART_FLOW_CONTROL_RTS) || (end->flow_control == ARM_USART_FLOW_CONTROL_RTS_CTS)) {
+      // RTS flow control: request data while receive is active
+      if ((end->rx_en != 0U) && (end->rx.busy != 0U)) {
+        lines |= VUSART_LINE_RTS;
+      }
+    } else {
+      lines |= end->lines_ctrl & VUSART_LINE_RTS;
+    }
+    lines |= end->lines_ctrl & VUSART_LINE_DTR;
+  }
+  if (lines == end->lines_out) {
+    return;
+  }
+  end->lines_out = lines;
+
+  if (end->tty != 0) {
+    bits = (((lines & VUSART_LINE_RTS) != 0U) ? TIOCM_RTS : 0) | (((lines & VUSART_LINE_DTR) != 0U) ? TIOCM_DTR : 0);
+    (void)ioctl(end->fd, TIOCMBIS, &bits);
+    bits = (TIOCM_RTS | TIOCM_DTR) & ~bits;
+    (void)ioctl(end->fd, TIOCMBIC, &bits);
+  } else {
+    VUSART_OutputSym(end, VUSART_SYM_LINES, 0U, lines);
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ * Update modem line inputs (outputs of the peer) and signal changes
+ *----------------------------------------------------------------------------*/
+static void VUSART_LinesIn (VUSART_END *end, uint32_t lines) {
+  uint32_t changed;
+
+  changed       = end->lines_in ^ lines;
+  end->lines_in = lines;
+  if ((end->flags & VUSART_FLAG_POWER) == 0U) {
+    return;
+  }
+  if ((changed & VUSART_LINE_RTS) != 0U) {
+    end->event |= ARM_USART_EVENT_CTS;
+  }
+  if ((changed & VUSART_LINE_DTR) != 0U) {
+    end->event |= ARM_USART_EVENT_DSR;
+  }
+  if ((changed & VUSART_LINE_DCD) != 0U) {
+    end->event |= ARM_USART_EVENT_DCD;
+  }
+  if (((changed & VUSART_LINE_RI) != 0U) && ((lines & VUSART_LINE_RI) == 0U)) {
+    end->event |= ARM_USART_EVENT_RI;   // Trailing edge
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ * Receive a character with its frame errors
+ *----------------------------------------------------------------------------*/
+static void VUSART_RxChar (VUSART_END *end, uint32_t item, uint32_t framing_error, uint32_t parity_error, uint64_t now) {
+
+  if (((end->flags & VUSART_FLAG_CONFIG) == 0U) || (end->rx_en == 0U)) {
+    return;
+  }
+  if (framing_error != 0U) {
+    end->rx_framing_error = 1U;
+    end->event           |= ARM_USART_EVENT_RX_FRAMING_ERROR;
+  }
+  if (parity_error != 0U) {
+    end->rx_parity_error  = 1U;
+    end->event           |= ARM_USART_EVENT_RX_PARITY_ERROR;
+  }
+  if (end->rx.busy == 0U) {
+    // Character received without active receive operation is lost
+    end->rx_overflow = 1U;
+    end->event      |= ARM_USART_EVENT_RX_OVERFLOW;
+    return;
+  }
+
+  if (end->data_bits == 9U) {
+    end->rx.rx_buf[(end->rx.cnt * 2U)]      = (uint8_t)item;
+    end->rx.rx_buf[(end->rx.cnt * 2U) + 1U] = (uint8_t)(item >> 8);
+  } else {
+    end->rx.rx_buf[end->rx.cnt] = (uint8_t)item;
+  }
+  end->rx.cnt++;
+  end->rx.t      = now;
+  end->rx.active = 1U;
+  if (end->rx.cnt == end->rx.num) {
+    end->rx.busy = 0U;
+    end->event  |= ARM_USART_EVENT_RECEIVE_COMPLETE;
+    VUSART_LinesUpdate(end);            // RTS flow control
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ * Sample a character frame with the settings of the receiving line end
+ *----------------------------------------------------------------------------*/
+static void VUSART_RxFrame (VUSART_END *end, const VUSART_SYM *sym, uint64_t now) {
+  uint32_t frame, item, pos, parity, framing_error, parity_error;
+
+  if (((end->flags & VUSART_FLAG_CONFIG) == 0U) || (end->rx_en == 0U)) {
+    return;
+  }
+
+  // Line is idle (1) after the stop bits of the sender
+  frame = (uint32_t)sym->bits | (0xFFFFFFFFU << sym->len);
+
+  framing_error = 0U;
+  parity_error  = 0U;
+  if (((uint64_t)((sym->baudrate > end->baudrate) ? (sym->baudrate - end->baudrate) : (end->baudrate - sym->baudrate)) * 100U) >
+       ((uint64_t)end->baudrate * 3U)) {
+    // Baudrate mismatch (more than 3 %): bits are sampled at wrong positions
+    frame         = frame >> 1;
+    framing_error = 1U;
+  }
+
+  item = frame & ((1U << end->data_bits) - 1U);
+  pos  = end->data_bits;
+  if (end->parity != ARM_USART_PARITY_NONE) {
+    parity = (uint32_t)__builtin_parity(item) ^ ((end->parity == ARM_USART_PARITY_ODD) ? 1U : 0U);
+    if (((frame >> pos) & 1U) != parity) {
+      parity_error = 1U;
+    }
+    pos++;
+  }
+  if (((frame >> pos) & 1U) == 0U) {
+    framing_error = 1U;                 // Stop bit not detected
+  }
+
+  VUSART_RxChar(end, item, framing_error, parity_error, now);
+}
+
+/*-----------------------------------------------------------------------------
+ * Receive break start / end
+ *----------------------------------------------------------------------------*/
+static void VUSART_RxBreak (VUSART_END *end, uint32_t active) {
+
+  if ((active == 0U) || ((end->flags & VUSART_FLAG_CONFIG) == 0U) || (end->rx_en == 0U)) {
+    return;
+  }
+  end->rx_break = 1U;
+  end->event   |= ARM_USART_EVENT_RX_BREAK;
+}
+
+/*-----------------------------------------------------------------------------
+ * Process bytes received from the line
+ *----------------------------------------------------------------------------*/
+static void VUSART_LineIn (VUSART_END *end, const uint8_t *data, uint32_t len, uint64_t now) {
+  VUSART_SYM sym;
+  uint32_t   i;
+  uint8_t    ch;
+
+  for (i = 0U; i < len; i++) {
+    ch = data[i];
+
+    if (end->tty != 0) {
+      // Serial device: errors are marked with 0xFF 0x00 (PARMRK), 0xFF 0x00 0x00 is break
+      if (end->in_len == 0U) {
+        if (ch == 0xFFU) {
+          end->in_len = 1U;
+        } else {
+          VUSART_RxChar(end, ch, 0U, 0U, now);
+        }
+      } else if (end->in_len == 1U) {
+        if (ch == 0x00U) {
+          end->in_len = 2U;
+        } else {
+          end->in_len = 0U;
+          VUSART_RxChar(end, ch, 0U, 0U, now);
+        }
+      } else {
+        end->in_len = 0U;
+        if (ch == 0x00U) {
+          VUSART_RxBreak(end, 1U);
+        } else if (end->parity != ARM_USART_PARITY_NONE) {
+          VUSART_RxChar(end, ch, 0U, 1U, now);
+        } else {
+          VUSART_RxChar(end, ch, 1U, 0U, now);
+        }
+      }
+      continue;
+    }
+
+    end->in[end->in_len++] = ch;
+    if (end->in_len < sizeof(VUSART_SYM)) {
+      continue;
+    }
+    end->in_len = 0U;
+    memcpy(&sym, end->in, sizeof(sym));
+
+    switch (sym.type) {
+      case VUSART_SYM_CHAR:
+        VUSART_RxFrame(end, &sym, now);
+        break;
+      case VUSART_SYM_BREAK:
+        VUSART_RxBreak(end, sym.bits);
+        break;
+      case VUSART_SYM_LINES:
+        VUSART_LinesIn(end, sym.bits);
+        break;
+      default:
+        break;
+    }
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ * Transmit a character frame
+ *----------------------------------------------------------------------------*/
+static void VUSART_TxFrame (VUSART_END *end, uint32_t item) {
+  uint32_t bits, len;
+  uint8_t  ch;
+
+  if (end->tty != 0) {
+    ch = (uint8_t)item;
+    VUSART_Output(end, &ch, 1U);
+    return;
+  }
+
+  item &= (1U << end->data_bits) - 1U;
+  bits  = item;
+  len   = end->data_bits;
+  if (end->parity != ARM_USART_PARITY_NONE) {
+    bits |= ((uint32_t)__builtin_parity(item) ^ ((end->parity == ARM_USART_PARITY_ODD) ? 1U : 0U)) << len;
+    len++;
+  }
+  bits |= ((1U << ((end->stop_half + 1U) / 2U)) - 1U) << len;
+  len  += (end->stop_half + 1U) / 2U;
+
+  VUSART_OutputSym(end, VUSART_SYM_CHAR, len, bits);
+}
+
+/*-----------------------------------------------------------------------------
+ * Update line end: receive timeout, modem inputs of the serial device and
+ * characters sent which are due at the baudrate (line end locked)
+ * \return  time of the next update [ns] or 0 when no update is pending
+ *----------------------------------------------------------------------------*/
+static uint64_t VUSART_Update (VUSART_END *end) {
+  uint64_t now, char_time, due, next;
+  uint32_t item, lines;
+  int      bits;
+
+  if ((end->flags & VUSART_FLAG_CONFIG) == 0U) {
+    return (0U);
+  }
+  now       = VUSART_Time();
+  char_time = VUSART_CharTime(end);
+  next      = 0U;
+
+  if (end->tty != 0) {
+    if (ioctl(end->fd, TIOCMGET, &bits) == 0) {
+      lines = (((bits & TIOCM_CTS) != 0) ? VUSART_LINE_RTS : 0U) |
+              (((bits & TIOCM_DSR) != 0) ? VUSART_LINE_DTR : 0U) |
+              (((bits & TIOCM_CAR) != 0) ? VUSART_LINE_DCD : 0U) |
+              (((bits & TIOCM_RNG) != 0) ? VUSART_LINE_RI  : 0U);
+      VUSART_LinesIn(end, lines);
+    }
+    next = now + 1000000U;              // Modem lines are polled every 1 ms
+  }
+
+  if ((end->rx.busy != 0U) && (end->rx.active != 0U)) {
+    due = end->rx.t + (VUSART_RX_TIMEOUT * char_time);
+    if (now >= due) {
+      end->rx.active = 0U;
+      end->event    |= ARM_USART_EVENT_RX_TIMEOUT;
+    } else if ((next == 0U) || (due < next)) {
+      next = due;
+    }
+  }
+
+  while ((end->tx.busy != 0U) && (end->tx_en != 0U) && (end->brk == 0U)) {
+    if (end->tx.active == 0U) {
+      if (((end->flow_control == ARM_USART_FLOW_CONTROL_CTS) || (end->flow_control == ARM_USART_FLOW_CONTROL_RTS_CTS)) &&
+          ((end->lines_in & VUSART_LINE_RTS) == 0U)) {
+        end->tx.cont = 0U;              // CTS flow control: wait for CTS active
+        break;
+      }
+      if ((end->out_len + sizeof(VUSART_SYM)) > (VUSART_OUT_SIZE - VUSART_OUT_RESERVE)) {
+        end->tx.cont = 0U;              // Wait until line output is written
+        break;
+      }
+      end->tx.t      = ((end->tx.cont != 0U) ? end->tx.t : now) + char_time;
+      end->tx.active = 1U;
+    }
+    if ((VUSART_CLOCK_SIM != 0) && (now < end->tx.t)) {
+      if ((next == 0U) || (end->tx.t < next)) {
+        next = end->tx.t;
+      }
+      break;
+    }
+
+    if (end->data_bits == 9U) {
+      item = (uint32_t)end->tx.tx_buf[(end->tx.cnt * 2U)] | ((uint32_t)end->tx.tx_buf[(end->tx.cnt * 2U) + 1U] << 8);
+    } else {
+      item = end->tx.tx_buf[end->tx.cnt];
+    }
+    VUSART_TxFrame(end, item);
+    end->tx.active = 0U;
+    end->tx.cont   = 1U;
+    end->tx.cnt++;
+    if (end->tx.cnt == end->tx.num) {
+      end->tx.busy = 0U;
+      end->event  |= ARM_USART_EVENT_SEND_COMPLETE | ARM_USART_EVENT_TX_COMPLETE;
+    }
+  }
+
+  return (next);
+}
+
+/*-----------------------------------------------------------------------------
+ * Line thread: receives from the line, sends characters in time and
+ * signals events (counts and status are also updated by the driver functions)
+ *----------------------------------------------------------------------------*/
+static void *VUSART_Thread (void *arg) {
+  VUSART_END      *end = (VUSART_END *)arg;
+  struct pollfd    fds[2];
+  struct timespec  ts;
+  uint8_t          buf[512];
+  ssize_t          n;
+  uint64_t         next, now;
+  int              cancel;
+
+  fds[0].fd      = end->fd;
+  fds[0].revents = 0;
+  fds[1].fd      = end->wake[0];
+  fds[1].events  = POLLIN;
+  fds[1].revents = 0;
+
+  for (;;) {
+    // Wake-up pipe is drained first, it shares the buffer with the line input
+    if ((fds[1].revents & POLLIN) != 0) {
+      while (read(end->wake[0], buf, sizeof(buf)) > 0) {}
+    }
+    n = 0;
+    if ((fds[0].revents & (POLLIN | POLLERR | POLLHUP)) != 0) {
+      n = read(end->fd, buf, sizeof(buf));
+      if ((n == 0) || ((n < 0) && (errno != EAGAIN) && (errno != EINTR))) {
+        fds[0].fd = -1;                 // Line closed (serial device removed)
+      }
+    }
+
+    cancel = VUSART_Lock(end);
+    if (n > 0) {
+      VUSART_LineIn(end, buf, (uint32_t)n, VUSART_Time());
+    }
+    next = VUSART_Update(end);
+    VUSART_Flush(end);
+    fds[0].events = POLLIN | ((end->out_len != 0U) ? POLLOUT : 0);
+    VUSART_Unlock(end, cancel);
+
+    if (next != 0U) {
+      now = VUSART_Time();
+      next = (next > now) ? (next - now) : 0U;
+      ts.tv_sec  = (time_t)(next / 1000000000U);
+      ts.tv_nsec = (long)(next % 1000000000U);
+      (void)ppoll(fds, 2U, &ts, NULL);
+    } else {
+      (void)ppoll(fds, 2U, NULL, NULL);
+    }
+  }
+
+  return (NULL);
+}
+
+/*-----------------------------------------------------------------------------
+ * Initialize line (pseudo-terminal pair or serial device and line threads),
+ * executed once
+ *----------------------------------------------------------------------------*/
+static void VUSART_LineInit (void) {
+  struct termios tio;
+  pthread_t      thread;
+  uint32_t       i;
+  int            fd;
+
+  if (VUSART_TTY_EN != 0) {
+    vusart_end[0].fd  = open(VUSART_TTY_DEV, O_RDWR | O_NOCTTY | O_NONBLOCK);
+    vusart_end[0].tty = 1;
+  } else {
+    fd = posix_openpt(O_RDWR | O_NOCTTY | O_NONBLOCK);
+    if ((fd >= 0) && (grantpt(fd) == 0) && (unlockpt(fd) == 0)) {
+      vusart_end[0].fd = fd;
+      vusart_end[1].fd = open(ptsname(fd), O_RDWR | O_NOCTTY | O_NONBLOCK);
+    }
+  }
+
+  for (i = 0U; i < 2U; i++) {
+    fd = vusart_end[i].fd;
+    if (fd < 0) {
+      continue;
+    }
+    // Raw mode: line symbols and characters are passed unmodified
+    if (tcgetattr(fd, &tio) == 0) {
+      cfmakeraw(&tio);
+      tio.c_cflag |= CLOCAL | CREAD;
+      (void)tcsetattr(fd, TCSANOW, &tio);
+    }
+    if ((pipe2(vusart_end[i].wake, O_NONBLOCK) != 0) ||
+        (pthread_create(&thread, NULL, VUSART_Thread, &vusart_end[i]) != 0)) {
+      vusart_end[i].fd = -1;
+      continue;
+    }
+    (void)pthread_detach(thread);
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ * Configure serial device frame format and baudrate
+ *----------------------------------------------------------------------------*/
+static int32_t VUSART_TtyConfig (const VUSART_END *end, uint32_t data_bits, uint32_t parity, uint32_t stop_half, uint32_t baudrate) {
+  struct termios tio;
+  uint32_t       i;
+
+  for (i = 0U; i < (sizeof(vusart_tty_speed) / sizeof(vusart_tty_speed[0])); i++) {
+    if (vusart_tty_speed[i].baudrate == baudrate) {
+      break;
+    }
+  }
+  if (i == (sizeof(vusart_tty_speed) / sizeof(vusart_tty_speed[0]))) {
+    return ARM_USART_ERROR_BAUDRATE;
+  }
+  if (data_bits == 9U) {
+    return ARM_USART_ERROR_DATA_BITS;
+  }
+  if ((stop_half != 2U) && (stop_half != 4U)) {
+    return ARM_USART_ERROR_STOP_BITS;
+  }
+  if (tcgetattr(end->fd, &tio) != 0) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  cfmakeraw(&tio);
+  tio.c_cflag &= ~(CSIZE | PARENB | PARODD | CSTOPB | CRTSCTS);
+  tio.c_cflag |= CLOCAL | CREAD;
+  switch (data_bits) {
+    case 5U:  tio.c_cflag |= CS5; break;
+    case 6U:  tio.c_cflag |= CS6; break;
+    case 7U:  tio.c_cflag |= CS7; break;
+    default:  tio.c_cflag |= CS8; break;
+  }
+  if (parity != ARM_USART_PARITY_NONE) {
+    tio.c_cflag |= PARENB | ((parity == ARM_USART_PARITY_ODD) ? PARODD : 0U);
+    tio.c_iflag |= INPCK;
+  }
+  if (stop_half == 4U) {
+    tio.c_cflag |= CSTOPB;
+  }
+  tio.c_iflag |= PARMRK;                // Mark errors and break in the input
+  (void)cfsetispeed(&tio, vusart_tty_speed[i].speed);
+  (void)cfsetospeed(&tio, vusart_tty_speed[i].speed);
+
+  if (tcsetattr(end->fd, TCSADRAIN, &tio) != 0) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  return ARM_DRIVER_OK;
+}
+
+/*-----------------------------------------------------------------------------
+ * Get line end of a driver instance
+ *----------------------------------------------------------------------------*/
+static VUSART_END *VUSART_GetEnd (uint32_t drv_num) {
+
+  if (drv_num == VUSART_DRV_NUM_A) {
+    return (&vusart_end[0]);
+  }
+  if (drv_num == VUSART_DRV_NUM_B) {
+    return (&vusart_end[1]);
+  }
+  return (NULL);
+}
+
+/**
+  \fn          int32_t vUSART_SetLine (uint32_t drv_num, uint32_t line, uint32_t active)
+  \brief       Drive an output line of a virtual USART line end which has no
+               Driver_USART control function (DCD and RI, driven by pins of
+               the USART Server).
+  \param[in]   drv_num  Driver_USART# of the line end
+  \param[in]   line     Output line (VUSART_LINE_DCD or VUSART_LINE_RI)
+  \param[in]   active   Line state (0: inactive, != 0: active)
+  \return      ARM_DRIVER_OK or ARM_DRIVER_ERROR
+*/
+int32_t vUSART_SetLine (uint32_t drv_num, uint32_t line, uint32_t active) {
+  VUSART_END *end;
+  int         cancel;
+
+  end = VUSART_GetEnd(drv_num);
+  if ((end == NULL) || ((line & ~(VUSART_LINE_DCD | VUSART_LINE_RI)) != 0U)) {
+    return ARM_DRIVER_ERROR;
+  }
+  (void)pthread_once(&vusart_once, VUSART_LineInit);
+  if ((end->fd < 0) || (end->tty != 0)) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  cancel = VUSART_Lock(end);
+  if (active != 0U) {
+    end->lines_ctrl |=  line;
+  } else {
+    end->lines_ctrl &= ~line;
+  }
+  VUSART_LinesUpdate(end);
+  VUSART_Unlock(end, cancel);
+
+  return ARM_DRIVER_OK;
+}
+
+/* Driver functions (common for both line ends) */
+
+static ARM_DRIVER_VERSION USART_GetVersion (void) {
+  return DriverVersion;
+}
+
+static ARM_USART_CAPABILITIES USART_GetCapabilities (void) {
+  return DriverCapabilities;
+}
+
+static int32_t USART_Initialize (ARM_USART_SignalEvent_t cb_event, VUSART_END *end) {
+  int cancel;
+
+  (void)pthread_once(&vusart_once, VUSART_LineInit);
+  if (end->fd < 0) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  cancel = VUSART_Lock(end);
+  end->cb_event = cb_event;
+  end->flags   |= VUSART_FLAG_INIT;
+  VUSART_Unlock(end, cancel);
+
+  return ARM_DRIVER_OK;
+}
+
+static int32_t USART_PowerControl (ARM_POWER_STATE state, VUSART_END *end) {
+  int32_t ret;
+  int     cancel;
+
+  cancel = VUSART_Lock(end);
+  switch (state) {
+    case ARM_POWER_OFF:
+      if (end->brk != 0U) {
+        end->brk = 0U;
+        if (end->tty != 0) {
+          (void)ioctl(end->fd, TIOCCBRK);
+        } else {
+          VUSART_OutputSym(end, VUSART_SYM_BREAK, 0U, 0U);
+        }
+      }
+      end->flags           &= ~(VUSART_FLAG_POWER | VUSART_FLAG_CONFIG);
+      end->tx.busy          = 0U;
+      end->tx.active        = 0U;
+      end->tx.cnt           = 0U;
+      end->rx.busy          = 0U;
+      end->rx.active        = 0U;
+      end->rx.cnt           = 0U;
+      end->tx_en            = 0U;
+      end->rx_en            = 0U;
+      end->lines_ctrl      &= ~(VUSART_LINE_RTS | VUSART_LINE_DTR);
+      end->rx_overflow      = 0U;
+      end->rx_break         = 0U;
+      end->rx_framing_error = 0U;
+      end->rx_parity_error  = 0U;
+      end->event            = 0U;
+      VUSART_LinesUpdate(end);
+      ret = ARM_DRIVER_OK;
+      break;
+
+    case ARM_POWER_FULL:
+      if ((end->flags & VUSART_FLAG_INIT) == 0U) {
+        ret = ARM_DRIVER_ERROR;
+        break;
+      }
+      if ((end->flags & VUSART_FLAG_POWER) == 0U) {
+        end->flags       |= VUSART_FLAG_POWER;
+        end->data_bits    = 8U;
+        end->parity       = ARM_USART_PARITY_NONE;
+        end->stop_half    = 2U;
+        end->flow_control = ARM_USART_FLOW_CONTROL_NONE;
+        end->baudrate     = 115200U;
+      }
+      ret = ARM_DRIVER_OK;
+      break;
+
+    case ARM_POWER_LOW:
+    default:
+      ret = ARM_DRIVER_ERROR_UNSUPPORTED;
+      break;
+  }
+  VUSART_Unlock(end, cancel);
+
+  return ret;
+}
+
+static int32_t USART_Uninitialize (VUSART_END *end) {
+  int cancel;
+
+  (void)USART_PowerControl(ARM_POWER_OFF, end);
+
+  cancel = VUSART_Lock(end);
+  end->cb_event = NULL;
+  end->flags    = 0U;
+  VUSART_Unlock(end, cancel);
+
+  return ARM_DRIVER_OK;
+}
+
+static int32_t USART_Send (const void *data, uint32_t num, VUSART_END *end) {
+  int32_t ret;
+  int     cancel;
+
+  if ((data == NULL) || (num == 0U)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  cancel = VUSART_Lock(end);
+  (void)VUSART_Update(end);
+  if (((end->flags & VUSART_FLAG_CONFIG) == 0U) || (end->tx_en == 0U)) {
+    ret = ARM_DRIVER_ERROR;
+  } else if ((end->tx.busy != 0U) || (end->brk != 0U)) {
+    ret = ARM_DRIVER_ERROR_BUSY;
+  } else {
+    end->tx.tx_buf = (const uint8_t *)data;
+    end->tx.num    = num;
+    end->tx.cnt    = 0U;
+    end->tx.active = 0U;
+    end->tx.cont   = 0U;
+    end->tx.busy   = 1U;
+    (void)VUSART_Update(end);           // First character is started
+    VUSART_Wake(end);
+    ret = ARM_DRIVER_OK;
+  }
+  VUSART_Unlock(end, cancel);
+
+  return ret;
+}
+
+static int32_t USART_Receive (void *data, uint32_t num, VUSART_END *end) {
+  int32_t ret;
+  int     cancel;
+
+  if ((data == NULL) || (num == 0U)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  cancel = VUSART_Lock(end);
+  if ((end->flags & VUSART_FLAG_CONFIG) == 0U) {
+    ret = ARM_DRIVER_ERROR;
+  } else if (end->rx.busy != 0U) {
+    ret = ARM_DRIVER_ERROR_BUSY;
+  } else {
+    end->rx.rx_buf        = (uint8_t *)data;
+    end->rx.num           = num;
+    end->rx.cnt           = 0U;
+    end->rx.active        = 0U;
+    end->rx.busy          = 1U;
+    end->rx_overflow      = 0U;
+    end->rx_break         = 0U;
+    end->rx_framing_error = 0U;
+    end->rx_parity_error  = 0U;
+    VUSART_LinesUpdate(end);            // RTS flow control
+    ret = ARM_DRIVER_OK;
+  }
+  VUSART_Unlock(end, cancel);
+
+  return ret;
+}
+
+static int32_t USART_Transfer (const void *data_out, void *data_in, uint32_t num, VUSART_END *end) {
+  (void)data_out;
+  (void)data_in;
+  (void)num;
+  (void)end;
+
+  // Synchronous modes are not supported
+  return ARM_DRIVER_ERROR;
+}
+
+static uint32_t USART_GetTxCount (VUSART_END *end) {
+  uint32_t cnt;
+  int      cancel;
+
+  cancel = VUSART_Lock(end);
+  (void)VUSART_Update(end);
+  cnt = end->tx.cnt;
+  VUSART_Unlock(end, cancel);
+
+  return cnt;
+}
+
+static uint32_t USART_GetRxCount (VUSART_END *end) {
+  uint32_t cnt;
+  int      cancel;
+
+  cancel = VUSART_Lock(end);
+  (void)VUSART_Update(end);
+  cnt = end->rx.cnt;
+  VUSART_Unlock(end, cancel);
+
+  return cnt;
+}
+
+static int32_t USART_Control (uint32_t control, uint32_t arg, VUSART_END *end) {
+  uint32_t data_bits, parity, stop_half;
+  int32_t  ret;
+  int      cancel;
+
+  cancel = VUSART_Lock(end);
+  ret    = ARM_DRIVER_OK;
+  (void)VUSART_Update(end);
+
+  if ((end->flags & VUSART_FLAG_POWER) == 0U) {
+    VUSART_Unlock(end, cancel);
+    return ARM_DRIVER_ERROR;
+  }
+
+  switch (control & ARM_USART_CONTROL_Msk) {
+    case ARM_USART_MODE_ASYNCHRONOUS:
+      switch (control & ARM_USART_DATA_BITS_Msk) {
+        case ARM_USART_DATA_BITS_5: data_bits = 5U; break;
+        case ARM_USART_DATA_BITS_6: data_bits = 6U; break;
+        case ARM_USART_DATA_BITS_7: data_bits = 7U; break;
+        case ARM_USART_DATA_BITS_8: data_bits = 8U; break;
+        case ARM_USART_DATA_BITS_9: data_bits = 9U; break;
+        default:                    data_bits = 0U; break;
+      }
+      parity = control & ARM_USART_PARITY_Msk;
+      switch (control & ARM_USART_STOP_BITS_Msk) {
+        case ARM_USART_STOP_BITS_1:   stop_half = 2U; break;
+        case ARM_USART_STOP_BITS_2:   stop_half = 4U; break;
+        case ARM_USART_STOP_BITS_1_5: stop_half = 3U; break;
+        default:                      stop_half = 1U; break;
+      }
+      if ((end->tx.busy != 0U) || (end->rx.busy != 0U)) {
+        ret = ARM_DRIVER_ERROR_BUSY;
+      } else if (data_bits == 0U) {
+        ret = ARM_USART_ERROR_DATA_BITS;
+      } else if ((parity != ARM_USART_PARITY_NONE) && (parity != ARM_USART_PARITY_EVEN) && (parity != ARM_USART_PARITY_ODD)) {
+        ret = ARM_USART_ERROR_PARITY;
+      } else if ((arg < VUSART_BAUDRATE_MIN) || (arg > VUSART_BAUDRATE_MAX)) {
+        ret = ARM_USART_ERROR_BAUDRATE;
+      } else if ((end->tty != 0) && ((ret = VUSART_TtyConfig(end, data_bits, parity, stop_half, arg)) != ARM_DRIVER_OK)) {
+        // Frame format or baudrate not supported by the serial device
+      } else {
+        end->data_bits    = data_bits;
+        end->parity       = parity;
+        end->stop_half    = stop_half;
+        end->flow_control = control & ARM_USART_FLOW_CONTROL_Msk;
+        end->baudrate     = arg;
+        end->flags       |= VUSART_FLAG_CONFIG;
+        VUSART_LinesUpdate(end);
+      }
+      break;
+
+    case ARM_USART_MODE_SYNCHRONOUS_MASTER:
+    case ARM_USART_MODE_SYNCHRONOUS_SLAVE:
+    case ARM_USART_MODE_SINGLE_WIRE:
+    case ARM_USART_MODE_IRDA:
+    case ARM_USART_MODE_SMART_CARD:
+      ret = ARM_USART_ERROR_MODE;
+      break;
+
+    case ARM_USART_CONTROL_TX:
+      end->tx_en = (arg != 0U) ? 1U : 0U;
+      VUSART_Wake(end);
+      break;
+
+    case ARM_USART_CONTROL_RX:
+      end->rx_en = (arg != 0U) ? 1U : 0U;
+      VUSART_LinesUpdate(end);          // RTS flow control
+      break;
+
+    case ARM_USART_CONTROL_BREAK:
+      if ((end->flags & VUSART_FLAG_CONFIG) == 0U) {
+        ret = ARM_DRIVER_ERROR;
+      } else if ((arg != 0U) && (end->tx.busy != 0U)) {
+        ret = ARM_DRIVER_ERROR_BUSY;
+      } else if (((arg != 0U) ? 1U : 0U) != end->brk) {
+        end->brk = (arg != 0U) ? 1U : 0U;
+        if (end->tty != 0) {
+          (void)ioctl(end->fd, (end->brk != 0U) ? TIOCSBRK : TIOCCBRK);
+        } else {
+          VUSART_OutputSym(end, VUSART_SYM_BREAK, 0U, end->brk);
+        }
+        VUSART_Wake(end);
+      }
+      break;
+
+    case ARM_USART_ABORT_SEND:
+      end->tx.busy   = 0U;
+      end->tx.active = 0U;
+      end->tx.cnt    = 0U;
+      break;
+
+    case ARM_USART_ABORT_RECEIVE:
+      end->rx.busy   = 0U;
+      end->rx.active = 0U;
+      end->rx.cnt    = 0U;
+      VUSART_LinesUpdate(end);          // RTS flow control
+      break;
+
+    case ARM_USART_ABORT_TRANSFER:
+      ret = ARM_DRIVER_ERROR;
+      break;
+
+    default:
+      ret = ARM_DRIVER_ERROR_UNSUPPORTED;
+      break;
+  }
+  if (end->out_len != 0U) {
+    VUSART_Wake(end);                   // Line thread writes pending output
+  }
+  VUSART_Unlock(end, cancel);
+
+  return ret;
+}
+
+static ARM_USART_STATUS USART_GetStatus (VUSART_END *end) {
+  ARM_USART_STATUS status;
+  int              cancel;
+
+  cancel = VUSART_Lock(end);
+  (void)VUSART_Update(end);
+  status.tx_busy          = end->tx.busy;
+  status.rx_busy          = end->rx.busy;
+  status.tx_underflow     = 0U;
+  status.rx_overflow      = end->rx_overflow;
+  status.rx_break         = end->rx_break;
+  status.rx_framing_error = end->rx_framing_error;
+  status.rx_parity_error  = end->rx_parity_error;
+  status.reserved         = 0U;
+  VUSART_Unlock(end, cancel);
+
+  return status;
+}
+
+static int32_t USART_SetModemControl (ARM_USART_MODEM_CONTROL control, VUSART_END *end) {
+  int32_t ret;
+  int     cancel;
+
+  cancel = VUSART_Lock(end);
+  ret    = ARM_DRIVER_OK;
+  if ((end->flags & VUSART_FLAG_POWER) == 0U) {
+    ret = ARM_DRIVER_ERROR;
+  } else {
+    switch (control) {
+      case ARM_USART_RTS_CLEAR:
+      case ARM_USART_RTS_SET:
+        if ((end->flow_control == ARM_USART_FLOW_CONTROL_RTS) || (end->flow_control == ARM_USART_FLOW_CONTROL_RTS_CTS)) {
+          ret = ARM_DRIVER_ERROR;       // RTS is controlled by the receiver
+        } else if (control == ARM_USART_RTS_SET) {
+          end->lines_ctrl |=  VUSART_LINE_RTS;
+        } else {
+          end->lines_ctrl &= ~VUSART_LINE_RTS;
+        }
+        break;
+      case ARM_USART_DTR_CLEAR:
+        end->lines_ctrl &= ~VUSART_LINE_DTR;
+        break;
+      case ARM_USART_DTR_SET:
+        end->lines_ctrl |=  VUSART_LINE_DTR;
+        break;
+      default:
+        ret = ARM_DRIVER_ERROR_PARAMETER;
+        break;
+    }
+    VUSART_LinesUpdate(end);
+  }
+  if (end->out_len != 0U) {
+    VUSART_Wake(end);
+  }
+  VUSART_Unlock(end, cancel);
+
+  return ret;
+}
+
+static ARM_USART_MODEM_STATUS USART_GetModemStatus (VUSART_END *end) {
+  ARM_USART_MODEM_STATUS status;
+  int                    cancel;
+
+  cancel = VUSART_Lock(end);
+  (void)VUSART_Update(end);
+  status.cts      = ((end->lines_in & VUSART_LINE_RTS) != 0U) ? 1U : 0U;
+  status.dsr      = ((end->lines_in & VUSART_LINE_DTR) != 0U) ? 1U : 0U;
+  status.dcd      = ((end->lines_in & VUSART_LINE_DCD) != 0U) ? 1U : 0U;
+  status.ri       = ((end->lines_in & VUSART_LINE_RI)  != 0U) ? 1U : 0U;
+  status.reserved = 0U;
+  VUSART_Unlock(end, cancel);
+
+  return status;
+}
+
+/* Line end A driver functions */
+
+static int32_t                USART_A_Initialize      (ARM_USART_SignalEvent_t cb_event)                  { return USART_Initialize     (cb_event,                &vusart_end[0]); }
+static int32_t                USART_A_Uninitialize    (void)                                              { return USART_Uninitialize   (                         &vusart_end[0]); }
+static int32_t                USART_A_PowerControl    (ARM_POWER_STATE state)                             { return USART_PowerControl   (state,                   &vusart_end[0]); }
+static int32_t                USART_A_Send            (const void *data, uint32_t num)                    { return USART_Send           (data, num,               &vusart_end[0]); }
+static int32_t                USART_A_Receive         (void *data, uint32_t num)                          { return USART_Receive        (data, num,               &vusart_end[0]); }
+static int32_t                USART_A_Transfer        (const void *data_out, void *data_in, uint32_t num) { return USART_Transfer       (data_out, data_in, num,  &vusart_end[0]); }
+static uint32_t               USART_A_GetTxCount      (void)                                              { return USART_GetTxCount     (                         &vusart_end[0]); }
+static uint32_t               USART_A_GetRxCount      (void)                                              { return USART_GetRxCount     (                         &vusart_end[0]); }
+static int32_t                USART_A_Control         (uint32_t control, uint32_t arg)                    { return USART_Control        (control, arg,            &vusart_end[0]); }
+static ARM_USART_STATUS       USART_A_GetStatus       (void)                                              { return USART_GetStatus      (                         &vusart_end[0]); }
+static int32_t                USART_A_SetModemControl (ARM_USART_MODEM_CONTROL control)                   { return USART_SetModemControl(control,                 &vusart_end[0]); }
+static ARM_USART_MODEM_STATUS USART_A_GetModemStatus  (void)                                              { return USART_GetModemStatus (                         &vusart_end[0]); }
+
+/* Line end B driver functions */
+
+static int32_t                USART_B_Initialize      (ARM_USART_SignalEvent_t cb_event)                  { return USART_Initialize     (cb_event,                &vusart_end[1]); }
+static int32_t                USART_B_Uninitialize    (void)                                              { return USART_Uninitialize   (                         &vusart_end[1]); }
+static int32_t                USART_B_PowerControl    (ARM_POWER_STATE state)                             { return USART_PowerControl   (state,                   &vusart_end[1]); }
+static int32_t                USART_B_Send            (const void *data, uint32_t num)                    { return USART_Send           (data, num,               &vusart_end[1]); }
+static int32_t                USART_B_Receive         (void *data, uint32_t num)                          { return USART_Receive        (data, num,               &vusart_end[1]); }
+static int32_t                USART_B_Transfer        (const void *data_out, void *data_in, uint32_t num) { return USART_Transfer       (data_out, data_in, num,  &vusart_end[1]); }
+static uint32_t               USART_B_GetTxCount      (void)                                              { return USART_GetTxCount     (                         &vusart_end[1]); }
+static uint32_t               USART_B_GetRxCount      (void)                                              { return USART_GetRxCount     (                         &vusart_end[1]); }
+static int32_t                USART_B_Control         (uint32_t control, uint32_t arg)                    { return USART_Control        (control, arg,            &vusart_end[1]); }
+static ARM_USART_STATUS       USART_B_GetStatus       (void)                                              { return USART_GetStatus      (                         &vusart_end[1]); }
+static int32_t                USART_B_SetModemControl (ARM_USART_MODEM_CONTROL control)                   { return USART_SetModemControl(control,                 &vusart_end[1]); }
+static ARM_USART_MODEM_STATUS USART_B_GetModemStatus  (void)                                              { return USART_GetModemStatus (                         &vusart_end[1]); }
+
+/* Driver Control Blocks */
+
+extern ARM_DRIVER_USART ARM_Driver_USART_(VUSART_DRV_NUM_A);
+       ARM_DRIVER_USART ARM_Driver_USART_(VUSART_DRV_NUM_A) = {
+  USART_GetVersion,
+  USART_GetCapabilities,
+  USART_A_Initialize,
+  USART_A_Uninitialize,
+  USART_A_PowerControl,
+  USART_A_Send,
+  USART_A_Receive,
+  USART_A_Transfer,
+  USART_A_GetTxCount,
+  USART_A_GetRxCount,
+  USART_A_Control,
+  USART_A_GetStatus,
+  USART_A_SetModemControl,
+  USART_A_GetModemStatus
+};
+
+extern ARM_DRIVER_USART ARM_Driver_USART_(VUSART_DRV_NUM_B);
+       ARM_DRIVER_USART ARM_Driver_USART_(VUSART_DRV_NUM_B) = {
+  USART_GetVersion,
+  USART_GetCapabilities,
+  USART_B_Initialize,
+  USART_B_Uninitialize,
+  USART_B_PowerControl,
+  USART_B_Send,
+  USART_B_Receive,
+  USART_B_Transfer,
+  USART_B_GetTxCount,
+  USART_B_GetRxCount,
+  USART_B_Control,
+  USART_B_GetStatus,
+  USART_B_SetModemControl,
+  USART_B_GetModemStatus
+};
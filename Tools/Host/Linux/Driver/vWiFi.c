@@ -0,0 +1,1555 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-Driver Validation
+ * Title:       Virtual WiFi (vWiFi) CMSIS-Driver for the Linux host
+ * Purpose:     Driver_WiFi instance (station) with:
+ *               - Scan, Activate and GetNetInfo of a simulated access point
+ *                 (VWIFI_AP_xxx), options stored per interface
+ *               - socket functions on Linux BSD sockets (IPv4), with the
+ *                 return codes of the strict DV_WIFI checks
+ *               - blocking and non-blocking sockets, receive, send and
+ *                 connect timeouts
+ *               - SocketGetHostByName on the Linux resolver, Ping on an
+ *                 ICMP socket
+ *               - link rate limit of sent and received data (VWIFI_RATE_MAX)
+ *
+ *              Sockets use the station address VWIFI_STA_IP as local
+ *              address, so a SockServer on the same host (other loopback
+ *              address) can connect back and use the same port numbers.
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/ip.h>
+#include <netinet/ip_icmp.h>
+#include <sys/socket.h>
+
+#include "Driver_WiFi.h"
+#include "vWiFi_Config.h"
+
+#define ARM_WIFI_DRV_VERSION ARM_DRIVER_VERSION_MAJOR_MINOR(1, 0)
+
+/* WiFi flags */
+#define VWIFI_FLAG_INIT         (1U << 0)       /* Driver initialized         */
+#define VWIFI_FLAG_POWER        (1U << 1)       /* Driver powered             */
+
+/* Socket states */
+#define VWIFI_SOCK_FREE         0U              /* Not created                */
+#define VWIFI_SOCK_CLOSING      1U              /* Closed, still in use       */
+#define VWIFI_SOCK_CREATED      2U              /* Created (or bound)         */
+#define VWIFI_SOCK_LISTEN       3U              /* Listening                  */
+#define VWIFI_SOCK_CONNECTING   4U              /* Connect in progress        */
+#define VWIFI_SOCK_CONNECTED    5U              /* Connected                  */
+
+#define VWIFI_OPT_NUM           (ARM_WIFI_IP_DHCP_LEASE_TIME + 1U)
+
+/* Socket */
+typedef struct {
+  int             fd;                   /* Linux socket (non-blocking)        */
+  uint32_t        busy;                 /* Functions using the socket         */
+  uint8_t         state;                /* Socket state (VWIFI_SOCK_xxx)      */
+  uint8_t         type;                 /* ARM_SOCKET_SOCK_xxx                */
+  uint8_t         bound;                /* Bound to a local address           */
+  uint8_t         any;                  /* Bound to the unspecified address   */
+  uint8_t         nbio;                 /* Non-blocking mode (FIONBIO)        */
+  uint32_t        rcvtimeo;             /* Receive timeout [ms] (0: none)     */
+  uint32_t        sndtimeo;             /* Send timeout [ms] (0: none)        */
+  uint32_t        keepalive;            /* Keep-alive option value            */
+  uint64_t        conn_t;               /* Connect start time [ms]            */
+} VWIFI_SOCK;
+
+/* WiFi information */
+typedef struct {
+  pthread_mutex_t mutex;                /* WiFi lock                          */
+  uint32_t        flags;                /* Driver flags                       */
+  uint32_t        connected;            /* Station connected to the AP        */
+  uint8_t         ch;                   /* Channel of the connection          */
+  uint8_t         bssid[6];             /* BSSID of the access point          */
+  struct in_addr  sta_ip;               /* Station address (0: any)           */
+  uint16_t        ping_seq;             /* Ping sequence number               */
+  uint8_t         opt[VWIFI_OPT_NUM][8];/* Station option values              */
+  uint32_t        sock_next;            /* Next socket searched by create     */
+  uint64_t        link_t;               /* Link busy until [ns]               */
+  VWIFI_SOCK      sock[VWIFI_SOCKET_NUM]; /* Sockets                          */
+} VWIFI_DEV;
+
+static VWIFI_DEV      vwifi = {
+  .mutex = PTHREAD_MUTEX_INITIALIZER
+};
+static pthread_once_t vwifi_once = PTHREAD_ONCE_INIT;
+
+/* Length of station options (0: not supported by a station) */
+static const uint8_t vwifi_opt_len[VWIFI_OPT_NUM] = {
+  0U,                                   /* -                                  */
+  6U,                                   /* ARM_WIFI_BSSID                     */
+  4U,                                   /* ARM_WIFI_TX_POWER                  */
+  4U,                                   /* ARM_WIFI_LP_TIMER                  */
+  4U,                                   /* ARM_WIFI_DTIM                      */
+  0U,                                   /* ARM_WIFI_BEACON (AP only)          */
+  6U,                                   /* ARM_WIFI_MAC                       */
+  4U,                                   /* ARM_WIFI_IP                        */
+  4U,                                   /* ARM_WIFI_IP_SUBNET_MASK            */
+  4U,                                   /* ARM_WIFI_IP_GATEWAY                */
+  4U,                                   /* ARM_WIFI_IP_DNS1                   */
+  4U,                                   /* ARM_WIFI_IP_DNS2                   */
+  4U,                                   /* ARM_WIFI_IP_DHCP                   */
+  0U,                                   /* ARM_WIFI_IP_DHCP_POOL_BEGIN (AP)   */
+  0U,                                   /* ARM_WIFI_IP_DHCP_POOL_END (AP)     */
+  0U                                    /* ARM_WIFI_IP_DHCP_LEASE_TIME (AP)   */
+};
+
+static const ARM_DRIVER_VERSION DriverVersion = {
+  ARM_WIFI_API_VERSION,
+  ARM_WIFI_DRV_VERSION
+};
+
+static const ARM_WIFI_CAPABILITIES DriverCapabilities = {
+  1U,                                   /* station                            */
+  0U,                                   /* ap                                 */
+  0U,                                   /* station_ap                         */
+  0U,                                   /* wps_station                        */
+  0U,                                   /* wps_ap                             */
+  0U,                                   /* event_ap_connect                   */
+  0U,                                   /* event_ap_disconnect                */
+  0U,                                   /* event_eth_rx_frame                 */
+  0U,                                   /* bypass_mode                        */
+  1U,                                   /* ip                                 */
+  0U,                                   /* ip6                                */
+  1U,                                   /* ping                               */
+  0U
+};
+
+/*-----------------------------------------------------------------------------
+ * Lock WiFi (thread cancellation is disabled while locked)
+ *----------------------------------------------------------------------------*/
+static int VWIFI_Lock (VWIFI_DEV *wifi) {
+  int cancel;
+
+  (void)pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &cancel);
+  (void)pthread_mutex_lock(&wifi->mutex);
+  return (cancel);
+}
+
+/*-----------------------------------------------------------------------------
+ * Unlock WiFi
+ *----------------------------------------------------------------------------*/
+static void VWIFI_Unlock (VWIFI_DEV *wifi, int cancel) {
+
+  (void)pthread_mutex_unlock(&wifi->mutex);
+  (void)pthread_setcancelstate(cancel, NULL);
+}
+
+/*-----------------------------------------------------------------------------
+ * Get monotonic time in milliseconds
+ *----------------------------------------------------------------------------*/
+static uint64_t VWIFI_Time (void) {
+  struct timespec now;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &now);
+  return (((uint64_t)now.tv_sec * 1000U) + ((uint64_t)now.tv_nsec / 1000000U));
+}
+
+/*-----------------------------------------------------------------------------
+ * Pace sent or received data to the link rate (airtime shared by all sockets)
+ *----------------------------------------------------------------------------*/
+static void VWIFI_Link (VWIFI_DEV *wifi, int32_t num) {
+#if (VWIFI_RATE_MAX != 0)
+  struct timespec ts;
+  uint64_t        now, end;
+  int             cancel;
+
+  if (num <= 0) {
+    return;
+  }
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  now = ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+
+  cancel = VWIFI_Lock(wifi);
+  // Idle link: up to 1 ms of airtime is credited (sleep wake-up latency)
+  end = (wifi->link_t + 1000000U > now) ? wifi->link_t : (now - 1000000U);
+  end += ((uint64_t)num * 8000000U) / VWIFI_RATE_MAX;
+  wifi->link_t = end;
+  VWIFI_Unlock(wifi, cancel);
+
+  ts.tv_sec  = (time_t)(end / 1000000000U);
+  ts.tv_nsec = (long)(end % 1000000000U);
+  while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR);
+#else
+  (void)wifi;
+  (void)num;
+#endif
+}
+
+/*-----------------------------------------------------------------------------
+ * Parse MAC address string (xx-xx-xx-xx-xx-xx)
+ *----------------------------------------------------------------------------*/
+static void VWIFI_ParseMAC (const char *str, uint8_t *mac) {
+
+  if (sscanf(str, "%hhx-%hhx-%hhx-%hhx-%hhx-%hhx", &mac[0], &mac[1], &mac[2], &mac[3], &mac[4], &mac[5]) != 6) {
+    memset(mac, 0, 6U);
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ * Initialize WiFi (once): station address and default option values
+ *----------------------------------------------------------------------------*/
+static void VWIFI_Init (void) {
+  VWIFI_DEV *wifi = &vwifi;
+  uint32_t   i;
+
+  if (inet_pton(AF_INET, VWIFI_STA_IP, &wifi->sta_ip) != 1) {
+    wifi->sta_ip.s_addr = htonl(INADDR_ANY);
+  }
+  VWIFI_ParseMAC(VWIFI_AP_BSSID, wifi->bssid);
+  VWIFI_ParseMAC(VWIFI_STA_MAC,  wifi->opt[ARM_WIFI_MAC]);
+  memcpy(wifi->opt[ARM_WIFI_IP], &wifi->sta_ip, 4U);
+  wifi->opt[ARM_WIFI_IP_SUBNET_MASK][0] = 255U;
+  wifi->opt[ARM_WIFI_IP_DHCP][0]        = 1U;
+  wifi->opt[ARM_WIFI_DTIM][0]           = 1U;
+
+  for (i = 0U; i < VWIFI_SOCKET_NUM; i++) {
+    wifi->sock[i].fd = -1;
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ * Map Linux error number to socket return code
+ *----------------------------------------------------------------------------*/
+static int32_t VWIFI_Error (int err) {
+
+  switch (err) {
+    case EAGAIN:
+#if (EWOULDBLOCK != EAGAIN)
+    case EWOULDBLOCK:
+#endif
+      return ARM_SOCKET_EAGAIN;
+    case EINPROGRESS:
+      return ARM_SOCKET_EINPROGRESS;
+    case EALREADY:
+      return ARM_SOCKET_EALREADY;
+    case ETIMEDOUT:
+      return ARM_SOCKET_ETIMEDOUT;
+    case EISCONN:
+      return ARM_SOCKET_EISCONN;
+    case ENOTCONN:
+    case EDESTADDRREQ:
+      return ARM_SOCKET_ENOTCONN;
+    case ECONNREFUSED:
+      return ARM_SOCKET_ECONNREFUSED;
+    case ECONNRESET:
+    case EPIPE:
+      return ARM_SOCKET_ECONNRESET;
+    case ECONNABORTED:
+      return ARM_SOCKET_ECONNABORTED;
+    case EADDRINUSE:
+      return ARM_SOCKET_EADDRINUSE;
+    case EINVAL:
+    case EADDRNOTAVAIL:
+    case EMSGSIZE:
+      return ARM_SOCKET_EINVAL;
+    case EOPNOTSUPP:
+      return ARM_SOCKET_ENOTSUP;
+    case ENOMEM:
+    case ENOBUFS:
+    case EMFILE:
+    case ENFILE:
+      return ARM_SOCKET_ENOMEM;
+    default:
+      return ARM_SOCKET_ERROR;
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ * Wait for socket events
+ * (timeout in ms, 0: wait forever; thread cancellation point)
+ * Returns: > 0 events, 0 timeout
+ *----------------------------------------------------------------------------*/
+static int VWIFI_Wait (int fd, short events, uint32_t timeout) {
+  struct pollfd pfd;
+  uint64_t      end, now;
+  int           tmo, n;
+
+  end = VWIFI_Time() + timeout;
+  pfd.fd     = fd;
+  pfd.events = events;
+  for (;;) {
+    tmo = -1;
+    if (timeout != 0U) {
+      now = VWIFI_Time();
+      tmo = (now < end) ? (int)(end - now) : 0;
+    }
+    n = poll(&pfd, 1U, tmo);
+    if (n > 0) {
+      return (pfd.revents);
+    }
+    if ((n == 0) || (errno != EINTR)) {
+      return 0;
+    }
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ * Get socket and mark it used (socket is not freed until released)
+ *----------------------------------------------------------------------------*/
+static VWIFI_SOCK *VWIFI_SockAcquire (VWIFI_DEV *wifi, int32_t socket) {
+  VWIFI_SOCK *sock = NULL;
+  int         cancel;
+
+  if ((socket >= 0) && (socket < VWIFI_SOCKET_NUM)) {
+    cancel = VWIFI_Lock(wifi);
+    if (wifi->sock[socket].state >= VWIFI_SOCK_CREATED) {
+      sock = &wifi->sock[socket];
+      sock->busy++;
+    }
+    VWIFI_Unlock(wifi, cancel);
+  }
+  return (sock);
+}
+
+/*-----------------------------------------------------------------------------
+ * Release socket (Linux socket of a closed socket is closed by the last user;
+ * also a cleanup handler of cancelled threads)
+ *----------------------------------------------------------------------------*/
+static void VWIFI_SockRelease (void *arg) {
+  VWIFI_SOCK *sock = (VWIFI_SOCK *)arg;
+  VWIFI_DEV  *wifi = &vwifi;
+  int         cancel;
+
+  cancel = VWIFI_Lock(wifi);
+  sock->busy--;
+  if ((sock->state == VWIFI_SOCK_CLOSING) && (sock->busy == 0U)) {
+    (void)close(sock->fd);
+    sock->fd    = -1;
+    sock->state = VWIFI_SOCK_FREE;
+  }
+  VWIFI_Unlock(wifi, cancel);
+}
+
+/*-----------------------------------------------------------------------------
+ * Allocate socket for Linux socket fd
+ * Returns: socket id or ARM_SOCKET_ENOMEM
+ *----------------------------------------------------------------------------*/
+static int32_t VWIFI_SockAlloc (VWIFI_DEV *wifi, int fd, uint8_t type) {
+  VWIFI_SOCK *sock;
+  uint32_t    i, n;
+  int         cancel;
+
+  cancel = VWIFI_Lock(wifi);
+  // Sockets are allocated round robin, a closed socket id stays invalid for a while
+  for (i = 0U; i < VWIFI_SOCKET_NUM; i++) {
+    n = (wifi->sock_next + i) % VWIFI_SOCKET_NUM;
+    if (wifi->sock[n].state == VWIFI_SOCK_FREE) {
+      break;
+    }
+  }
+  if (i == VWIFI_SOCKET_NUM) {
+    VWIFI_Unlock(wifi, cancel);
+    return ARM_SOCKET_ENOMEM;
+  }
+  wifi->sock_next = (n + 1U) % VWIFI_SOCKET_NUM;
+
+  sock = &wifi->sock[n];
+  memset(sock, 0, sizeof(VWIFI_SOCK));
+  sock->fd    = fd;
+  sock->type  = type;
+  sock->state = VWIFI_SOCK_CREATED;
+  VWIFI_Unlock(wifi, cancel);
+
+  return ((int32_t)n);
+}
+
+/*-----------------------------------------------------------------------------
+ * Close all sockets (power off)
+ *----------------------------------------------------------------------------*/
+static void VWIFI_SockCloseAll (VWIFI_DEV *wifi) {
+  VWIFI_SOCK *sock;
+  uint32_t    i;
+
+  for (i = 0U; i < VWIFI_SOCKET_NUM; i++) {
+    sock = &wifi->sock[i];
+    if (sock->state >= VWIFI_SOCK_CREATED) {
+      if (sock->busy != 0U) {
+        // Wake up functions waiting on the socket, the last one closes it
+        (void)shutdown(sock->fd, SHUT_RDWR);
+        sock->state = VWIFI_SOCK_CLOSING;
+      } else {
+        (void)close(sock->fd);
+        sock->fd    = -1;
+        sock->state = VWIFI_SOCK_FREE;
+      }
+    }
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ * Check if another socket of the same type is bound to the local address
+ * (Linux allows it for stream sockets, which use SO_REUSEADDR to bind to
+ * ports of closed connections in TIME_WAIT)
+ *----------------------------------------------------------------------------*/
+static uint32_t VWIFI_SockInUse (VWIFI_DEV *wifi, const VWIFI_SOCK *sock, const struct sockaddr_in *sa) {
+  const VWIFI_SOCK  *s;
+  struct sockaddr_in local;
+  socklen_t          len;
+  uint32_t           i, used = 0U;
+  int                cancel;
+
+  cancel = VWIFI_Lock(wifi);
+  for (i = 0U; i < VWIFI_SOCKET_NUM; i++) {
+    s = &wifi->sock[i];
+    if ((s == sock) || (s->state < VWIFI_SOCK_CREATED) || (s->bound == 0U) || (s->type != sock->type)) {
+      continue;
+    }
+    len = sizeof(local);
+    if ((getsockname(s->fd, (struct sockaddr *)&local, &len) == 0) && (local.sin_port == sa->sin_port) &&
+        ((local.sin_addr.s_addr == sa->sin_addr.s_addr) || (local.sin_addr.s_addr == htonl(INADDR_ANY)) ||
+         (sa->sin_addr.s_addr == htonl(INADDR_ANY)))) {
+      used = 1U;
+      break;
+    }
+  }
+  VWIFI_Unlock(wifi, cancel);
+
+  return (used);
+}
+
+/*-----------------------------------------------------------------------------
+ * Bind socket to the station address (sockets without local address send
+ * from VWIFI_STA_IP, where a SockServer on the same host connects back)
+ *----------------------------------------------------------------------------*/
+static int32_t VWIFI_SockBindLocal (VWIFI_DEV *wifi, VWIFI_SOCK *sock) {
+  struct sockaddr_in sa;
+
+  if ((sock->bound != 0U) || (wifi->sta_ip.s_addr == htonl(INADDR_ANY))) {
+    return 0;
+  }
+  memset(&sa, 0, sizeof(sa));
+  sa.sin_family = AF_INET;
+  sa.sin_addr   = wifi->sta_ip;
+  if (bind(sock->fd, (struct sockaddr *)&sa, sizeof(sa)) < 0) {
+    return (VWIFI_Error(errno));
+  }
+  sock->bound = 1U;
+  sock->any   = 1U;
+  return 0;
+}
+
+/*-----------------------------------------------------------------------------
+ * Return IPv4 address and port (ip, ip_len and port are optional)
+ *----------------------------------------------------------------------------*/
+static int32_t VWIFI_SockAddr (const struct sockaddr_in *sa, uint8_t *ip, uint32_t *ip_len, uint16_t *port) {
+
+  if ((ip != NULL) && (ip_len != NULL)) {
+    if (*ip_len < 4U) {
+      return ARM_SOCKET_EINVAL;
+    }
+    memcpy(ip, &sa->sin_addr, 4U);
+    *ip_len = 4U;
+  }
+  if (port != NULL) {
+    *port = ntohs(sa->sin_port);
+  }
+  return 0;
+}
+
+/*-----------------------------------------------------------------------------
+ * Check progress of a non-blocking connect
+ *----------------------------------------------------------------------------*/
+static int32_t VWIFI_SockConnectPoll (VWIFI_SOCK *sock) {
+  struct sockaddr sa;
+  struct pollfd   pfd;
+  socklen_t       len;
+  int             err;
+
+  pfd.fd     = sock->fd;
+  pfd.events = POLLOUT;
+  if (poll(&pfd, 1U, 0) <= 0) {
+    if ((VWIFI_Time() - sock->conn_t) < VWIFI_CONNECT_TIMEOUT) {
+      return ARM_SOCKET_EALREADY;
+    }
+    // Abort connection attempt
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_family = AF_UNSPEC;
+    (void)connect(sock->fd, &sa, sizeof(sa));
+    sock->state = VWIFI_SOCK_CREATED;
+    return ARM_SOCKET_ETIMEDOUT;
+  }
+
+  err = 0;
+  len = sizeof(err);
+  (void)getsockopt(sock->fd, SOL_SOCKET, SO_ERROR, &err, &len);
+  if (err != 0) {
+    sock->state = VWIFI_SOCK_CREATED;
+    return (VWIFI_Error(err));
+  }
+  sock->state = VWIFI_SOCK_CONNECTED;
+  return ARM_SOCKET_EISCONN;
+}
+
+/*-----------------------------------------------------------------------------
+ * Receive data on socket (SocketRecv and SocketRecvFrom)
+ *----------------------------------------------------------------------------*/
+static int32_t VWIFI_SockRecv (VWIFI_SOCK *sock, void *buf, uint32_t len, uint8_t *ip, uint32_t *ip_len, uint16_t *port) {
+  struct sockaddr_in sa;
+  socklen_t          sa_len;
+  ssize_t            n;
+
+  if ((buf == NULL) && (len != 0U)) {
+    return ARM_SOCKET_EINVAL;
+  }
+  if ((sock->type == ARM_SOCKET_SOCK_STREAM) && (sock->state != VWIFI_SOCK_CONNECTED)) {
+    return ARM_SOCKET_ENOTCONN;
+  }
+
+  if (len == 0U) {
+    // Check that received data is available
+    if (sock->nbio != 0U) {
+      if ((sock->type == ARM_SOCKET_SOCK_STREAM) || (VWIFI_Wait(sock->fd, POLLIN, 1U) != 0)) {
+        return 0;
+      }
+      return ARM_SOCKET_EAGAIN;
+    }
+    if (VWIFI_Wait(sock->fd, POLLIN, sock->rcvtimeo) == 0) {
+      return ARM_SOCKET_EAGAIN;
+    }
+    return 0;
+  }
+
+  for (;;) {
+    sa_len = sizeof(sa);
+    n = recvfrom(sock->fd, buf, len, 0, (struct sockaddr *)&sa, &sa_len);
+    if (n > 0) {
+      if (sock->type == ARM_SOCKET_SOCK_DGRAM) {
+        if (VWIFI_SockAddr(&sa, ip, ip_len, port) != 0) {
+          return ARM_SOCKET_EINVAL;
+        }
+      }
+      return ((int32_t)n);
+    }
+    if (n == 0) {
+      // Stream: connection closed by the peer, datagram: empty datagram
+      return ((sock->type == ARM_SOCKET_SOCK_STREAM) ? ARM_SOCKET_ECONNRESET : 0);
+    }
+    if ((errno != EAGAIN) && (errno != EINTR)) {
+      return (VWIFI_Error(errno));
+    }
+    if (sock->nbio != 0U) {
+      return ARM_SOCKET_EAGAIN;
+    }
+    if (VWIFI_Wait(sock->fd, POLLIN, sock->rcvtimeo) == 0) {
+      return ARM_SOCKET_EAGAIN;
+    }
+  }
+}
+
+/*-----------------------------------------------------------------------------
+ * Send data on socket (SocketSend and SocketSendTo)
+ *----------------------------------------------------------------------------*/
+static int32_t VWIFI_SockSend (VWIFI_DEV *wifi, VWIFI_SOCK *sock, const void *buf, uint32_t len, const uint8_t *ip, uint32_t ip_len, uint16_t port) {
+  struct sockaddr_in sa;
+  struct pollfd      pfd;
+  uint64_t           end;
+  uint32_t           num, tmo;
+  ssize_t            n;
+  int32_t            rc;
+
+  if ((buf == NULL) && (len != 0U)) {
+    return ARM_SOCKET_EINVAL;
+  }
+
+  if (sock->type == ARM_SOCKET_SOCK_STREAM) {
+    if (sock->state != VWIFI_SOCK_CONNECTED) {
+      return ARM_SOCKET_ENOTCONN;
+    }
+    if (len == 0U) {
+      return 0;
+    }
+    // Connection closed by the peer
+    pfd.fd     = sock->fd;
+    pfd.events = POLLRDHUP;
+    if ((poll(&pfd, 1U, 0) > 0) && ((pfd.revents & (POLLRDHUP | POLLHUP | POLLERR)) != 0)) {
+      return ARM_SOCKET_ECONNRESET;
+    }
+    ip = NULL;
+  } else {
+    if (ip != NULL) {
+      if ((ip_len != 4U) || (port == 0U)) {
+        return ARM_SOCKET_EINVAL;
+      }
+      memset(&sa, 0, sizeof(sa));
+      sa.sin_family = AF_INET;
+      sa.sin_port   = htons(port);
+      memcpy(&sa.sin_addr, ip, 4U);
+      if (sa.sin_addr.s_addr == htonl(INADDR_ANY)) {
+        ip = NULL;
+      }
+    }
+    if ((ip == NULL) && (sock->state != VWIFI_SOCK_CONNECTED)) {
+      return ARM_SOCKET_ENOTCONN;
+    }
+    if (len == 0U) {
+      return 0;
+    }
+    rc = VWIFI_SockBindLocal(wifi, sock);
+    if (rc != 0) {
+      return rc;
+    }
+  }
+
+  // Blocking sockets send all data (until the send timeout)
+  end = VWIFI_Time() + sock->sndtimeo;
+  num = 0U;
+  do {
+    if (ip != NULL) {
+      n = sendto(sock->fd, (const uint8_t *)buf + num, len - num, MSG_NOSIGNAL, (struct sockaddr *)&sa, sizeof(sa));
+    } else {
+      n = send(sock->fd, (const uint8_t *)buf + num, len - num, MSG_NOSIGNAL);
+    }
+    if (n >= 0) {
+      num += (uint32_t)n;
+      continue;
+    }
+    if ((errno != EAGAIN) && (errno != EINTR)) {
+      rc = VWIFI_Error(errno);
+      return ((num != 0U) ? (int32_t)num : rc);
+    }
+    if (sock->nbio != 0U) {
+      break;
+    }
+    tmo = 0U;
+    if (sock->sndtimeo != 0U) {
+      if (VWIFI_Time() >= end) {
+        break;
+      }
+      tmo = (uint32_t)(end - VWIFI_Time()) + 1U;
+    }
+    if (VWIFI_Wait(sock->fd, POLLOUT, tmo) == 0) {
+      break;
+    }
+  } while (num < len);
+
+  return ((num != 0U) ? (int32_t)num : ARM_SOCKET_EAGAIN);
+}
+
+/*-----------------------------------------------------------------------------
+ * Close ping socket (also a cleanup handler of cancelled threads)
+ *----------------------------------------------------------------------------*/
+static void VWIFI_PingClose (void *arg) {
+  (void)close((int)(intptr_t)arg);
+}
+
+/* Driver functions */
+
+static ARM_DRIVER_VERSION WIFI_GetVersion (void) {
+  return DriverVersion;
+}
+
+static ARM_WIFI_CAPABILITIES WIFI_GetCapabilities (void) {
+  return DriverCapabilities;
+}
+
+static int32_t WIFI_Initialize (ARM_WIFI_SignalEvent_t cb_event) {
+  VWIFI_DEV *wifi = &vwifi;
+  int        cancel;
+
+  // Station only without bypass mode: no events are signaled
+  (void)cb_event;
+
+  (void)pthread_once(&vwifi_once, VWIFI_Init);
+
+  cancel = VWIFI_Lock(wifi);
+  wifi->flags |= VWIFI_FLAG_INIT;
+  VWIFI_Unlock(wifi, cancel);
+
+  return ARM_DRIVER_OK;
+}
+
+static int32_t WIFI_PowerControl (ARM_POWER_STATE state) {
+  VWIFI_DEV *wifi = &vwifi;
+  int32_t    ret  = ARM_DRIVER_OK;
+  int        cancel;
+
+  cancel = VWIFI_Lock(wifi);
+  if ((wifi->flags & VWIFI_FLAG_INIT) == 0U) {
+    VWIFI_Unlock(wifi, cancel);
+    return ARM_DRIVER_ERROR;
+  }
+
+  switch (state) {
+    case ARM_POWER_OFF:
+      VWIFI_SockCloseAll(wifi);
+      wifi->connected = 0U;
+      wifi->flags    &= ~VWIFI_FLAG_POWER;
+      break;
+
+    case ARM_POWER_FULL:
+      wifi->flags |= VWIFI_FLAG_POWER;
+      break;
+
+    case ARM_POWER_LOW:
+    default:
+      ret = ARM_DRIVER_ERROR_UNSUPPORTED;
+      break;
+  }
+  VWIFI_Unlock(wifi, cancel);
+
+  return ret;
+}
+
+static int32_t WIFI_Uninitialize (void) {
+  VWIFI_DEV *wifi = &vwifi;
+  int        cancel;
+
+  if ((wifi->flags & VWIFI_FLAG_INIT) != 0U) {
+    (void)WIFI_PowerControl(ARM_POWER_OFF);
+  }
+
+  cancel = VWIFI_Lock(wifi);
+  wifi->flags = 0U;
+  VWIFI_Unlock(wifi, cancel);
+
+  return ARM_DRIVER_OK;
+}
+
+static int32_t WIFI_GetModuleInfo (char *module_info, uint32_t max_len) {
+
+  if ((module_info == NULL) || (max_len == 0U)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  (void)snprintf(module_info, max_len, "Virtual WiFi on Linux sockets (station %s)", VWIFI_STA_IP);
+
+  return ARM_DRIVER_OK;
+}
+
+static int32_t WIFI_SetOption (uint32_t interface, uint32_t option, const void *data, uint32_t len) {
+  VWIFI_DEV *wifi = &vwifi;
+  int        cancel;
+
+  if (interface > 1U) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  if ((interface != 0U) || (option >= VWIFI_OPT_NUM) || (vwifi_opt_len[option] == 0U)) {
+    return ARM_DRIVER_ERROR_UNSUPPORTED;
+  }
+  if ((data == NULL) || (len < vwifi_opt_len[option])) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  // Values are stored only, the sockets always use VWIFI_STA_IP
+  cancel = VWIFI_Lock(wifi);
+  memcpy(wifi->opt[option], data, vwifi_opt_len[option]);
+  VWIFI_Unlock(wifi, cancel);
+
+  return ARM_DRIVER_OK;
+}
+
+static int32_t WIFI_GetOption (uint32_t interface, uint32_t option, void *data, uint32_t *len) {
+  VWIFI_DEV *wifi = &vwifi;
+  int        cancel;
+
+  if (interface > 1U) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  if ((interface != 0U) || (option >= VWIFI_OPT_NUM) || (vwifi_opt_len[option] == 0U)) {
+    return ARM_DRIVER_ERROR_UNSUPPORTED;
+  }
+  if ((data == NULL) || (len == NULL) || (*len < vwifi_opt_len[option])) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  cancel = VWIFI_Lock(wifi);
+  memcpy(data, wifi->opt[option], vwifi_opt_len[option]);
+  VWIFI_Unlock(wifi, cancel);
+  *len = vwifi_opt_len[option];
+
+  return ARM_DRIVER_OK;
+}
+
+static int32_t WIFI_Scan (ARM_WIFI_SCAN_INFO_t scan_info[], uint32_t max_num) {
+  VWIFI_DEV *wifi = &vwifi;
+
+  if ((scan_info == NULL) || (max_num == 0U)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  if ((wifi->flags & VWIFI_FLAG_POWER) == 0U) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  memset(&scan_info[0], 0, sizeof(ARM_WIFI_SCAN_INFO_t));
+  (void)snprintf(scan_info[0].ssid, sizeof(scan_info[0].ssid), "%s", VWIFI_AP_SSID);
+  memcpy(scan_info[0].bssid, wifi->bssid, 6U);
+  scan_info[0].security = VWIFI_AP_SECURITY;
+  scan_info[0].ch       = VWIFI_AP_CH;
+  scan_info[0].rssi     = VWIFI_AP_RSSI;
+
+  return 1;
+}
+
+static int32_t WIFI_Activate (uint32_t interface, const ARM_WIFI_CONFIG_t *config) {
+  VWIFI_DEV *wifi = &vwifi;
+  int        cancel;
+
+  if ((interface > 1U) || (config == NULL)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  if (interface != 0U) {
+    return ARM_DRIVER_ERROR_UNSUPPORTED;
+  }
+  if (config->wps_method > ARM_WIFI_WPS_METHOD_PIN) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  if (config->wps_method != ARM_WIFI_WPS_METHOD_NONE) {
+    return ARM_DRIVER_ERROR_UNSUPPORTED;
+  }
+  if ((config->ssid == NULL) || (config->security > ARM_WIFI_SECURITY_WPA2) ||
+      ((config->pass == NULL) && (config->security != ARM_WIFI_SECURITY_OPEN)) || (config->ch > 165U)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  if ((wifi->flags & VWIFI_FLAG_POWER) == 0U) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  // Associate with the simulated access point
+  if ((strcmp(config->ssid, VWIFI_AP_SSID) != 0) || (config->security != VWIFI_AP_SECURITY) ||
+      ((config->ch != 0U) && (config->ch != VWIFI_AP_CH))) {
+    return ARM_DRIVER_ERROR;
+  }
+  if ((config->security != ARM_WIFI_SECURITY_OPEN) && (strcmp(config->pass, VWIFI_AP_PASS) != 0)) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  cancel = VWIFI_Lock(wifi);
+  wifi->connected = 1U;
+  wifi->ch        = VWIFI_AP_CH;
+  memcpy(wifi->opt[ARM_WIFI_BSSID], wifi->bssid, 6U);
+  VWIFI_Unlock(wifi, cancel);
+
+  return ARM_DRIVER_OK;
+}
+
+static int32_t WIFI_Deactivate (uint32_t interface) {
+  VWIFI_DEV *wifi = &vwifi;
+  int        cancel;
+
+  if (interface > 1U) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  if (interface != 0U) {
+    return ARM_DRIVER_ERROR_UNSUPPORTED;
+  }
+  if ((wifi->flags & VWIFI_FLAG_POWER) == 0U) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  cancel = VWIFI_Lock(wifi);
+  wifi->connected = 0U;
+  VWIFI_Unlock(wifi, cancel);
+
+  return ARM_DRIVER_OK;
+}
+
+static uint32_t WIFI_IsConnected (void) {
+  return (vwifi.connected);
+}
+
+static int32_t WIFI_GetNetInfo (ARM_WIFI_NET_INFO_t *net_info) {
+  VWIFI_DEV *wifi = &vwifi;
+
+  if (net_info == NULL) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  if (wifi->connected == 0U) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  memset(net_info, 0, sizeof(ARM_WIFI_NET_INFO_t));
+  (void)snprintf(net_info->ssid, sizeof(net_info->ssid), "%s", VWIFI_AP_SSID);
+  (void)snprintf(net_info->pass, sizeof(net_info->pass), "%s", VWIFI_AP_PASS);
+  net_info->security = VWIFI_AP_SECURITY;
+  net_info->ch       = wifi->ch;
+  net_info->rssi     = VWIFI_AP_RSSI;
+
+  return ARM_DRIVER_OK;
+}
+
+static int32_t WIFI_BypassControl (uint32_t interface, uint32_t mode) {
+  (void)interface;
+  (void)mode;
+  return ARM_DRIVER_ERROR_UNSUPPORTED;
+}
+
+static int32_t WIFI_EthSendFrame (uint32_t interface, const uint8_t *frame, uint32_t len) {
+  (void)interface;
+  (void)frame;
+  (void)len;
+  return ARM_DRIVER_ERROR_UNSUPPORTED;
+}
+
+static int32_t WIFI_EthReadFrame (uint32_t interface, uint8_t *frame, uint32_t len) {
+  (void)interface;
+  (void)frame;
+  (void)len;
+  return ARM_DRIVER_ERROR_UNSUPPORTED;
+}
+
+static uint32_t WIFI_EthGetRxFrameSize (uint32_t interface) {
+  (void)interface;
+  return 0U;
+}
+
+static int32_t WIFI_SocketCreate (int32_t af, int32_t type, int32_t protocol) {
+  VWIFI_DEV *wifi = &vwifi;
+  int32_t    rc;
+  int        fd, on;
+
+  if (af == ARM_SOCKET_AF_INET6) {
+    return ARM_SOCKET_ENOTSUP;
+  }
+  if ((af != ARM_SOCKET_AF_INET) ||
+      !(((type == ARM_SOCKET_SOCK_STREAM) && (protocol == ARM_SOCKET_IPPROTO_TCP)) ||
+        ((type == ARM_SOCKET_SOCK_DGRAM)  && (protocol == ARM_SOCKET_IPPROTO_UDP)))) {
+    return ARM_SOCKET_EINVAL;
+  }
+  if (wifi->connected == 0U) {
+    return ARM_SOCKET_ERROR;
+  }
+
+  fd = socket(AF_INET, ((type == ARM_SOCKET_SOCK_STREAM) ? SOCK_STREAM : SOCK_DGRAM) | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  if (fd < 0) {
+    return (VWIFI_Error(errno));
+  }
+  if (type == ARM_SOCKET_SOCK_STREAM) {
+    // Listening sockets are bound again after connections closed by the driver
+    on = 1;
+    (void)setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+  }
+  rc = VWIFI_SockAlloc(wifi, fd, (uint8_t)type);
+  if (rc < 0) {
+    (void)close(fd);
+  }
+  return rc;
+}
+
+static int32_t WIFI_SocketBind (int32_t socket, const uint8_t *ip, uint32_t ip_len, uint16_t port) {
+  VWIFI_DEV         *wifi = &vwifi;
+  VWIFI_SOCK        *sock;
+  struct sockaddr_in sa;
+  int32_t            rc;
+
+  sock = VWIFI_SockAcquire(wifi, socket);
+  if (sock == NULL) {
+    return ARM_SOCKET_ESOCK;
+  }
+
+  if ((ip == NULL) || (ip_len != 4U) || (port == 0U)) {
+    rc = ARM_SOCKET_EINVAL;
+  } else if (sock->state >= VWIFI_SOCK_CONNECTING) {
+    rc = ARM_SOCKET_EISCONN;
+  } else if ((sock->bound != 0U) || (sock->state == VWIFI_SOCK_LISTEN)) {
+    rc = ARM_SOCKET_EINVAL;
+  } else {
+    memset(&sa, 0, sizeof(sa));
+    sa.sin_family = AF_INET;
+    sa.sin_port   = htons(port);
+    memcpy(&sa.sin_addr, ip, 4U);
+    sock->any = (sa.sin_addr.s_addr == htonl(INADDR_ANY)) ? 1U : 0U;
+    if (sock->any != 0U) {
+      // Unspecified address is the station address
+      sa.sin_addr = wifi->sta_ip;
+    }
+    rc = 0;
+    if (VWIFI_SockInUse(wifi, sock, &sa) != 0U) {
+      rc = ARM_SOCKET_EADDRINUSE;
+    } else if (bind(sock->fd, (struct sockaddr *)&sa, sizeof(sa)) < 0) {
+      rc = VWIFI_Error(errno);
+    } else {
+      sock->bound = 1U;
+    }
+  }
+
+  VWIFI_SockRelease(sock);
+  return rc;
+}
+
+static int32_t WIFI_SocketListen (int32_t socket, int32_t backlog) {
+  VWIFI_DEV  *wifi = &vwifi;
+  VWIFI_SOCK *sock;
+  int32_t     rc;
+
+  sock = VWIFI_SockAcquire(wifi, socket);
+  if (sock == NULL) {
+    return ARM_SOCKET_ESOCK;
+  }
+
+  if (sock->type != ARM_SOCKET_SOCK_STREAM) {
+    rc = ARM_SOCKET_ENOTSUP;
+  } else if ((sock->state != VWIFI_SOCK_CREATED) || (sock->bound == 0U) || (backlog < 0)) {
+    rc = ARM_SOCKET_EINVAL;
+  } else {
+    rc = 0;
+    if (listen(sock->fd, backlog) < 0) {
+      rc = VWIFI_Error(errno);
+    } else {
+      sock->state = VWIFI_SOCK_LISTEN;
+    }
+  }
+
+  VWIFI_SockRelease(sock);
+  return rc;
+}
+
+static int32_t WIFI_SocketAccept (int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t *port) {
+  VWIFI_DEV         *wifi = &vwifi;
+  VWIFI_SOCK        *sock;
+  struct sockaddr_in sa;
+  socklen_t          sa_len;
+  int32_t            rc;
+  int                fd;
+
+  sock = VWIFI_SockAcquire(wifi, socket);
+  if (sock == NULL) {
+    return ARM_SOCKET_ESOCK;
+  }
+  pthread_cleanup_push(VWIFI_SockRelease, sock);
+
+  if (sock->type != ARM_SOCKET_SOCK_STREAM) {
+    rc = ARM_SOCKET_ENOTSUP;
+  } else if (sock->state != VWIFI_SOCK_LISTEN) {
+    rc = ARM_SOCKET_EINVAL;
+  } else {
+    for (;;) {
+      sa_len = sizeof(sa);
+      fd = accept4(sock->fd, (struct sockaddr *)&sa, &sa_len, SOCK_NONBLOCK | SOCK_CLOEXEC);
+      if (fd >= 0) {
+        rc = VWIFI_SockAlloc(wifi, fd, ARM_SOCKET_SOCK_STREAM);
+        if (rc < 0) {
+          (void)close(fd);
+          break;
+        }
+        // Accepted socket inherits the options of the listening socket
+        wifi->sock[rc].state     = VWIFI_SOCK_CONNECTED;
+        wifi->sock[rc].bound     = 1U;
+        wifi->sock[rc].nbio      = sock->nbio;
+        wifi->sock[rc].rcvtimeo  = sock->rcvtimeo;
+        wifi->sock[rc].sndtimeo  = sock->sndtimeo;
+        (void)VWIFI_SockAddr(&sa, ip, ip_len, port);
+        break;
+      }
+      if ((errno != EAGAIN) && (errno != EINTR)) {
+        rc = VWIFI_Error(errno);
+        break;
+      }
+      if (sock->nbio != 0U) {
+        rc = ARM_SOCKET_EAGAIN;
+        break;
+      }
+      if (VWIFI_Wait(sock->fd, POLLIN, sock->rcvtimeo) == 0) {
+        rc = ARM_SOCKET_EAGAIN;
+        break;
+      }
+      if (sock->state != VWIFI_SOCK_LISTEN) {
+        // Closed while waiting
+        rc = ARM_SOCKET_ESOCK;
+        break;
+      }
+    }
+  }
+
+  pthread_cleanup_pop(1);
+  return rc;
+}
+
+static int32_t WIFI_SocketConnect (int32_t socket, const uint8_t *ip, uint32_t ip_len, uint16_t port) {
+  VWIFI_DEV         *wifi = &vwifi;
+  VWIFI_SOCK        *sock;
+  struct sockaddr_in sa;
+  socklen_t          len;
+  int32_t            rc;
+  int                err;
+
+  sock = VWIFI_SockAcquire(wifi, socket);
+  if (sock == NULL) {
+    return ARM_SOCKET_ESOCK;
+  }
+  pthread_cleanup_push(VWIFI_SockRelease, sock);
+
+  memset(&sa, 0, sizeof(sa));
+  sa.sin_family = AF_INET;
+  sa.sin_port   = htons(port);
+  if ((ip != NULL) && (ip_len == 4U)) {
+    memcpy(&sa.sin_addr, ip, 4U);
+  }
+
+  if ((ip == NULL) || (ip_len != 4U)) {
+    rc = ARM_SOCKET_EINVAL;
+  } else if (sock->type == ARM_SOCKET_SOCK_DGRAM) {
+    if (sa.sin_addr.s_addr == htonl(INADDR_ANY)) {
+      // Dissolve the association
+      sa.sin_family = AF_UNSPEC;
+      (void)connect(sock->fd, (struct sockaddr *)&sa, sizeof(sa));
+      sock->state = VWIFI_SOCK_CREATED;
+      rc = 0;
+    } else if (port == 0U) {
+      rc = ARM_SOCKET_EINVAL;
+    } else {
+      rc = VWIFI_SockBindLocal(wifi, sock);
+      if ((rc == 0) && (connect(sock->fd, (struct sockaddr *)&sa, sizeof(sa)) < 0)) {
+        rc = VWIFI_Error(errno);
+      }
+      if (rc == 0) {
+        sock->state = VWIFI_SOCK_CONNECTED;
+      }
+    }
+  } else if ((sa.sin_addr.s_addr == htonl(INADDR_ANY)) || (port == 0U)) {
+    rc = ARM_SOCKET_EINVAL;
+  } else if (sock->state == VWIFI_SOCK_LISTEN) {
+    rc = ARM_SOCKET_EINVAL;
+  } else if (sock->state == VWIFI_SOCK_CONNECTED) {
+    rc = ARM_SOCKET_EISCONN;
+  } else if (sock->state == VWIFI_SOCK_CONNECTING) {
+    rc = VWIFI_SockConnectPoll(sock);
+  } else {
+    rc = VWIFI_SockBindLocal(wifi, sock);
+    if (rc == 0) {
+      if (connect(sock->fd, (struct sockaddr *)&sa, sizeof(sa)) == 0) {
+        sock->state = VWIFI_SOCK_CONNECTED;
+      } else if (errno != EINPROGRESS) {
+        rc = VWIFI_Error(errno);
+      } else {
+        sock->state  = VWIFI_SOCK_CONNECTING;
+        sock->conn_t = VWIFI_Time();
+        rc = ARM_SOCKET_EINPROGRESS;
+        if (sock->nbio == 0U) {
+          // Blocking connect waits for the connection (until the connect timeout)
+          if (VWIFI_Wait(sock->fd, POLLOUT, VWIFI_CONNECT_TIMEOUT) == 0) {
+            sa.sin_family = AF_UNSPEC;
+            (void)connect(sock->fd, (struct sockaddr *)&sa, sizeof(sa));
+            sock->state = VWIFI_SOCK_CREATED;
+            rc = ARM_SOCKET_ETIMEDOUT;
+          } else {
+            err = 0;
+            len = sizeof(err);
+            (void)getsockopt(sock->fd, SOL_SOCKET, SO_ERROR, &err, &len);
+            sock->state = (err == 0) ? VWIFI_SOCK_CONNECTED : VWIFI_SOCK_CREATED;
+            rc          = (err == 0) ? 0 : VWIFI_Error(err);
+          }
+        }
+      }
+    }
+  }
+
+  pthread_cleanup_pop(1);
+  return rc;
+}
+
+static int32_t WIFI_SocketRecv (int32_t socket, void *buf, uint32_t len) {
+  VWIFI_SOCK *sock;
+  int32_t     rc;
+
+  sock = VWIFI_SockAcquire(&vwifi, socket);
+  if (sock == NULL) {
+    return ARM_SOCKET_ESOCK;
+  }
+  pthread_cleanup_push(VWIFI_SockRelease, sock);
+  rc = VWIFI_SockRecv(sock, buf, len, NULL, NULL, NULL);
+  VWIFI_Link(&vwifi, rc);
+  pthread_cleanup_pop(1);
+
+  return rc;
+}
+
+static int32_t WIFI_SocketRecvFrom (int32_t socket, void *buf, uint32_t len, uint8_t *ip, uint32_t *ip_len, uint16_t *port) {
+  VWIFI_SOCK *sock;
+  int32_t     rc;
+
+  sock = VWIFI_SockAcquire(&vwifi, socket);
+  if (sock == NULL) {
+    return ARM_SOCKET_ESOCK;
+  }
+  pthread_cleanup_push(VWIFI_SockRelease, sock);
+  rc = VWIFI_SockRecv(sock, buf, len, ip, ip_len, port);
+  VWIFI_Link(&vwifi, rc);
+  pthread_cleanup_pop(1);
+
+  return rc;
+}
+
+static int32_t WIFI_SocketSend (int32_t socket, const void *buf, uint32_t len) {
+  VWIFI_SOCK *sock;
+  int32_t     rc;
+
+  sock = VWIFI_SockAcquire(&vwifi, socket);
+  if (sock == NULL) {
+    return ARM_SOCKET_ESOCK;
+  }
+  pthread_cleanup_push(VWIFI_SockRelease, sock);
+  rc = VWIFI_SockSend(&vwifi, sock, buf, len, NULL, 0U, 0U);
+  VWIFI_Link(&vwifi, rc);
+  pthread_cleanup_pop(1);
+
+  return rc;
+}
+
+static int32_t WIFI_SocketSendTo (int32_t socket, const void *buf, uint32_t len, const uint8_t *ip, uint32_t ip_len, uint16_t port) {
+  VWIFI_SOCK *sock;
+  int32_t     rc;
+
+  sock = VWIFI_SockAcquire(&vwifi, socket);
+  if (sock == NULL) {
+    return ARM_SOCKET_ESOCK;
+  }
+  pthread_cleanup_push(VWIFI_SockRelease, sock);
+  rc = VWIFI_SockSend(&vwifi, sock, buf, len, ip, ip_len, port);
+  VWIFI_Link(&vwifi, rc);
+  pthread_cleanup_pop(1);
+
+  return rc;
+}
+
+static int32_t WIFI_SocketGetSockName (int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t *port) {
+  VWIFI_SOCK        *sock;
+  struct sockaddr_in sa;
+  socklen_t          sa_len;
+  int32_t            rc;
+
+  sock = VWIFI_SockAcquire(&vwifi, socket);
+  if (sock == NULL) {
+    return ARM_SOCKET_ESOCK;
+  }
+
+  sa_len = sizeof(sa);
+  if (((ip != NULL) && (ip_len == NULL)) || (sock->bound == 0U)) {
+    rc = ARM_SOCKET_EINVAL;
+  } else if (getsockname(sock->fd, (struct sockaddr *)&sa, &sa_len) < 0) {
+    rc = VWIFI_Error(errno);
+  } else {
+    if ((sock->any != 0U) && (sock->state != VWIFI_SOCK_CONNECTED)) {
+      // Bound to the unspecified address
+      sa.sin_addr.s_addr = htonl(INADDR_ANY);
+    }
+    rc = VWIFI_SockAddr(&sa, ip, ip_len, port);
+  }
+
+  VWIFI_SockRelease(sock);
+  return rc;
+}
+
+static int32_t WIFI_SocketGetPeerName (int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t *port) {
+  VWIFI_SOCK        *sock;
+  struct sockaddr_in sa;
+  socklen_t          sa_len;
+  int32_t            rc;
+
+  sock = VWIFI_SockAcquire(&vwifi, socket);
+  if (sock == NULL) {
+    return ARM_SOCKET_ESOCK;
+  }
+
+  sa_len = sizeof(sa);
+  if ((ip != NULL) && (ip_len == NULL)) {
+    rc = ARM_SOCKET_EINVAL;
+  } else if (sock->state != VWIFI_SOCK_CONNECTED) {
+    rc = ARM_SOCKET_ENOTCONN;
+  } else if (getpeername(sock->fd, (struct sockaddr *)&sa, &sa_len) < 0) {
+    rc = VWIFI_Error(errno);
+  } else {
+    rc = VWIFI_SockAddr(&sa, ip, ip_len, port);
+  }
+
+  VWIFI_SockRelease(sock);
+  return rc;
+}
+
+static int32_t WIFI_SocketGetOpt (int32_t socket, int32_t opt_id, void *opt_val, uint32_t *opt_len) {
+  VWIFI_SOCK *sock;
+  uint32_t    val;
+  int32_t     rc = 0;
+
+  sock = VWIFI_SockAcquire(&vwifi, socket);
+  if (sock == NULL) {
+    return ARM_SOCKET_ESOCK;
+  }
+
+  switch (opt_id) {
+    case ARM_SOCKET_SO_RCVTIMEO:
+      val = sock->rcvtimeo;
+      break;
+    case ARM_SOCKET_SO_SNDTIMEO:
+      val = sock->sndtimeo;
+      break;
+    case ARM_SOCKET_SO_KEEPALIVE:
+      val = sock->keepalive;
+      break;
+    case ARM_SOCKET_SO_TYPE:
+      val = sock->type;
+      break;
+    case ARM_SOCKET_IO_FIONBIO:         // Set only
+    default:
+      rc = ARM_SOCKET_EINVAL;
+      break;
+  }
+  if ((opt_val == NULL) || (opt_len == NULL) || (*opt_len < 4U)) {
+    rc = ARM_SOCKET_EINVAL;
+  }
+  if (rc == 0) {
+    memcpy(opt_val, &val, 4U);
+    *opt_len = 4U;
+  }
+
+  VWIFI_SockRelease(sock);
+  return rc;
+}
+
+static int32_t WIFI_SocketSetOpt (int32_t socket, int32_t opt_id, const void *opt_val, uint32_t opt_len) {
+  VWIFI_SOCK *sock;
+  uint32_t    val = 0U;
+  int         on;
+  int32_t     rc  = 0;
+
+  sock = VWIFI_SockAcquire(&vwifi, socket);
+  if (sock == NULL) {
+    return ARM_SOCKET_ESOCK;
+  }
+
+  if ((opt_val == NULL) || (opt_len < 4U)) {
+    rc = ARM_SOCKET_EINVAL;
+  } else {
+    memcpy(&val, opt_val, 4U);
+  }
+  if (rc == 0) {
+    switch (opt_id) {
+      case ARM_SOCKET_IO_FIONBIO:
+        sock->nbio = (val != 0U) ? 1U : 0U;
+        break;
+      case ARM_SOCKET_SO_RCVTIMEO:
+        sock->rcvtimeo = val;
+        break;
+      case ARM_SOCKET_SO_SNDTIMEO:
+        sock->sndtimeo = val;
+        break;
+      case ARM_SOCKET_SO_KEEPALIVE:
+        on = (val != 0U) ? 1 : 0;
+        if (setsockopt(sock->fd, SOL_SOCKET, SO_KEEPALIVE, &on, sizeof(on)) < 0) {
+          rc = VWIFI_Error(errno);
+        } else {
+          sock->keepalive = val;
+        }
+        break;
+      case ARM_SOCKET_SO_TYPE:          // Get only
+      default:
+        rc = ARM_SOCKET_EINVAL;
+        break;
+    }
+  }
+
+  VWIFI_SockRelease(sock);
+  return rc;
+}
+
+static int32_t WIFI_SocketClose (int32_t socket) {
+  VWIFI_DEV  *wifi = &vwifi;
+  VWIFI_SOCK *sock;
+  int         cancel;
+
+  if ((socket < 0) || (socket >= VWIFI_SOCKET_NUM)) {
+    return ARM_SOCKET_ESOCK;
+  }
+
+  cancel = VWIFI_Lock(wifi);
+  sock = &wifi->sock[socket];
+  if (sock->state < VWIFI_SOCK_CREATED) {
+    VWIFI_Unlock(wifi, cancel);
+    return ARM_SOCKET_ESOCK;
+  }
+  if (sock->busy != 0U) {
+    // Wake up functions waiting on the socket, the last one closes it
+    (void)shutdown(sock->fd, SHUT_RDWR);
+    sock->state = VWIFI_SOCK_CLOSING;
+  } else {
+    (void)close(sock->fd);
+    sock->fd    = -1;
+    sock->state = VWIFI_SOCK_FREE;
+  }
+  VWIFI_Unlock(wifi, cancel);
+
+  return 0;
+}
+
+static int32_t WIFI_SocketGetHostByName (const char *name, int32_t af, uint8_t *ip, uint32_t *ip_len) {
+  struct addrinfo  hints, *res;
+  int              err;
+
+  if ((name == NULL) || (ip == NULL) || (ip_len == NULL)) {
+    return ARM_SOCKET_EINVAL;
+  }
+  if (af == ARM_SOCKET_AF_INET6) {
+    return ARM_SOCKET_ENOTSUP;
+  }
+  if ((af != ARM_SOCKET_AF_INET) || (*ip_len < 4U)) {
+    return ARM_SOCKET_EINVAL;
+  }
+
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family   = AF_INET;
+  hints.ai_socktype = SOCK_STREAM;
+  err = getaddrinfo(name, NULL, &hints, &res);
+  if (err != 0) {
+    return (((err == EAI_NONAME) || (err == EAI_NODATA) || (err == EAI_FAIL)) ? ARM_SOCKET_EHOSTNOTFOUND : ARM_SOCKET_ERROR);
+  }
+  memcpy(ip, &((struct sockaddr_in *)res->ai_addr)->sin_addr, 4U);
+  *ip_len = 4U;
+  freeaddrinfo(res);
+
+  return 0;
+}
+
+static int32_t WIFI_Ping (const uint8_t *ip, uint32_t ip_len) {
+  VWIFI_DEV         *wifi = &vwifi;
+  struct sockaddr_in sa;
+  struct icmphdr     req;
+  const struct icmphdr *rep;
+  uint8_t            buf[256];
+  uint64_t           end, now;
+  uint32_t           sum, i;
+  uint16_t           seq;
+  ssize_t            n;
+  int32_t            rc;
+  int                fd, raw, cancel;
+
+  if ((ip == NULL) || (ip_len != 4U)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  if (wifi->connected == 0U) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  // Unprivileged ICMP socket (net.ipv4.ping_group_range), raw socket as root
+  raw = 0;
+  fd  = socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, IPPROTO_ICMP);
+  if (fd < 0) {
+    raw = 1;
+    fd  = socket(AF_INET, SOCK_RAW | SOCK_CLOEXEC, IPPROTO_ICMP);
+    if (fd < 0) {
+      return ARM_DRIVER_ERROR;
+    }
+  }
+
+  cancel = VWIFI_Lock(wifi);
+  seq = ++wifi->ping_seq;
+  VWIFI_Unlock(wifi, cancel);
+
+  memset(&req, 0, sizeof(req));
+  req.type             = ICMP_ECHO;
+  req.un.echo.id       = htons((uint16_t)getpid());
+  req.un.echo.sequence = htons(seq);
+  sum = 0U;
+  for (i = 0U; i < sizeof(req); i += 2U) {
+    sum += ((const uint16_t *)(const void *)&req)[i / 2U];
+  }
+  sum = (sum & 0xFFFFU) + (sum >> 16);
+  sum = (sum & 0xFFFFU) + (sum >> 16);
+  req.checksum = (uint16_t)~sum;
+
+  memset(&sa, 0, sizeof(sa));
+  sa.sin_family = AF_INET;
+  memcpy(&sa.sin_addr, ip, 4U);
+
+  rc = ARM_DRIVER_ERROR;
+  pthread_cleanup_push(VWIFI_PingClose, (void *)(intptr_t)fd);
+  if (sendto(fd, &req, sizeof(req), 0, (struct sockaddr *)&sa, sizeof(sa)) == (ssize_t)sizeof(req)) {
+    end = VWIFI_Time() + VWIFI_PING_TIMEOUT;
+    while ((now = VWIFI_Time()) < end) {
+      if (VWIFI_Wait(fd, POLLIN, (uint32_t)(end - now)) == 0) {
+        break;
+      }
+      n = recv(fd, buf, sizeof(buf), MSG_DONTWAIT);
+      if (n <= 0) {
+        continue;
+      }
+      i = 0U;
+      if (raw != 0) {
+        // Raw socket receives the IP header
+        i = (uint32_t)(buf[0] & 0x0FU) * 4U;
+      }
+      if ((uint32_t)n < (i + sizeof(struct icmphdr))) {
+        continue;
+      }
+      rep = (const struct icmphdr *)(const void *)&buf[i];
+      if ((rep->type == ICMP_ECHOREPLY) && (rep->un.echo.sequence == req.un.echo.sequence)) {
+        rc = ARM_DRIVER_OK;
+        break;
+      }
+    }
+  }
+  pthread_cleanup_pop(1);
+
+  return rc;
+}
+
+/* Driver Control Block */
+
+extern ARM_DRIVER_WIFI ARM_Driver_WiFi_(VWIFI_DRV_NUM);
+       ARM_DRIVER_WIFI ARM_Driver_WiFi_(VWIFI_DRV_NUM) = {
+  WIFI_GetVersion,
+  WIFI_GetCapabilities,
+  WIFI_Initialize,
+  WIFI_Uninitialize,
+  WIFI_PowerControl,
+  WIFI_GetModuleInfo,
+  WIFI_SetOption,
+  WIFI_GetOption,
+  WIFI_Scan,
+  WIFI_Activate,
+  WIFI_Deactivate,
+  WIFI_IsConnected,
+  WIFI_GetNetInfo,
+  WIFI_BypassControl,
+  WIFI_EthSendFrame,
+  WIFI_EthReadFrame,
+  WIFI_EthGetRxFrameSize,
+  WIFI_SocketCreate,
+  WIFI_SocketBind,
+  WIFI_SocketListen,
+  WIFI_SocketAccept,
+  WIFI_SocketConnect,
+  WIFI_SocketRecv,
+  WIFI_SocketRecvFrom,
+  WIFI_SocketSend,
+  WIFI_SocketSendTo,
+  WIFI_SocketGetSockName,
+  WIFI_SocketGetPeerName,
+  WIFI_SocketGetOpt,
+  WIFI_SocketSetOpt,
+  WIFI_SocketClose,
+  WIFI_SocketGetHostByName,
+  WIFI_Ping
+};
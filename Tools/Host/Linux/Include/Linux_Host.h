@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-Driver Validation
+ * Title:       Linux host "board" header (CMSIS_target_header of the servers)
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef LINUX_HOST_H_
+#define LINUX_HOST_H_
+
+#include <stdint.h>
+
+#include "Driver_SPI.h"
+#include "Driver_USART.h"
+#include "vSPI_Config.h"
+#include "vUSART_Config.h"
+
+// CMSIS Driver instances of the virtual buses used by the servers
+#define ARDUINO_UNO_SPI     VSPI_DRV_NUM_B    // vSPI bus end B
+#define ARDUINO_UNO_UART    VUSART_DRV_NUM_B  // vUSART line end B
+
+// CMSIS Drivers
+extern ARM_DRIVER_SPI       ARM_Driver_SPI_(VSPI_DRV_NUM_A);            // vSPI bus end A (Driver Validation)
+extern ARM_DRIVER_SPI       ARM_Driver_SPI_(VSPI_DRV_NUM_B);            // vSPI bus end B (SPI Server)
+extern ARM_DRIVER_USART     ARM_Driver_USART_(VUSART_DRV_NUM_A);        // vUSART line end A (Driver Validation)
+extern ARM_DRIVER_USART     ARM_Driver_USART_(VUSART_DRV_NUM_B);        // vUSART line end B (USART Server)
+
+// vUSART output lines (inputs of the other line end: RTS -> CTS, DTR -> DSR, DCD -> DCD, RI -> RI)
+#define VUSART_LINE_RTS     (1U << 0)
+#define VUSART_LINE_DTR     (1U << 1)
+#define VUSART_LINE_DCD     (1U << 2)
+#define VUSART_LINE_RI      (1U << 3)
+
+// Drive vUSART DCD or RI output line (USART Server pins)
+extern int32_t vUSART_SetLine (uint32_t drv_num, uint32_t line, uint32_t active);
+
+#endif // LINUX_HOST_H_
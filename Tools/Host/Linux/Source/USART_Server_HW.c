@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     USART Server
+ * Title:       USART Server hardware specific driver implementation (Linux host)
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "USART_Server_HW.h"
+
+#include "Linux_Host.h"
+
+/**
+  \fn            void USART_Server_Pins_Initialize (void)
+  \brief         Initialize, power up and configure GPIO pins used for 
+                 driving DCD and RI lines of the USART Client.
+  \return        none
+*/
+void USART_Server_Pins_Initialize (void) {
+
+  // DCD and RI are output lines of the vUSART line end
+  (void)vUSART_SetLine(ARDUINO_UNO_UART, VUSART_LINE_DCD, 0U);
+  (void)vUSART_SetLine(ARDUINO_UNO_UART, VUSART_LINE_RI,  0U);
+}
+
+/**
+  \fn            void USART_Server_Pins_Uninitialize (void)
+  \brief         Unconfigure, power down and uninitialize GPIO pins used for
+                 driving DCD and RI lines of the USART Client.
+  \return        none
+*/
+void USART_Server_Pins_Uninitialize (void) {
+  (void)vUSART_SetLine(ARDUINO_UNO_UART, VUSART_LINE_DCD, 0U);
+  (void)vUSART_SetLine(ARDUINO_UNO_UART, VUSART_LINE_RI,  0U);
+}
+
+/**
+  \fn            void USART_Server_Pin_DCD_SetState (uint32_t state)
+  \brief         Set state of GPIO pin used for driving DCD line of the USART Client.
+  \param[in]     state          State to be set
+                   - 0:    Drive pin to not active state
+                   - != 0: Drive pin to active state
+  \return        none
+*/
+void USART_Server_Pin_DCD_SetState (uint32_t state) {
+  (void)vUSART_SetLine(ARDUINO_UNO_UART, VUSART_LINE_DCD, state);
+}
+
+/**
+  \fn            void USART_Server_Pin_RI_SetState (uint32_t state)
+  \brief         Set state of GPIO pin used for driving RI line of the USART Client.
+  \param[in]     state          State to be set
+                   - 0:    Drive pin to not active state
+                   - != 0: Drive pin to active state
+  \return        none
+*/
+void USART_Server_Pin_RI_SetState (uint32_t state) {
+  (void)vUSART_SetLine(ARDUINO_UNO_UART, VUSART_LINE_RI, state);
+}
@@ -0,0 +1,1389 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-Driver Validation
+ * Title:       CMSIS-RTOS2 API on POSIX threads (Linux host)
+ * Purpose:     Implements the subset of CMSIS-RTOS2 used by the validation:
+ *               - Kernel information, control and tick/system timer
+ *               - Threads (joinable/detached, terminate, stack watermark)
+ *               - Thread flags, generic wait functions
+ *               - Event flags, mutexes, semaphores, message queues
+ *
+ *              Differences to an embedded RTOS kernel:
+ *               - all threads run in parallel, thread priorities are only
+ *                 stored and osKernelLock only excludes other lock owners
+ *               - osKernelStart returns to the caller (host main function)
+ *               - thread stack is allocated by the host (at least
+ *                 OS_STACK_MIN bytes), osThreadAttr_t stack_mem is ignored
+ *               - osThreadTerminate is asynchronous like on the target, a
+ *                 thread terminated inside the C library (printf, malloc)
+ *                 can leave a C library lock owned
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <limits.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "cmsis_os2.h"
+
+#ifndef OS_STACK_MIN
+#define OS_STACK_MIN        (64U * 1024U)   /* Minimum host thread stack size  */
+#endif
+
+#define OS_STACK_MAGIC      0xE25A2EA5U     /* Stack watermark pattern         */
+#define OS_STACK_MARGIN     1024U           /* Unpainted space below the SP    */
+
+#define OS_SYSTIMER_FREQ    100000000U      /* System timer frequency [Hz]     */
+#define OS_TICK_FREQ        1000U           /* Kernel tick frequency [Hz]      */
+
+#define OS_TERMINATE_WAIT   1000U           /* Thread termination wait [ms]    */
+
+/* Thread control block */
+typedef struct os_thread_s {
+  struct os_thread_s *next;             /* Next thread in the thread list     */
+  pthread_t       pt;                   /* POSIX thread                       */
+  osThreadFunc_t  func;                 /* Thread function                    */
+  void           *argument;             /* Thread function argument           */
+  const char     *name;                 /* Thread name                        */
+  osThreadState_t state;                /* Thread state                       */
+  osPriority_t    priority;             /* Thread priority (stored only)      */
+  uint32_t        joinable;             /* Thread is joinable                 */
+  uint32_t        foreign;              /* Thread not created by osThreadNew  */
+  uint32_t        flags;                /* Thread flags                       */
+  pthread_cond_t  cond;                 /* Thread flags and state change      */
+  uint32_t       *stack_lo;             /* Stack lowest address               */
+  uint32_t        stack_size;           /* Stack size [bytes]                 */
+  uint32_t        stack_space;          /* Stack space at thread termination  */
+} os_thread_t;
+
+/* Event flags control block */
+typedef struct {
+  const char     *name;                 /* Object name                        */
+  uint32_t        flags;                /* Event flags                        */
+  pthread_cond_t  cond;                 /* Event flags change                 */
+} os_event_flags_t;
+
+/* Mutex control block */
+typedef struct {
+  const char     *name;                 /* Object name                        */
+  uint32_t        attr_bits;            /* Mutex attributes                   */
+  os_thread_t    *owner;                /* Owner thread                       */
+  uint32_t        lock;                 /* Lock counter                       */
+  pthread_cond_t  cond;                 /* Mutex released                     */
+} os_mutex_t;
+
+/* Semaphore control block */
+typedef struct {
+  const char     *name;                 /* Object name                        */
+  uint32_t        tokens;               /* Available tokens                   */
+  uint32_t        max_tokens;           /* Maximum tokens                     */
+  pthread_cond_t  cond;                 /* Token released                     */
+} os_semaphore_t;
+
+/* Message queue control block */
+typedef struct {
+  const char     *name;                 /* Object name                        */
+  uint32_t        msg_count;            /* Maximum number of messages         */
+  uint32_t        msg_size;             /* Message size [bytes]               */
+  uint32_t        count;                /* Number of queued messages          */
+  uint8_t        *prio;                 /* Priority of queued messages        */
+  uint8_t        *data;                 /* Queued messages (FIFO per priority)*/
+  pthread_cond_t  cond;                 /* Message put or get                 */
+} os_message_queue_t;
+
+/* Kernel state */
+static pthread_mutex_t  os_mutex     = PTHREAD_MUTEX_INITIALIZER;  /* Object lock */
+static pthread_mutex_t  os_klock;       /* osKernelLock lock (recursive)      */
+static pthread_cond_t   os_start;       /* Kernel started                     */
+static osKernelState_t  os_state     = osKernelInactive;
+static struct timespec  os_time_base;   /* Kernel time base                   */
+static os_thread_t     *os_threads   = NULL;   /* Thread list                 */
+
+static __thread os_thread_t *os_self  = NULL;  /* Calling thread              */
+static __thread uint8_t      os_self_reg = 0U; /* Calling thread registering */
+static __thread uint32_t     os_klock_cnt = 0U;   /* Kernel lock owned        */
+static __thread int          os_klock_cancel;  /* Cancel state before lock    */
+
+
+/*-----------------------------------------------------------------------------
+ * Lock kernel objects (thread cancellation is disabled while locked)
+ *----------------------------------------------------------------------------*/
+static int OS_Lock (void) {
+  int cancel;
+
+  (void)pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &cancel);
+  (void)pthread_mutex_lock(&os_mutex);
+  return (cancel);
+}
+
+/*-----------------------------------------------------------------------------
+ * Unlock kernel objects and restore thread cancellation state
+ *----------------------------------------------------------------------------*/
+static void OS_Unlock (int cancel) {
+  (void)pthread_mutex_unlock(&os_mutex);
+  (void)pthread_setcancelstate(cancel, NULL);
+}
+
+/*-----------------------------------------------------------------------------
+ * Unlock kernel objects (cleanup handler of a terminated waiting thread)
+ *----------------------------------------------------------------------------*/
+static void OS_UnlockCleanup (void *arg) {
+  (void)arg;
+  (void)pthread_mutex_unlock(&os_mutex);
+}
+
+/*-----------------------------------------------------------------------------
+ * Allocate zero initialized object memory
+ *----------------------------------------------------------------------------*/
+static void *OS_Alloc (size_t size) {
+  return (calloc(1U, size));
+}
+
+/*-----------------------------------------------------------------------------
+ * Initialize condition variable using the monotonic clock
+ *----------------------------------------------------------------------------*/
+static void OS_CondInit (pthread_cond_t *cond) {
+  pthread_condattr_t attr;
+
+  (void)pthread_condattr_init(&attr);
+  (void)pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+  (void)pthread_cond_init(cond, &attr);
+  (void)pthread_condattr_destroy(&attr);
+}
+
+/*-----------------------------------------------------------------------------
+ * Get wait deadline from a timeout in kernel ticks
+ *----------------------------------------------------------------------------*/
+static struct timespec *OS_Deadline (uint32_t ticks, struct timespec *ts) {
+  uint64_t ns;
+
+  if (ticks == osWaitForever) {
+    return (NULL);
+  }
+  (void)clock_gettime(CLOCK_MONOTONIC, ts);
+  ns = (uint64_t)ts->tv_nsec + (((uint64_t)ticks * 1000000000U) / OS_TICK_FREQ);
+  ts->tv_sec  += (time_t)(ns / 1000000000U);
+  ts->tv_nsec  = (long)(ns % 1000000000U);
+  return (ts);
+}
+
+/*-----------------------------------------------------------------------------
+ * Wait for a condition (kernel objects locked), thread can be terminated
+ * while waiting
+ * \return 0 = signaled, ETIMEDOUT = deadline expired
+ *----------------------------------------------------------------------------*/
+static int OS_Wait (pthread_cond_t *cond, const struct timespec *deadline) {
+  int type, rc;
+
+  (void)pthread_setcanceltype(PTHREAD_CANCEL_DEFERRED, &type);
+  (void)pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, NULL);
+  pthread_cleanup_push(OS_UnlockCleanup, NULL);
+  if (deadline == NULL) {
+    rc = pthread_cond_wait(cond, &os_mutex);
+  } else {
+    rc = pthread_cond_timedwait(cond, &os_mutex, deadline);
+  }
+  pthread_cleanup_pop(0);
+  (void)pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, NULL);
+  (void)pthread_setcanceltype(type, NULL);
+
+  return (rc);
+}
+
+/*-----------------------------------------------------------------------------
+ * Check if a thread ID is valid (kernel objects locked)
+ *----------------------------------------------------------------------------*/
+static os_thread_t *OS_ThreadCheck (osThreadId_t thread_id) {
+  os_thread_t *th;
+
+  for (th = os_threads; th != NULL; th = th->next) {
+    if (th == (os_thread_t *)thread_id) {
+      return (th);
+    }
+  }
+  return (NULL);
+}
+
+/*-----------------------------------------------------------------------------
+ * Get control block of the calling thread (kernel objects locked),
+ * threads not created by osThreadNew (host main) are registered on first use
+ *----------------------------------------------------------------------------*/
+static os_thread_t *OS_ThreadSelf (void) {
+  os_thread_t *th;
+
+  if (os_self == NULL) {
+    os_self_reg = 1U;
+    th = OS_Alloc(sizeof(os_thread_t));
+    os_self_reg = 0U;
+    if (th != NULL) {
+      th->pt       = pthread_self();
+      th->name     = "main";
+      th->state    = osThreadRunning;
+      th->priority = osPriorityNormal;
+      th->foreign  = 1U;
+      OS_CondInit(&th->cond);
+      th->next   = os_threads;
+      os_threads = th;
+      os_self    = th;
+    }
+  }
+  return (os_self);
+}
+
+/*-----------------------------------------------------------------------------
+ * Get unused stack space of a thread from the stack watermark
+ *----------------------------------------------------------------------------*/
+static uint32_t OS_StackSpace (const os_thread_t *th) {
+  const uint32_t *p;
+  uint32_t        n, num;
+
+  if (th->stack_lo == NULL) {
+    return (0U);
+  }
+  num = th->stack_size / 4U;
+  p   = th->stack_lo;
+  for (n = 0U; n < num; n++) {
+    if (p[n] != OS_STACK_MAGIC) {
+      break;
+    }
+  }
+  return (n * 4U);
+}
+
+/*-----------------------------------------------------------------------------
+ * Paint stack of the calling thread with the watermark pattern
+ *----------------------------------------------------------------------------*/
+static void OS_StackPaint (os_thread_t *th) {
+  pthread_attr_t attr;
+  void          *addr;
+  size_t         size;
+  uint32_t      *p, *sp;
+  int            cancel;
+
+  if (pthread_getattr_np(pthread_self(), &attr) != 0) {
+    return;
+  }
+  if (pthread_attr_getstack(&attr, &addr, &size) == 0) {
+    sp = (uint32_t *)(void *)((uintptr_t)&attr - OS_STACK_MARGIN);
+    for (p = (uint32_t *)addr; p < sp; p++) {
+      *p = OS_STACK_MAGIC;
+    }
+    cancel = OS_Lock();
+    th->stack_size = (size > UINT32_MAX) ? UINT32_MAX : (uint32_t)size;
+    th->stack_lo   = (uint32_t *)addr;
+    OS_Unlock(cancel);
+  }
+  (void)pthread_attr_destroy(&attr);
+}
+
+/*-----------------------------------------------------------------------------
+ * Thread termination (cleanup handler of the thread start function)
+ *----------------------------------------------------------------------------*/
+static void OS_ThreadCleanup (void *arg) {
+  os_thread_t *th = (os_thread_t *)arg;
+  int          cancel;
+
+  if (os_klock_cnt != 0U) {             /* Release kernel lock if owned       */
+    os_klock_cnt = 0U;
+    (void)pthread_mutex_unlock(&os_klock);
+  }
+
+  cancel = OS_Lock();
+  th->stack_space = OS_StackSpace(th);
+  th->stack_lo    = NULL;               /* Stack is released by the host      */
+  th->state       = osThreadTerminated;
+  (void)pthread_cond_broadcast(&th->cond);
+  OS_Unlock(cancel);
+}
+
+/*-----------------------------------------------------------------------------
+ * Thread start function
+ *----------------------------------------------------------------------------*/
+static void *OS_ThreadStart (void *arg) {
+  os_thread_t *th = (os_thread_t *)arg;
+  int          cancel;
+
+  os_self = th;
+  pthread_cleanup_push(OS_ThreadCleanup, th);
+
+  OS_StackPaint(th);
+
+  cancel = OS_Lock();
+  while (os_state == osKernelReady) {   /* Wait until kernel is started       */
+    (void)OS_Wait(&os_start, NULL);
+  }
+  th->state = osThreadRunning;
+  OS_Unlock(cancel);
+
+  (void)pthread_setcanceltype(PTHREAD_CANCEL_ASYNCHRONOUS, NULL);
+  th->func(th->argument);
+  (void)pthread_setcanceltype(PTHREAD_CANCEL_DEFERRED, NULL);
+
+  pthread_cleanup_pop(1);
+
+  return (NULL);
+}
+
+/*-----------------------------------------------------------------------------
+ * Remove thread from the thread list and free it (kernel objects locked)
+ *----------------------------------------------------------------------------*/
+static void OS_ThreadFree (os_thread_t *th) {
+  os_thread_t **pp;
+
+  for (pp = &os_threads; *pp != NULL; pp = &(*pp)->next) {
+    if (*pp == th) {
+      *pp = th->next;
+      break;
+    }
+  }
+  (void)pthread_cond_destroy(&th->cond);
+  free(th);
+}
+
+/*-----------------------------------------------------------------------------
+ * Check if flags satisfy a wait condition
+ *----------------------------------------------------------------------------*/
+static uint32_t OS_FlagsMatch (uint32_t flags, uint32_t wait, uint32_t options) {
+  if ((options & osFlagsWaitAll) != 0U) {
+    return ((flags & wait) == wait) ? 1U : 0U;
+  }
+  return ((flags & wait) != 0U) ? 1U : 0U;
+}
+
+/*-----------------------------------------------------------------------------
+ * Wait for flags (kernel objects locked)
+ *----------------------------------------------------------------------------*/
+static uint32_t OS_FlagsWait (uint32_t *flags, pthread_cond_t *cond, uint32_t wait, uint32_t options, uint32_t timeout) {
+  struct timespec ts, *deadline;
+  uint32_t        rflags;
+
+  deadline = OS_Deadline(timeout, &ts);
+  while (OS_FlagsMatch(*flags, wait, options) == 0U) {
+    if (timeout == 0U) {
+      return (osFlagsErrorResource);
+    }
+    if (OS_Wait(cond, deadline) == ETIMEDOUT) {
+      if (OS_FlagsMatch(*flags, wait, options) == 0U) {
+        return (osFlagsErrorTimeout);
+      }
+    }
+  }
+  rflags = *flags;
+  if ((options & osFlagsNoClear) == 0U) {
+    *flags &= ~wait;
+  }
+  return (rflags);
+}
+
+
+/*==== Kernel Management Functions ====*/
+
+osStatus_t osKernelInitialize (void) {
+  pthread_mutexattr_t attr;
+  int                 cancel;
+  osStatus_t          status;
+
+  cancel = OS_Lock();
+  if (os_state == osKernelInactive) {
+    (void)pthread_mutexattr_init(&attr);
+    (void)pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    (void)pthread_mutex_init(&os_klock, &attr);
+    (void)pthread_mutexattr_destroy(&attr);
+    OS_CondInit(&os_start);
+    (void)clock_gettime(CLOCK_MONOTONIC, &os_time_base);
+    os_state = osKernelReady;
+    status = osOK;
+  } else {
+    status = osError;
+  }
+  OS_Unlock(cancel);
+
+  return (status);
+}
+
+osStatus_t osKernelGetInfo (osVersion_t *version, char *id_buf, uint32_t id_size) {
+  static const char id[] = "CMSIS-RTOS2 on POSIX threads";
+
+  if (version != NULL) {
+    version->api    = 20030000U;
+    version->kernel = 10000000U;
+  }
+  if ((id_buf != NULL) && (id_size != 0U)) {
+    (void)strncpy(id_buf, id, id_size - 1U);
+    id_buf[id_size - 1U] = '\0';
+  }
+  return (osOK);
+}
+
+osKernelState_t osKernelGetState (void) {
+  if ((os_state == osKernelRunning) && (os_klock_cnt != 0U)) {
+    return (osKernelLocked);
+  }
+  return (os_state);
+}
+
+osStatus_t osKernelStart (void) {
+  int        cancel;
+  osStatus_t status;
+
+  cancel = OS_Lock();
+  if (os_state == osKernelReady) {
+    os_state = osKernelRunning;
+    (void)pthread_cond_broadcast(&os_start);
+    status = osOK;
+  } else {
+    status = osError;
+  }
+  OS_Unlock(cancel);
+
+  /* Kernel runs in host threads, return to the host main function */
+  return (status);
+}
+
+int32_t osKernelLock (void) {
+  int cancel;
+
+  if (os_state == osKernelInactive) {
+    return ((int32_t)osError);
+  }
+  if (os_klock_cnt != 0U) {
+    return (1);
+  }
+  (void)pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &cancel);
+  (void)pthread_mutex_lock(&os_klock);
+  os_klock_cancel = cancel;
+  os_klock_cnt    = 1U;
+  return (0);
+}
+
+int32_t osKernelUnlock (void) {
+  if (os_state == osKernelInactive) {
+    return ((int32_t)osError);
+  }
+  if (os_klock_cnt == 0U) {
+    return (0);
+  }
+  os_klock_cnt = 0U;
+  (void)pthread_mutex_unlock(&os_klock);
+  (void)pthread_setcancelstate(os_klock_cancel, NULL);
+  return (1);
+}
+
+int32_t osKernelRestoreLock (int32_t lock) {
+  if (lock == 1) {
+    return (((osKernelLock() >= 0) ? 1 : (int32_t)osError));
+  }
+  if (lock == 0) {
+    return (((osKernelUnlock() >= 0) ? 0 : (int32_t)osError));
+  }
+  return ((int32_t)osError);
+}
+
+uint32_t osKernelGetTickCount (void) {
+  struct timespec ts;
+  uint64_t        ms;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  ms  = (uint64_t)(ts.tv_sec - os_time_base.tv_sec) * 1000U;
+  ms += (uint64_t)((ts.tv_nsec - os_time_base.tv_nsec) / 1000000);
+  return ((uint32_t)ms);
+}
+
+uint32_t osKernelGetTickFreq (void) {
+  return (OS_TICK_FREQ);
+}
+
+uint32_t osKernelGetSysTimerCount (void) {
+  struct timespec ts;
+  uint64_t        ns;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  ns = ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+  return ((uint32_t)(ns / (1000000000U / OS_SYSTIMER_FREQ)));
+}
+
+uint32_t osKernelGetSysTimerFreq (void) {
+  return (OS_SYSTIMER_FREQ);
+}
+
+
+/*==== Thread Management Functions ====*/
+
+osThreadId_t osThreadNew (osThreadFunc_t func, void *argument, const osThreadAttr_t *attr) {
+  os_thread_t    *th;
+  pthread_attr_t  pattr;
+  size_t          stack_size;
+  int             cancel;
+
+  if ((func == NULL) || (os_state == osKernelInactive)) {
+    return (NULL);
+  }
+
+  th = OS_Alloc(sizeof(os_thread_t));
+  if (th == NULL) {
+    return (NULL);
+  }
+  th->func     = func;
+  th->argument = argument;
+  th->state    = osThreadReady;
+  th->priority = osPriorityNormal;
+  stack_size   = OS_STACK_MIN;
+  if (attr != NULL) {
+    th->name = attr->name;
+    if (attr->priority != osPriorityNone) {
+      th->priority = attr->priority;
+    }
+    if ((attr->attr_bits & osThreadJoinable) != 0U) {
+      th->joinable = 1U;
+    }
+    if (attr->stack_size > stack_size) {
+      stack_size = attr->stack_size;
+    }
+  }
+  th->stack_size = (uint32_t)stack_size;
+  OS_CondInit(&th->cond);
+
+  (void)pthread_attr_init(&pattr);
+  (void)pthread_attr_setstacksize(&pattr, stack_size);
+  (void)pthread_attr_setdetachstate(&pattr, (th->joinable != 0U) ? PTHREAD_CREATE_JOINABLE : PTHREAD_CREATE_DETACHED);
+
+  cancel = OS_Lock();
+  th->next   = os_threads;
+  os_threads = th;
+  if (pthread_create(&th->pt, &pattr, OS_ThreadStart, th) != 0) {
+    OS_ThreadFree(th);
+    th = NULL;
+  }
+  OS_Unlock(cancel);
+
+  (void)pthread_attr_destroy(&pattr);
+
+  return ((osThreadId_t)th);
+}
+
+const char *osThreadGetName (osThreadId_t thread_id) {
+  const os_thread_t *th;
+  int                cancel;
+
+  cancel = OS_Lock();
+  th = OS_ThreadCheck(thread_id);
+  OS_Unlock(cancel);
+
+  return ((th != NULL) ? th->name : NULL);
+}
+
+osThreadId_t osThreadGetId (void) {
+  os_thread_t *th;
+  int          cancel;
+
+  if (os_self != NULL) {
+    return ((osThreadId_t)os_self);
+  }
+  if ((os_state == osKernelInactive) || (os_self_reg != 0U)) {
+    /* Not running or called by the heap wrappers while registering */
+    return (NULL);
+  }
+  cancel = OS_Lock();
+  th = OS_ThreadSelf();
+  OS_Unlock(cancel);
+
+  return ((osThreadId_t)th);
+}
+
+osThreadState_t osThreadGetState (osThreadId_t thread_id) {
+  const os_thread_t *th;
+  osThreadState_t    state;
+  int                cancel;
+
+  cancel = OS_Lock();
+  th = OS_ThreadCheck(thread_id);
+  if (th == NULL) {
+    state = osThreadError;
+  } else if ((th == os_self) && (th->state != osThreadTerminated)) {
+    state = osThreadRunning;
+  } else {
+    state = th->state;
+  }
+  OS_Unlock(cancel);
+
+  return (state);
+}
+
+uint32_t osThreadGetStackSize (osThreadId_t thread_id) {
+  const os_thread_t *th;
+  uint32_t           size;
+  int                cancel;
+
+  cancel = OS_Lock();
+  th   = OS_ThreadCheck(thread_id);
+  size = (th != NULL) ? th->stack_size : 0U;
+  OS_Unlock(cancel);
+
+  return (size);
+}
+
+uint32_t osThreadGetStackSpace (osThreadId_t thread_id) {
+  const os_thread_t *th;
+  uint32_t           space;
+  int                cancel;
+
+  cancel = OS_Lock();
+  th = OS_ThreadCheck(thread_id);
+  if (th == NULL) {
+    space = 0U;
+  } else if (th->state == osThreadTerminated) {
+    space = th->stack_space;
+  } else {
+    space = OS_StackSpace(th);
+  }
+  OS_Unlock(cancel);
+
+  return (space);
+}
+
+osStatus_t osThreadSetPriority (osThreadId_t thread_id, osPriority_t priority) {
+  os_thread_t *th;
+  osStatus_t   status;
+  int          cancel;
+
+  if ((priority < osPriorityIdle) || (priority > osPriorityISR)) {
+    return (osErrorParameter);
+  }
+  cancel = OS_Lock();
+  th = OS_ThreadCheck(thread_id);
+  if ((th == NULL) || (th->state == osThreadTerminated)) {
+    status = (th == NULL) ? osErrorParameter : osErrorResource;
+  } else {
+    th->priority = priority;
+    status = osOK;
+  }
+  OS_Unlock(cancel);
+
+  return (status);
+}
+
+osPriority_t osThreadGetPriority (osThreadId_t thread_id) {
+  const os_thread_t *th;
+  osPriority_t       priority;
+  int                cancel;
+
+  cancel = OS_Lock();
+  th = OS_ThreadCheck(thread_id);
+  priority = ((th != NULL) && (th->state != osThreadTerminated)) ? th->priority : osPriorityError;
+  OS_Unlock(cancel);
+
+  return (priority);
+}
+
+osStatus_t osThreadYield (void) {
+  (void)sched_yield();
+  return (osOK);
+}
+
+osStatus_t osThreadDetach (osThreadId_t thread_id) {
+  os_thread_t *th;
+  osStatus_t   status;
+  int          cancel;
+
+  cancel = OS_Lock();
+  th = OS_ThreadCheck(thread_id);
+  if (th == NULL) {
+    status = osErrorParameter;
+  } else if (th->joinable == 0U) {
+    status = osErrorResource;
+  } else {
+    th->joinable = 0U;
+    (void)pthread_detach(th->pt);
+    status = osOK;
+  }
+  OS_Unlock(cancel);
+
+  return (status);
+}
+
+osStatus_t osThreadJoin (osThreadId_t thread_id) {
+  os_thread_t *th;
+  osStatus_t   status;
+  int          cancel;
+
+  cancel = OS_Lock();
+  th = OS_ThreadCheck(thread_id);
+  if (th == NULL) {
+    status = osErrorParameter;
+  } else if ((th->joinable == 0U) || (th == os_self)) {
+    status = osErrorResource;
+  } else {
+    while (th->state != osThreadTerminated) {
+      (void)OS_Wait(&th->cond, NULL);
+    }
+    th->joinable = 0U;
+    status = osOK;
+  }
+  OS_Unlock(cancel);
+
+  if (status == osOK) {
+    (void)pthread_join(th->pt, NULL);   /* Release host thread resources      */
+    cancel = OS_Lock();
+    OS_ThreadFree(th);
+    OS_Unlock(cancel);
+  }
+
+  return (status);
+}
+
+__NO_RETURN void osThreadExit (void) {
+  os_thread_t *th;
+  int          cancel;
+
+  th = os_self;
+  if ((th != NULL) && (th->foreign != 0U)) {
+    cancel = OS_Lock();
+    th->state = osThreadTerminated;
+    (void)pthread_cond_broadcast(&th->cond);
+    OS_Unlock(cancel);
+  }
+  pthread_exit(NULL);                   /* Runs thread cleanup handler        */
+}
+
+osStatus_t osThreadTerminate (osThreadId_t thread_id) {
+  os_thread_t     *th;
+  struct timespec  ts;
+  osStatus_t       status;
+  int              cancel;
+
+  if ((thread_id != NULL) && (thread_id == (osThreadId_t)os_self)) {
+    osThreadExit();
+  }
+
+  cancel = OS_Lock();
+  th = OS_ThreadCheck(thread_id);
+  if (th == NULL) {
+    status = osErrorParameter;
+  } else if ((th->state == osThreadTerminated) || (th->foreign != 0U)) {
+    status = osErrorResource;
+  } else {
+    (void)pthread_cancel(th->pt);
+    /* Wait until the thread has terminated (the thread could be blocked
+       in the C library with cancellation disabled) */
+    (void)OS_Deadline(OS_TERMINATE_WAIT, &ts);
+    while (th->state != osThreadTerminated) {
+      if (OS_Wait(&th->cond, &ts) == ETIMEDOUT) {
+        break;
+      }
+    }
+    status = osOK;
+  }
+  OS_Unlock(cancel);
+
+  return (status);
+}
+
+
+/*==== Thread Flags Functions ====*/
+
+uint32_t osThreadFlagsSet (osThreadId_t thread_id, uint32_t flags) {
+  os_thread_t *th;
+  uint32_t     rflags;
+  int          cancel;
+
+  if ((flags & osFlagsError) != 0U) {
+    return (osFlagsErrorParameter);
+  }
+  cancel = OS_Lock();
+  th = OS_ThreadCheck(thread_id);
+  if ((th == NULL) || (th->state == osThreadTerminated)) {
+    rflags = osFlagsErrorParameter;
+  } else {
+    th->flags |= flags;
+    rflags = th->flags;
+    (void)pthread_cond_broadcast(&th->cond);
+  }
+  OS_Unlock(cancel);
+
+  return (rflags);
+}
+
+uint32_t osThreadFlagsClear (uint32_t flags) {
+  os_thread_t *th;
+  uint32_t     rflags;
+  int          cancel;
+
+  if ((flags & osFlagsError) != 0U) {
+    return (osFlagsErrorParameter);
+  }
+  cancel = OS_Lock();
+  th = OS_ThreadSelf();
+  if (th == NULL) {
+    rflags = osFlagsErrorUnknown;
+  } else {
+    rflags = th->flags;
+    th->flags &= ~flags;
+  }
+  OS_Unlock(cancel);
+
+  return (rflags);
+}
+
+uint32_t osThreadFlagsGet (void) {
+  os_thread_t *th;
+  uint32_t     rflags;
+  int          cancel;
+
+  cancel = OS_Lock();
+  th = OS_ThreadSelf();
+  rflags = (th != NULL) ? th->flags : 0U;
+  OS_Unlock(cancel);
+
+  return (rflags);
+}
+
+uint32_t osThreadFlagsWait (uint32_t flags, uint32_t options, uint32_t timeout) {
+  os_thread_t *th;
+  uint32_t     rflags;
+  int          cancel;
+
+  if ((flags & osFlagsError) != 0U) {
+    return (osFlagsErrorParameter);
+  }
+  cancel = OS_Lock();
+  th = OS_ThreadSelf();
+  if (th == NULL) {
+    rflags = osFlagsErrorUnknown;
+  } else {
+    rflags = OS_FlagsWait(&th->flags, &th->cond, flags, options, timeout);
+  }
+  OS_Unlock(cancel);
+
+  return (rflags);
+}
+
+
+/*==== Generic Wait Functions ====*/
+
+osStatus_t osDelay (uint32_t ticks) {
+  struct timespec ts;
+
+  if (ticks == 0U) {
+    return (osErrorParameter);
+  }
+  ts.tv_sec  = (time_t)(ticks / OS_TICK_FREQ);
+  ts.tv_nsec = (long)((ticks % OS_TICK_FREQ) * (1000000000U / OS_TICK_FREQ));
+  while (clock_nanosleep(CLOCK_MONOTONIC, 0, &ts, &ts) == EINTR) {
+    // Continue sleeping after signal
+  }
+  return (osOK);
+}
+
+osStatus_t osDelayUntil (uint32_t ticks) {
+  uint32_t delay;
+
+  delay = ticks - osKernelGetTickCount();
+  if ((delay == 0U) || (delay > 0x7FFFFFFFU)) {
+    return (osErrorParameter);
+  }
+  return (osDelay(delay));
+}
+
+
+/*==== Event Flags Management Functions ====*/
+
+osEventFlagsId_t osEventFlagsNew (const osEventFlagsAttr_t *attr) {
+  os_event_flags_t *ef;
+
+  ef = OS_Alloc(sizeof(os_event_flags_t));
+  if (ef != NULL) {
+    ef->name = (attr != NULL) ? attr->name : NULL;
+    OS_CondInit(&ef->cond);
+  }
+  return ((osEventFlagsId_t)ef);
+}
+
+const char *osEventFlagsGetName (osEventFlagsId_t ef_id) {
+  return ((ef_id != NULL) ? ((os_event_flags_t *)ef_id)->name : NULL);
+}
+
+uint32_t osEventFlagsSet (osEventFlagsId_t ef_id, uint32_t flags) {
+  os_event_flags_t *ef = (os_event_flags_t *)ef_id;
+  uint32_t          rflags;
+  int               cancel;
+
+  if ((ef == NULL) || ((flags & osFlagsError) != 0U)) {
+    return (osFlagsErrorParameter);
+  }
+  cancel = OS_Lock();
+  ef->flags |= flags;
+  rflags = ef->flags;
+  (void)pthread_cond_broadcast(&ef->cond);
+  OS_Unlock(cancel);
+
+  return (rflags);
+}
+
+uint32_t osEventFlagsClear (osEventFlagsId_t ef_id, uint32_t flags) {
+  os_event_flags_t *ef = (os_event_flags_t *)ef_id;
+  uint32_t          rflags;
+  int               cancel;
+
+  if ((ef == NULL) || ((flags & osFlagsError) != 0U)) {
+    return (osFlagsErrorParameter);
+  }
+  cancel = OS_Lock();
+  rflags = ef->flags;
+  ef->flags &= ~flags;
+  OS_Unlock(cancel);
+
+  return (rflags);
+}
+
+uint32_t osEventFlagsGet (osEventFlagsId_t ef_id) {
+  os_event_flags_t *ef = (os_event_flags_t *)ef_id;
+  uint32_t          rflags;
+  int               cancel;
+
+  if (ef == NULL) {
+    return (0U);
+  }
+  cancel = OS_Lock();
+  rflags = ef->flags;
+  OS_Unlock(cancel);
+
+  return (rflags);
+}
+
+uint32_t osEventFlagsWait (osEventFlagsId_t ef_id, uint32_t flags, uint32_t options, uint32_t timeout) {
+  os_event_flags_t *ef = (os_event_flags_t *)ef_id;
+  uint32_t          rflags;
+  int               cancel;
+
+  if ((ef == NULL) || ((flags & osFlagsError) != 0U)) {
+    return (osFlagsErrorParameter);
+  }
+  cancel = OS_Lock();
+  rflags = OS_FlagsWait(&ef->flags, &ef->cond, flags, options, timeout);
+  OS_Unlock(cancel);
+
+  return (rflags);
+}
+
+osStatus_t osEventFlagsDelete (osEventFlagsId_t ef_id) {
+  os_event_flags_t *ef = (os_event_flags_t *)ef_id;
+
+  if (ef == NULL) {
+    return (osErrorParameter);
+  }
+  (void)pthread_cond_destroy(&ef->cond);
+  free(ef);
+  return (osOK);
+}
+
+
+/*==== Mutex Management Functions ====*/
+
+osMutexId_t osMutexNew (const osMutexAttr_t *attr) {
+  os_mutex_t *mutex;
+
+  mutex = OS_Alloc(sizeof(os_mutex_t));
+  if (mutex != NULL) {
+    if (attr != NULL) {
+      mutex->name      = attr->name;
+      mutex->attr_bits = attr->attr_bits;
+    }
+    OS_CondInit(&mutex->cond);
+  }
+  return ((osMutexId_t)mutex);
+}
+
+const char *osMutexGetName (osMutexId_t mutex_id) {
+  return ((mutex_id != NULL) ? ((os_mutex_t *)mutex_id)->name : NULL);
+}
+
+osStatus_t osMutexAcquire (osMutexId_t mutex_id, uint32_t timeout) {
+  os_mutex_t     *mutex = (os_mutex_t *)mutex_id;
+  os_thread_t    *th;
+  struct timespec ts, *deadline;
+  osStatus_t      status;
+  int             cancel;
+
+  if (mutex == NULL) {
+    return (osErrorParameter);
+  }
+  cancel = OS_Lock();
+  th = OS_ThreadSelf();
+  if (mutex->owner == th) {
+    if ((mutex->attr_bits & osMutexRecursive) != 0U) {
+      mutex->lock++;
+      status = osOK;
+    } else {
+      status = osErrorResource;
+    }
+  } else {
+    status   = osOK;
+    deadline = OS_Deadline(timeout, &ts);
+    while (mutex->owner != NULL) {
+      if (timeout == 0U) {
+        status = osErrorResource;
+        break;
+      }
+      if ((OS_Wait(&mutex->cond, deadline) == ETIMEDOUT) && (mutex->owner != NULL)) {
+        status = osErrorTimeout;
+        break;
+      }
+    }
+    if (status == osOK) {
+      mutex->owner = th;
+      mutex->lock  = 1U;
+    }
+  }
+  OS_Unlock(cancel);
+
+  return (status);
+}
+
+osStatus_t osMutexRelease (osMutexId_t mutex_id) {
+  os_mutex_t *mutex = (os_mutex_t *)mutex_id;
+  osStatus_t  status;
+  int         cancel;
+
+  if (mutex == NULL) {
+    return (osErrorParameter);
+  }
+  cancel = OS_Lock();
+  if ((mutex->lock == 0U) || (mutex->owner != OS_ThreadSelf())) {
+    status = osErrorResource;
+  } else {
+    mutex->lock--;
+    if (mutex->lock == 0U) {
+      mutex->owner = NULL;
+      (void)pthread_cond_signal(&mutex->cond);
+    }
+    status = osOK;
+  }
+  OS_Unlock(cancel);
+
+  return (status);
+}
+
+osThreadId_t osMutexGetOwner (osMutexId_t mutex_id) {
+  os_mutex_t  *mutex = (os_mutex_t *)mutex_id;
+  os_thread_t *owner;
+  int          cancel;
+
+  if (mutex == NULL) {
+    return (NULL);
+  }
+  cancel = OS_Lock();
+  owner = mutex->owner;
+  OS_Unlock(cancel);
+
+  return ((osThreadId_t)owner);
+}
+
+osStatus_t osMutexDelete (osMutexId_t mutex_id) {
+  os_mutex_t *mutex = (os_mutex_t *)mutex_id;
+
+  if (mutex == NULL) {
+    return (osErrorParameter);
+  }
+  (void)pthread_cond_destroy(&mutex->cond);
+  free(mutex);
+  return (osOK);
+}
+
+
+/*==== Semaphore Management Functions ====*/
+
+osSemaphoreId_t osSemaphoreNew (uint32_t max_count, uint32_t initial_count, const osSemaphoreAttr_t *attr) {
+  os_semaphore_t *sem;
+
+  if ((max_count == 0U) || (initial_count > max_count)) {
+    return (NULL);
+  }
+  sem = OS_Alloc(sizeof(os_semaphore_t));
+  if (sem != NULL) {
+    sem->name       = (attr != NULL) ? attr->name : NULL;
+    sem->tokens     = initial_count;
+    sem->max_tokens = max_count;
+    OS_CondInit(&sem->cond);
+  }
+  return ((osSemaphoreId_t)sem);
+}
+
+const char *osSemaphoreGetName (osSemaphoreId_t semaphore_id) {
+  return ((semaphore_id != NULL) ? ((os_semaphore_t *)semaphore_id)->name : NULL);
+}
+
+osStatus_t osSemaphoreAcquire (osSemaphoreId_t semaphore_id, uint32_t timeout) {
+  os_semaphore_t *sem = (os_semaphore_t *)semaphore_id;
+  struct timespec ts, *deadline;
+  osStatus_t      status;
+  int             cancel;
+
+  if (sem == NULL) {
+    return (osErrorParameter);
+  }
+  cancel = OS_Lock();
+  status   = osOK;
+  deadline = OS_Deadline(timeout, &ts);
+  while (sem->tokens == 0U) {
+    if (timeout == 0U) {
+      status = osErrorResource;
+      break;
+    }
+    if ((OS_Wait(&sem->cond, deadline) == ETIMEDOUT) && (sem->tokens == 0U)) {
+      status = osErrorTimeout;
+      break;
+    }
+  }
+  if (status == osOK) {
+    sem->tokens--;
+  }
+  OS_Unlock(cancel);
+
+  return (status);
+}
+
+osStatus_t osSemaphoreRelease (osSemaphoreId_t semaphore_id) {
+  os_semaphore_t *sem = (os_semaphore_t *)semaphore_id;
+  osStatus_t      status;
+  int             cancel;
+
+  if (sem == NULL) {
+    return (osErrorParameter);
+  }
+  cancel = OS_Lock();
+  if (sem->tokens < sem->max_tokens) {
+    sem->tokens++;
+    (void)pthread_cond_signal(&sem->cond);
+    status = osOK;
+  } else {
+    status = osErrorResource;
+  }
+  OS_Unlock(cancel);
+
+  return (status);
+}
+
+uint32_t osSemaphoreGetCount (osSemaphoreId_t semaphore_id) {
+  os_semaphore_t *sem = (os_semaphore_t *)semaphore_id;
+  uint32_t        count;
+  int             cancel;
+
+  if (sem == NULL) {
+    return (0U);
+  }
+  cancel = OS_Lock();
+  count = sem->tokens;
+  OS_Unlock(cancel);
+
+  return (count);
+}
+
+osStatus_t osSemaphoreDelete (osSemaphoreId_t semaphore_id) {
+  os_semaphore_t *sem = (os_semaphore_t *)semaphore_id;
+
+  if (sem == NULL) {
+    return (osErrorParameter);
+  }
+  (void)pthread_cond_destroy(&sem->cond);
+  free(sem);
+  return (osOK);
+}
+
+
+/*==== Message Queue Management Functions ====*/
+
+osMessageQueueId_t osMessageQueueNew (uint32_t msg_count, uint32_t msg_size, const osMessageQueueAttr_t *attr) {
+  os_message_queue_t *mq;
+
+  if ((msg_count == 0U) || (msg_size == 0U)) {
+    return (NULL);
+  }
+  mq = OS_Alloc(sizeof(os_message_queue_t));
+  if (mq == NULL) {
+    return (NULL);
+  }
+  mq->prio = OS_Alloc(msg_count);
+  mq->data = OS_Alloc((size_t)msg_count * msg_size);
+  if ((mq->prio == NULL) || (mq->data == NULL)) {
+    free(mq->prio);
+    free(mq->data);
+    free(mq);
+    return (NULL);
+  }
+  mq->name      = (attr != NULL) ? attr->name : NULL;
+  mq->msg_count = msg_count;
+  mq->msg_size  = msg_size;
+  OS_CondInit(&mq->cond);
+
+  return ((osMessageQueueId_t)mq);
+}
+
+const char *osMessageQueueGetName (osMessageQueueId_t mq_id) {
+  return ((mq_id != NULL) ? ((os_message_queue_t *)mq_id)->name : NULL);
+}
+
+osStatus_t osMessageQueuePut (osMessageQueueId_t mq_id, const void *msg_ptr, uint8_t msg_prio, uint32_t timeout) {
+  os_message_queue_t *mq = (os_message_queue_t *)mq_id;
+  struct timespec     ts, *deadline;
+  osStatus_t          status;
+  uint32_t            i;
+  int                 cancel;
+
+  if ((mq == NULL) || (msg_ptr == NULL)) {
+    return (osErrorParameter);
+  }
+  cancel = OS_Lock();
+  status   = osOK;
+  deadline = OS_Deadline(timeout, &ts);
+  while (mq->count == mq->msg_count) {
+    if (timeout == 0U) {
+      status = osErrorResource;
+      break;
+    }
+    if ((OS_Wait(&mq->cond, deadline) == ETIMEDOUT) && (mq->count == mq->msg_count)) {
+      status = osErrorTimeout;
+      break;
+    }
+  }
+  if (status == osOK) {
+    /* Insert behind messages with the same or higher priority */
+    for (i = mq->count; (i > 0U) && (mq->prio[i - 1U] < msg_prio); i--) {
+      mq->prio[i] = mq->prio[i - 1U];
+      (void)memcpy(&mq->data[i * mq->msg_size], &mq->data[(i - 1U) * mq->msg_size], mq->msg_size);
+    }
+    mq->prio[i] = msg_prio;
+    (void)memcpy(&mq->data[i * mq->msg_size], msg_ptr, mq->msg_size);
+    mq->count++;
+    (void)pthread_cond_broadcast(&mq->cond);
+  }
+  OS_Unlock(cancel);
+
+  return (status);
+}
+
+osStatus_t osMessageQueueGet (osMessageQueueId_t mq_id, void *msg_ptr, uint8_t *msg_prio, uint32_t timeout) {
+  os_message_queue_t *mq = (os_message_queue_t *)mq_id;
+  struct timespec     ts, *deadline;
+  osStatus_t          status;
+  int                 cancel;
+
+  if ((mq == NULL) || (msg_ptr == NULL)) {
+    return (osErrorParameter);
+  }
+  cancel = OS_Lock();
+  status   = osOK;
+  deadline = OS_Deadline(timeout, &ts);
+  while (mq->count == 0U) {
+    if (timeout == 0U) {
+      status = osErrorResource;
+      break;
+    }
+    if ((OS_Wait(&mq->cond, deadline) == ETIMEDOUT) && (mq->count == 0U)) {
+      status = osErrorTimeout;
+      break;
+    }
+  }
+  if (status == osOK) {
+    (void)memcpy(msg_ptr, mq->data, mq->msg_size);
+    if (msg_prio != NULL) {
+      *msg_prio = mq->prio[0];
+    }
+    mq->count--;
+    (void)memmove(mq->prio, &mq->prio[1], mq->count);
+    (void)memmove(mq->data, &mq->data[mq->msg_size], (size_t)mq->count * mq->msg_size);
+    (void)pthread_cond_broadcast(&mq->cond);
+  }
+  OS_Unlock(cancel);
+
+  return (status);
+}
+
+uint32_t osMessageQueueGetCapacity (osMessageQueueId_t mq_id) {
+  return ((mq_id != NULL) ? ((os_message_queue_t *)mq_id)->msg_count : 0U);
+}
+
+uint32_t osMessageQueueGetMsgSize (osMessageQueueId_t mq_id) {
+  return ((mq_id != NULL) ? ((os_message_queue_t *)mq_id)->msg_size : 0U);
+}
+
+uint32_t osMessageQueueGetCount (osMessageQueueId_t mq_id) {
+  os_message_queue_t *mq = (os_message_queue_t *)mq_id;
+  uint32_t            count;
+  int                 cancel;
+
+  if (mq == NULL) {
+    return (0U);
+  }
+  cancel = OS_Lock();
+  count = mq->count;
+  OS_Unlock(cancel);
+
+  return (count);
+}
+
+uint32_t osMessageQueueGetSpace (osMessageQueueId_t mq_id) {
+  os_message_queue_t *mq = (os_message_queue_t *)mq_id;
+  uint32_t            space;
+  int                 cancel;
+
+  if (mq == NULL) {
+    return (0U);
+  }
+  cancel = OS_Lock();
+  space = mq->msg_count - mq->count;
+  OS_Unlock(cancel);
+
+  return (space);
+}
+
+osStatus_t osMessageQueueReset (osMessageQueueId_t mq_id) {
+  os_message_queue_t *mq = (os_message_queue_t *)mq_id;
+  int                 cancel;
+
+  if (mq == NULL) {
+    return (osErrorParameter);
+  }
+  cancel = OS_Lock();
+  mq->count = 0U;
+  (void)pthread_cond_broadcast(&mq->cond);
+  OS_Unlock(cancel);
+
+  return (osOK);
+}
+
+osStatus_t osMessageQueueDelete (osMessageQueueId_t mq_id) {
+  os_message_queue_t *mq = (os_message_queue_t *)mq_id;
+
+  if (mq == NULL) {
+    return (osErrorParameter);
+  }
+  (void)pthread_cond_destroy(&mq->cond);
+  free(mq->prio);
+  free(mq->data);
+  free(mq);
+  return (osOK);
+}
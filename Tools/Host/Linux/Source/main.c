@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-Driver Validation
+ * Title:       Linux host application
+ * Purpose:     Executes the validation as a normal process:
+ *                cmsis_dv_host [test_filter]
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "cmsis_os2.h"
+#include "cmsis_dv.h"
+#include "DV_Config.h"
+
+#ifdef RTE_CMSIS_DV_SPI
+#include "SPI_Server.h"
+#endif
+#ifdef RTE_CMSIS_DV_USART
+#include "USART_Server.h"
+#include "vUSART_Config.h"
+#endif
+
+#if (DV_TEST_FILTER_EN != 0)
+extern char dv_test_filter[DV_TEST_FILTER_SIZE];
+#endif
+
+#if (DV_TRACE_EN != 0)
+#ifndef DV_HOST_TRACE_FILE
+#define DV_HOST_TRACE_FILE      "dv_trace.bin"
+#endif
+extern uint32_t __trace_dump (const void **data);
+#endif
+
+extern void __report_abort (void);
+
+static sigset_t sig_set;                // Signals terminating the test run
+
+static const osThreadAttr_t app_main_attr = {
+  .name       = "app_main",
+  .attr_bits  = osThreadJoinable,
+  .stack_size = 4096U
+};
+
+static const osThreadAttr_t sig_attr = {
+  .name       = "signal",
+  .stack_size = 4096U
+};
+
+/*---------------------------------------------------------------------------
+ * Application main thread
+ *---------------------------------------------------------------------------*/
+static void app_main_thread (void *argument) {
+
+#ifdef RTE_CMSIS_DV_SPI
+  if (SPI_Server_Start() != 0) {        // SPI Server on the virtual SPI bus
+    printf("SPI Server start failed!\n");
+  }
+#endif
+#if (defined(RTE_CMSIS_DV_USART) && (VUSART_TTY_EN == 0))
+  if (USART_Server_Start() != 0) {      // USART Server on the virtual USART
+    printf("USART Server start failed!\n");
+  }
+#endif
+
+  cmsis_dv(argument);                   // Execute tests
+
+  osThreadExit();
+}
+
+#if (DV_TRACE_EN != 0)
+/*---------------------------------------------------------------------------
+ * Write driver API trace ring to a file (convert with dv_trace2json.py)
+ *---------------------------------------------------------------------------*/
+static void trace_save (void) {
+  const void *data;
+  uint32_t    size;
+  FILE       *f;
+
+  size = __trace_dump(&data);
+  f = fopen(DV_HOST_TRACE_FILE, "wb");
+  if ((f == NULL) || (fwrite(data, 1U, size, f) != size)) {
+    fprintf(stderr, "Trace write to %s failed!\n", DV_HOST_TRACE_FILE);
+  }
+  if (f != NULL) {
+    (void)fclose(f);
+  }
+}
+
+#endif
+
+/*---------------------------------------------------------------------------
+ * Signal thread: close the report when the test run is terminated
+ * (Ctrl+C, timeout of a test runner), so that the XML report stays valid
+ *---------------------------------------------------------------------------*/
+static void sig_thread (void *argument) {
+  int sig;
+
+  (void)argument;
+
+  if (sigwait(&sig_set, &sig) == 0) {
+    __report_abort();
+#if (DV_TRACE_EN != 0)
+    trace_save();
+#endif
+    _exit(128 + sig);
+  }
+  osThreadExit();
+}
+
+/*---------------------------------------------------------------------------
+ * Host main function
+ *---------------------------------------------------------------------------*/
+int main (int argc, char *argv[]) {
+  osThreadId_t thread;
+
+#if (DV_TEST_FILTER_EN != 0)
+  if (argc > 1) {                       // Test filter from the command line
+    strncpy(dv_test_filter, argv[1], DV_TEST_FILTER_SIZE - 1U);
+    dv_test_filter[DV_TEST_FILTER_SIZE - 1U] = '\0';
+  }
+#else
+  if (argc > 1) {
+    fprintf(stderr, "%s: test filter ignored (DV_TEST_FILTER_EN = 0)\n", argv[0]);
+  }
+#endif
+
+  (void)setvbuf(stdout, NULL, _IOLBF, 0U);
+
+  // Terminating signals are handled by the signal thread (mask is inherited)
+  (void)sigemptyset(&sig_set);
+  (void)sigaddset(&sig_set, SIGINT);
+  (void)sigaddset(&sig_set, SIGTERM);
+  (void)sigaddset(&sig_set, SIGHUP);
+  (void)pthread_sigmask(SIG_BLOCK, &sig_set, NULL);
+
+  if (osKernelInitialize() != osOK) {
+    return 1;
+  }
+  if (osThreadNew(sig_thread, NULL, &sig_attr) == NULL) {
+    return 1;
+  }
+  thread = osThreadNew(app_main_thread, NULL, &app_main_attr);
+  if (thread == NULL) {
+    return 1;
+  }
+  (void)osKernelStart();                // Returns on host, threads are running
+  (void)osThreadJoin(thread);           // Wait until tests are done
+#if (DV_TRACE_EN != 0)
+  trace_save();                         // Driver API trace dump
+#endif
+
+  return 0;
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-Driver Validation
+ * Title:       Virtual I/O (VIO) for the Linux host
+ * Purpose:     Signals and values are kept in memory (LEDs of the servers
+ *              can be inspected with a debugger)
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "cmsis_vio.h"
+#include "cmsis_compiler.h"
+
+#define VIO_VALUE_NUM   4U              /* Number of values */
+
+__USED uint32_t vioSignalIn;            /* Memory for incoming signals */
+__USED uint32_t vioSignalOut;           /* Memory for outgoing signals */
+__USED int32_t  vioValue[VIO_VALUE_NUM];/* Memory for values */
+
+/* Initialize test input, output */
+void vioInit (void) {
+  uint32_t i;
+
+  vioSignalIn  = 0U;
+  vioSignalOut = 0U;
+  for (i = 0U; i < VIO_VALUE_NUM; i++) {
+    vioValue[i] = 0;
+  }
+}
+
+/* Set signal output */
+void vioSetSignal (uint32_t mask, uint32_t signal) {
+  __atomic_store_n(&vioSignalOut, (vioSignalOut & ~mask) | (signal & mask), __ATOMIC_RELAXED);
+}
+
+/* Get signal input */
+uint32_t vioGetSignal (uint32_t mask) {
+  return (__atomic_load_n(&vioSignalIn, __ATOMIC_RELAXED) & mask);
+}
+
+/* Set value output */
+void vioSetValue (uint32_t id, int32_t value) {
+  if (id < VIO_VALUE_NUM) {
+    vioValue[id] = value;
+  }
+}
+
+/* Get value input */
+int32_t vioGetValue (uint32_t id) {
+  if (id < VIO_VALUE_NUM) {
+    return vioValue[id];
+  }
+  return 0;
+}
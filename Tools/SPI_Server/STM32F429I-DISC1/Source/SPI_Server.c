@@ -177,17 +177,17 @@ int32_t SPI_Server_Start (void) {
   // (maximum size is incremented by 4 bytes to ensure that buffer can be aligned to 4 bytes)
 
   ptr_spi_xfer_buf_rx_alloc = malloc(SPI_SERVER_BUF_SIZE + 4U);
-  if (((uint32_t)ptr_spi_xfer_buf_rx_alloc & 3U) != 0U) {
+  if (((uintptr_t)ptr_spi_xfer_buf_rx_alloc & 3U) != 0U) {
     // If allocated memory is not 4 byte aligned, use next 4 byte aligned address for ptr_tx_buf
-    ptr_spi_xfer_buf_rx = (uint8_t *)((((uint32_t)ptr_spi_xfer_buf_rx_alloc) + 3U) & (~3U));
+    ptr_spi_xfer_buf_rx = (uint8_t *)((((uintptr_t)ptr_spi_xfer_buf_rx_alloc) + 3U) & ~(uintptr_t)3U);
   } else {
     // If allocated memory is 4 byte aligned, use it directly
     ptr_spi_xfer_buf_rx = (uint8_t *)ptr_spi_xfer_buf_rx_alloc;
   }
   ptr_spi_xfer_buf_tx_alloc = malloc(SPI_SERVER_BUF_SIZE + 4U);
-  if (((uint32_t)ptr_spi_xfer_buf_tx_alloc & 3U) != 0U) {
+  if (((uintptr_t)ptr_spi_xfer_buf_tx_alloc & 3U) != 0U) {
     // If allocated memory is not 4 byte aligned, use next 4 byte aligned address for ptr_tx_buf
-    ptr_spi_xfer_buf_tx = (uint8_t *)((((uint32_t)ptr_spi_xfer_buf_tx_alloc) + 3U) & (~3U));
+    ptr_spi_xfer_buf_tx = (uint8_t *)((((uintptr_t)ptr_spi_xfer_buf_tx_alloc) + 3U) & ~(uintptr_t)3U);
   } else {
     // If allocated memory is 4 byte aligned, use it directly
     ptr_spi_xfer_buf_tx = (uint8_t *)ptr_spi_xfer_buf_tx_alloc;
@@ -1355,10 +1355,10 @@ static int32_t SPI_Cmd_Xfer (const char *cmd) {
   }
 
   if ((ret == EXIT_SUCCESS) && 
-     ((spi_com_config_xfer.mode    == ARM_SPI_MODE_SLAVE)     && 
+    (((spi_com_config_xfer.mode    == ARM_SPI_MODE_SLAVE)     && 
       (spi_com_config_xfer.ss_mode == ARM_SPI_SS_SLAVE_SW))   ||
      ((spi_com_config_xfer.mode    == ARM_SPI_MODE_MASTER)    &&
-      (spi_com_config_xfer.ss_mode == ARM_SPI_SS_MASTER_SW)))  {
+      (spi_com_config_xfer.ss_mode == ARM_SPI_SS_MASTER_SW)))) {
     ret = SPI_Com_SS(1U);
   }
 
@@ -1368,10 +1368,10 @@ static int32_t SPI_Cmd_Xfer (const char *cmd) {
   }
 
   if ((ret == EXIT_SUCCESS) && 
-     ((spi_com_config_xfer.mode    == ARM_SPI_MODE_SLAVE)     && 
+    (((spi_com_config_xfer.mode    == ARM_SPI_MODE_SLAVE)     && 
       (spi_com_config_xfer.ss_mode == ARM_SPI_SS_SLAVE_SW))   ||
-     ((spi_com_config_xfer.mode == ARM_SPI_MODE_MASTER)       &&
-      (spi_com_config_xfer.ss_mode == ARM_SPI_SS_MASTER_SW)))  {
+     ((spi_com_config_xfer.mode    == ARM_SPI_MODE_MASTER)    &&
+      (spi_com_config_xfer.ss_mode == ARM_SPI_SS_MASTER_SW)))) {
     ret = SPI_Com_SS(0U);
   }
 
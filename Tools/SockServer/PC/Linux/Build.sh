@@ -0,0 +1,4 @@
+#!/bin/sh
+cd Source
+gcc -O2 -Wall SockServer.c -I ../Include -o ../SockServer -lpthread -lm
+cd ..
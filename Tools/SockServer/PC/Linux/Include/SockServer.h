@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2019-2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     SockServer
+ * Title:       SockServer definitions (Linux)
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <stdint.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+// Definitions
+#define ESC                     0x1b            // Ascii code for ESC
+#define BUFF_SIZE               2000            // Size of buffers
+#define RX_SIZE                 65536           // Size of receive buffer of the event loop
+#define MAX_EVENTS              64              // Number of events handled per epoll_wait
+#define MAX_DGRAMS              64              // Number of datagrams per recvmmsg/sendmmsg batch
+#define MAX_BATCHES             4               // Number of datagram batches handled per event
+#define DGRAM_RCVBUF            (4*1024*1024)   // Receive buffer size of datagram sockets
+#define MAX_WORKERS             256             // Maximum number of worker threads
+
+// Bulk download (BULK command)
+#define BULK_BSIZE_MAX          65536           // Maximum block size
+#define BULK_WRITE              65536           // Maximum size of one write
+#define BULK_IOV                128             // Maximum number of I/O vectors of one write
+#define BULK_SENDFILE_MIN       8192            // Minimum block size sent with sendfile
+#define BULK_RUNS               95              // Number of fill characters (' ' to '~')
+
+// Service ports
+#define ECHO_PORT               7               // Echo port number
+#define DISCARD_PORT            9               // Discard port number
+#define CHARGEN_PORT            19              // Chargen port number
+#define ASSISTANT_PORT          5000            // Test Assistant port number
+#define TCP_REJECTED_PORT       5001            // Rejected connection server TCP port
+#define TCP_TIMEOUT_PORT        5002            // Non-responding server TCP port
+
+// Timing (in ms)
+#define CHARGEN_INTERVAL        100             // Stream chargen line interval
+#define CMD_TIMEOUT             2000            // Assistant command receive timeout
+#define CONNECT_TIMEOUT         5000            // Assistant connect timeout
+#define STATUS_INTERVAL         1000            // Console status update interval
+
+// Objects registered with epoll (first member of the object)
+#define OBJ_LISTEN              1               // Stream service listener
+#define OBJ_DGRAM               2               // Datagram service socket
+#define OBJ_CONN                3               // Stream connection
+#define OBJ_WAKE                4               // Stop request (eventfd)
+#define TIMER_TAG               1U              // Event data tag of a connection timer
+#define UDP_TAG                 2U              // Event data tag of a connection datagram socket
+#define OBJ_TAGS                3U              // Event data tag mask
+
+// Assistant transfer modes
+#define SEND_BLOCK              0               // SEND, RECV: one block per send
+#define SEND_BULK               1               // BULK: prebuilt pattern, large writes
+#define SEND_PACED              2               // PSEND: token bucket at the requested rate
+#define RECV_PACED              3               // PRECV: arrival rate per interval
+#define SEND_UDP                4               // SEND UDP: paced sequence-numbered datagrams
+#define RECV_UDP                5               // RECV UDP: datagram loss, reordering and jitter
+
+// Paced transfer (PSEND, PRECV commands)
+#define PACE_RATE_MAX           10000000        // Maximum rate in kbit/s
+#define PACE_BURST_MAX          1048576         // Maximum burst size in bytes
+#define PACE_TICK_MIN           100000          // Minimum token bucket period in ns
+#define METER_INTERVAL          100             // Default arrival rate interval in ms
+
+// UDP transfer (SEND UDP, RECV UDP commands)
+#define UDP_HDR_SIZE            12              // Datagram header: sequence, seconds, microseconds
+#define UDP_BSIZE_MAX           1472            // Maximum datagram size (one Ethernet frame)
+#define UDP_RATE_DEFAULT        1000            // Default send rate in kbit/s
+#define UDP_TICK                1000000         // Send period in ns (at least one datagram)
+#define UDP_LINGER              100             // Receive time after STOP in ms
+
+// Statistics (STATS command, CSV file)
+#define MAX_PEERS               256             // Number of devices (remote addresses) tracked
+#define SESS_NUM                256             // Closed connection records per worker
+#define CSV_INTERVAL            10000           // CSV file flush interval in ms
+
+// Event loop options
+#define LOOP_REUSEPORT          0x01            // Share the service ports with other workers
+#define LOOP_TIMEOUT            0x02            // Run the non-responding server
+
+// Per-worker counters (written by the owner thread only, read by the status output)
+#define STAT_ADD(var,n)         __atomic_store_n(&(var), (var) + (n), __ATOMIC_RELAXED)
+#define STAT_SET(var,val)       __atomic_store_n(&(var), (val), __ATOMIC_RELAXED)
+#define STAT_GET(var)           __atomic_load_n(&(var), __ATOMIC_RELAXED)
+
+// Per-device counters (written by all workers)
+#define STAT_INC(var,n)         __atomic_fetch_add(&(var), (n), __ATOMIC_RELAXED)
+
+// Services
+#define SRV_ECHO                0
+#define SRV_DISCARD             1
+#define SRV_CHARGEN             2
+#define SRV_ASSISTANT           3
+
+// Assistant states
+#define AS_CMD                  0               // Wait for the command
+#define AS_CONNECT_CLOSE        1               // Close control connection
+#define AS_CONNECT_DELAY        2               // Startup delay before connect
+#define AS_CONNECT_PENDING      3               // Non-blocking connect in progress
+#define AS_CONNECT_LINGER       4               // Text sent, wait before close
+#define AS_SEND_START           5               // Wait before sending
+#define AS_SEND                 6               // Send data blocks
+#define AS_RECV                 7               // Receive data until STOP
+#define AS_STAT                 8               // Send the statistics
+#define AS_DRAIN                9               // Wait for the client to close
+#define AS_UDP_LINGER           10              // Receive late datagrams after STOP
+
+// Service socket
+typedef struct {
+  uint8_t  obj;                         // OBJ_LISTEN or OBJ_DGRAM
+  uint8_t  service;                     // Service (SRV_xxx)
+  uint16_t port;                        // Port number
+  int32_t  fd;                          // Socket
+} SERVICE;
+
+// Per-device statistics (shared by the workers)
+typedef struct {
+  uint32_t addr;                        // IPv4 address (0 = free entry)
+  uint32_t conns;                       // Stream connections accepted
+  uint64_t rx_bytes;                    // Bytes received
+  uint64_t rx_pkts;                     // Datagrams and TCP segments received
+  uint64_t tx_bytes;                    // Bytes sent
+  uint64_t tx_pkts;                     // Datagrams and TCP segments sent
+  uint64_t time;                        // Duration of the closed connections [ms]
+  uint32_t retrans;                     // TCP segments retransmitted
+  uint32_t rtt;                         // TCP smoothed RTT of the last closed socket [us]
+  uint64_t rwnd;                        // TCP send time limited by the receive window [us]
+} PEER;
+
+// Connection statistics (written to the CSV file when closed)
+typedef struct {
+  struct sockaddr_in peer;              // Remote address
+  uint8_t  service;                     // Service (SRV_xxx)
+  uint64_t start;                       // Open time [ms since the epoch]
+  uint64_t time;                        // Duration [ms]
+  uint64_t rx_bytes;                    // Bytes received
+  uint64_t rx_pkts;                     // Datagrams and TCP segments received
+  uint64_t tx_bytes;                    // Bytes sent
+  uint64_t tx_pkts;                     // Datagrams and TCP segments sent
+  uint32_t retrans;                     // TCP segments retransmitted
+  uint32_t rtt;                         // TCP smoothed RTT [us]
+  uint32_t min_rtt;                     // TCP minimum RTT [us]
+  uint64_t rwnd;                        // TCP send time limited by the receive window [us]
+} SESSION;
+
+// Datagram batch
+typedef struct {
+  struct mmsghdr     msg[MAX_DGRAMS];   // Message headers (recvmmsg, sendmmsg)
+  struct iovec       iov[MAX_DGRAMS];   // Data of the messages
+  struct sockaddr_in sa [MAX_DGRAMS];   // Remote addresses
+  char               buf[MAX_DGRAMS][BUFF_SIZE];
+  char               ctl[MAX_DGRAMS][64];  // Control messages (receive timestamps)
+} DGRAM_BATCH;
+
+// Stream connection
+typedef struct conn {
+  uint8_t  obj;                         // OBJ_CONN
+  uint8_t  service;                     // Service (SRV_xxx)
+  uint8_t  state;                       // Assistant state (AS_xxx)
+  char     setchar;                     // Chargen start or block fill character
+  uint8_t  mode;                        // Assistant transfer mode (SEND_xxx, RECV_PACED)
+  int32_t  fd;                          // Socket
+  int32_t  tfd;                         // Timer (-1 = none)
+  int32_t  ufd;                         // Assistant datagram socket (-1 = none)
+  uint32_t events;                      // Events registered for the socket
+  struct sockaddr_in peer;              // Remote address (assistant: connect address)
+  uint32_t bsize;                       // Assistant block size
+  uint32_t blk;                         // Assistant block number
+  uint32_t boffs;                       // Assistant offset in the current block (BULK)
+  uint64_t cnt;                         // Assistant byte count (STAT)
+  uint32_t stop;                        // Assistant STOP match length
+  uint64_t deadline;                    // Assistant send end time [ns]
+  uint32_t rate;                        // Paced send rate [kbit/s]
+  uint32_t burst;                       // Paced send burst size [bytes]
+  double   tokens;                      // Paced send token bucket [bytes]
+  uint64_t tick;                        // Paced send period [ns]
+  uint64_t last;                        // Paced send bucket update or interval start time [ns]
+  uint64_t win_bytes;                   // Paced receive bytes in the current interval
+  uint32_t win_ms;                      // Paced receive interval or paced send duration [ms]
+  uint32_t win_num;                     // Paced receive number of complete intervals
+  double   win_sum;                     // Paced receive sum of interval rates [kbit/s]
+  double   win_sq;                      // Paced receive sum of squared interval rates
+  double   win_min;                     // Paced receive minimum interval rate [kbit/s]
+  double   win_max;                     // Paced receive maximum interval rate [kbit/s]
+  uint32_t udp_num;                     // UDP datagrams sent or received
+  uint32_t udp_sent;                    // UDP datagrams sent by the client (STOP, 0 = unknown)
+  uint32_t udp_next;                    // UDP next expected sequence number
+  uint32_t udp_reorder;                 // UDP datagrams received out of order
+  int64_t  udp_transit;                 // UDP transit time of the previous datagram [ns]
+  double   udp_jitter;                  // UDP inter-arrival jitter [ns] (RFC 3550)
+  uint32_t len;                         // Length of pending transmit data
+  uint32_t offs;                        // Offset of pending transmit data
+  uint64_t start;                       // Open time [ns]
+  PEER    *host;                        // Statistics of the device (NULL = table full)
+  SESSION  ses;                         // Statistics of the connection
+  struct conn *next;                    // List of connections
+  struct conn *prev;
+  char     buf[BUFF_SIZE];              // Transmit buffer
+} CONN;
+
+// Event loop (one per worker thread)
+typedef struct {
+  uint32_t id;                          // Worker number
+  int32_t  epfd;                        // Epoll instance
+  uint8_t  wake_obj;                    // OBJ_WAKE
+  int32_t  wake_fd;                     // Stop request event
+  int32_t  stop;                        // Stop request
+  uint32_t seed;                        // Random generator state
+  struct in_addr addr;                  // Bind address
+  SERVICE  srv[8];                      // Service sockets
+  uint32_t srv_num;                     // Number of service sockets
+  int32_t  tmo_fd[3];                   // Timeout server listener and queue fillers
+  CONN    *conn;                        // Open connections
+  CONN    *dead;                        // Closed connections (freed after the event batch)
+  uint32_t conn_num;                    // Number of open connections
+  char     setchar;                     // Datagram chargen start character
+  uint64_t remote;                      // Remote IP address and port (port << 32)
+  uint64_t rx_cnt;                      // Receive count
+  uint64_t tx_cnt;                      // Transmit count
+  uint64_t rx_last;                     // Receive count at the last status output
+  uint32_t sess_head;                   // Closed connection records written
+  uint32_t sess_tail;                   // Closed connection records read (CSV file)
+  SESSION  sess[SESS_NUM];              // Closed connection records
+  char     rx_buf[RX_SIZE];             // Receive buffer
+  DGRAM_BATCH dgram;                    // Datagram batch
+} LOOP;
+
+// Socket Server event loop
+extern int32_t LoopInit   (LOOP *loop, uint32_t id, struct in_addr addr, uint32_t options);
+extern void    LoopRun    (LOOP *loop);
+extern void    LoopStop   (LOOP *loop);
+extern void    LoopUninit (LOOP *loop);
@@ -0,0 +1,1993 @@
+/*
+ * Copyright (c) 2019-2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     SockServer
+ * Title:       SockServer Linux application
+ * Purpose:     Implements ECHO, DISCARD and CHARGEN services
+ *               - Echo Protocol service                [RFC 862]
+ *               - Discard Protocol service             [RFC 863]
+ *               - Character Generator Protocol service [RFC 864]
+ *
+ *              All services and connections of a worker run in one thread on
+ *              an epoll event loop with non-blocking sockets and timerfd
+ *              timers. Several workers share the service ports with
+ *              SO_REUSEPORT, the kernel distributes the connections.
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#define _GNU_SOURCE
+
+#define VERSION     "v1.1"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <ifaddrs.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <linux/tcp.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/sendfile.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/timerfd.h>
+#include "SockServer.h"
+
+// Workers
+static LOOP    *loop_tab;
+static uint32_t loop_num;
+
+// Bulk download pattern (one run of BULK_BSIZE_MAX bytes per fill character)
+static char    *bulk_pat;
+static int32_t  bulk_fd = -1;
+
+// Per-device statistics and CSV file (-s option)
+static PEER     peer_tab[MAX_PEERS];
+static FILE    *csv_file;
+
+// Generate character array for transmit
+static char gen_char (char *buf, char setchar, uint32_t len) {
+  uint32_t i;
+  char ch;
+
+  if ((++setchar < 0x21) || (setchar == 0x7f)) {
+    setchar = 0x21;
+  }
+  for (i = 0, ch = setchar; i < (len-2); i++) {
+    buf[i] = ch;
+    if (++ch == 0x7f) ch = 0x21;
+  }
+  buf[i]   = '\n';
+  buf[i+1] = '\r';
+  return (setchar);
+}
+
+// Get monotonic time in ns
+static uint64_t time_ns (void) {
+  struct timespec ts;
+
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return ((uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec);
+}
+
+// Set remote address of the status output
+static void set_remote (LOOP *loop, const struct sockaddr_in *sa) {
+  STAT_SET (loop->remote, ((uint64_t)sa->sin_port << 32) | sa->sin_addr.s_addr);
+}
+
+// Get the statistics of a device
+// (insert: add a free entry when not found, return: NULL = not found or table full)
+static PEER *peer_get (uint32_t addr, uint32_t insert) {
+  uint32_t i,k,cur;
+
+  i = (ntohl (addr) * 2654435761U) % MAX_PEERS;
+  for (k = 0U; k < MAX_PEERS; k++, i = (i + 1U) % MAX_PEERS) {
+    cur = __atomic_load_n (&peer_tab[i].addr, __ATOMIC_ACQUIRE);
+    if (cur == 0U) {
+      if (!insert) break;
+      // Claim the free entry, another worker may claim it first
+      if (__atomic_compare_exchange_n (&peer_tab[i].addr, &cur, addr, 0,
+                                       __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+        return (&peer_tab[i]);
+      }
+    }
+    if (cur == addr) {
+      return (&peer_tab[i]);
+    }
+  }
+  return (NULL);
+}
+
+// Get the statistics of the sender of a datagram (p: device of the previous datagram)
+static PEER *peer_dgram (PEER *p, const struct sockaddr_in *sa) {
+  if ((p != NULL) && (p->addr == sa->sin_addr.s_addr)) {
+    return (p);
+  }
+  return (peer_get (sa->sin_addr.s_addr, 1U));
+}
+
+// Count received data (c: connection, NULL = datagram service, pkts: datagrams)
+static void count_rx (LOOP *loop, CONN *c, int32_t n, uint32_t pkts) {
+  STAT_ADD (loop->rx_cnt, (uint32_t)n);
+  if (c != NULL) {
+    c->ses.rx_bytes += (uint32_t)n;
+    c->ses.rx_pkts  += pkts;
+    if (c->host != NULL) {
+      STAT_INC (c->host->rx_bytes, (uint32_t)n);
+      if (pkts != 0U) STAT_INC (c->host->rx_pkts, pkts);
+    }
+  }
+}
+
+// Count transmitted data (c: connection, NULL = datagram service, pkts: datagrams)
+static void count_tx (LOOP *loop, CONN *c, int32_t n, uint32_t pkts) {
+  STAT_ADD (loop->tx_cnt, (uint32_t)n);
+  if (c != NULL) {
+    c->ses.tx_bytes += (uint32_t)n;
+    c->ses.tx_pkts  += pkts;
+    if (c->host != NULL) {
+      STAT_INC (c->host->tx_bytes, (uint32_t)n);
+      if (pkts != 0U) STAT_INC (c->host->tx_pkts, pkts);
+    }
+  }
+}
+
+// Add the TCP counters of a connection socket before it is closed
+// (segments, retransmissions and RTT from TCP_INFO, fails for UDP sockets)
+static void count_tcp_info (CONN *c) {
+  struct tcp_info ti;
+  socklen_t len = sizeof(ti);
+
+  memset (&ti, 0, sizeof(ti));
+  if (getsockopt (c->fd, IPPROTO_TCP, TCP_INFO, &ti, &len) != 0) {
+    return;
+  }
+  c->ses.rx_pkts += ti.tcpi_segs_in;
+  c->ses.tx_pkts += ti.tcpi_segs_out;
+  c->ses.retrans += ti.tcpi_total_retrans;
+  c->ses.rtt      = ti.tcpi_rtt;
+  c->ses.min_rtt  = ti.tcpi_min_rtt;
+  c->ses.rwnd    += ti.tcpi_rwnd_limited;
+  if (c->host != NULL) {
+    STAT_INC (c->host->rx_pkts, ti.tcpi_segs_in);
+    STAT_INC (c->host->tx_pkts, ti.tcpi_segs_out);
+    STAT_INC (c->host->retrans, ti.tcpi_total_retrans);
+    STAT_INC (c->host->rwnd, ti.tcpi_rwnd_limited);
+    STAT_SET (c->host->rtt, ti.tcpi_rtt);
+  }
+}
+
+// Record the statistics of a closed connection (read by the CSV file output)
+static void count_session (LOOP *loop, CONN *c) {
+  uint32_t i = loop->sess_head;
+
+  c->ses.time = (time_ns () - c->start) / 1000000U;
+  if (c->host != NULL) {
+    STAT_INC (c->host->time, c->ses.time);
+  }
+  loop->sess[i % SESS_NUM] = c->ses;
+  __atomic_store_n (&loop->sess_head, i + 1U, __ATOMIC_RELEASE);
+}
+
+// Arm a timer in ns (interval 0 = one-shot, ns 0 = disarm)
+static int32_t timer_set_ns (int32_t fd, uint64_t ns, uint64_t interval) {
+  struct itimerspec its;
+
+  its.it_value.tv_sec     = (time_t)(ns / 1000000000U);
+  its.it_value.tv_nsec    = (long)(ns % 1000000000U);
+  its.it_interval.tv_sec  = (time_t)(interval / 1000000000U);
+  its.it_interval.tv_nsec = (long)(interval % 1000000000U);
+  return (timerfd_settime (fd, 0, &its, NULL));
+}
+
+// Arm a timer (interval 0 = one-shot, ms 0 = disarm)
+static int32_t timer_set (int32_t fd, uint32_t ms, uint32_t interval) {
+  return (timer_set_ns (fd, (uint64_t)ms * 1000000U, (uint64_t)interval * 1000000U));
+}
+
+// Open a service socket
+static int32_t open_service (LOOP *loop, int32_t type, uint8_t service, uint16_t port, uint32_t options) {
+  SERVICE *srv = &loop->srv[loop->srv_num];
+  struct sockaddr_in sa;
+  struct epoll_event ev;
+  int32_t fd,sz,en = 1;
+
+  fd = socket (PF_INET, type | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  if (fd < 0) {
+    return (-1);
+  }
+  setsockopt (fd, SOL_SOCKET, SO_REUSEADDR, &en, sizeof(en));
+  if (options & LOOP_REUSEPORT) {
+    setsockopt (fd, SOL_SOCKET, SO_REUSEPORT, &en, sizeof(en));
+  }
+  if (type == SOCK_DGRAM) {
+    // Absorb bursts of datagrams (above net.core.rmem_max when running as root)
+    sz = DGRAM_RCVBUF;
+    if (setsockopt (fd, SOL_SOCKET, SO_RCVBUFFORCE, &sz, sizeof(sz)) < 0) {
+      setsockopt (fd, SOL_SOCKET, SO_RCVBUF, &sz, sizeof(sz));
+    }
+  }
+
+  sa.sin_family = AF_INET;
+  sa.sin_addr   = loop->addr;
+  sa.sin_port   = htons (port);
+  if ((bind (fd, (struct sockaddr *)&sa, sizeof(sa)) < 0) ||
+      ((type == SOCK_STREAM) && (listen (fd, SOMAXCONN) < 0))) {
+    printf ("Failed to open %s port %u: %s\n", (type == SOCK_STREAM) ? "TCP" : "UDP", port, strerror(errno));
+    close (fd);
+    return (-1);
+  }
+
+  srv->obj     = (type == SOCK_STREAM) ? OBJ_LISTEN : OBJ_DGRAM;
+  srv->service = service;
+  srv->port    = port;
+  srv->fd      = fd;
+
+  ev.events   = EPOLLIN;
+  ev.data.ptr = srv;
+  epoll_ctl (loop->epfd, EPOLL_CTL_ADD, fd, &ev);
+  loop->srv_num++;
+  return (0);
+}
+
+// Open non-responding server
+// (listener with a full accept queue, the kernel drops further connection requests)
+static int32_t open_timeout (LOOP *loop) {
+  struct sockaddr_in sa;
+  int32_t i,fd,en = 1;
+
+  fd = socket (PF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (fd < 0) {
+    return (-1);
+  }
+  setsockopt (fd, SOL_SOCKET, SO_REUSEADDR, &en, sizeof(en));
+
+  sa.sin_family = AF_INET;
+  sa.sin_addr   = loop->addr;
+  sa.sin_port   = htons (TCP_TIMEOUT_PORT);
+  if ((bind (fd, (struct sockaddr *)&sa, sizeof(sa)) < 0) || (listen (fd, 0) < 0)) {
+    printf ("Failed to open TCP port %u: %s\n", TCP_TIMEOUT_PORT, strerror(errno));
+    close (fd);
+    return (-1);
+  }
+  loop->tmo_fd[0] = fd;
+
+  // Fill the accept queue with own connections that are never accepted
+  if (sa.sin_addr.s_addr == htonl (INADDR_ANY)) {
+    sa.sin_addr.s_addr = htonl (INADDR_LOOPBACK);
+  }
+  for (i = 1; i < 3; i++) {
+    loop->tmo_fd[i] = socket (PF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (loop->tmo_fd[i] >= 0) {
+      connect (loop->tmo_fd[i], (struct sockaddr *)&sa, sizeof(sa));
+    }
+  }
+  return (0);
+}
+
+// Prepare datagram batch entries for receiving
+static void dgram_prepare (DGRAM_BATCH *b, uint32_t num) {
+  uint32_t i;
+
+  for (i = 0U; i < num; i++) {
+    b->iov[i].iov_base               = b->buf[i];
+    b->iov[i].iov_len                = BUFF_SIZE;
+    b->msg[i].msg_hdr.msg_name       = &b->sa[i];
+    b->msg[i].msg_hdr.msg_namelen    = sizeof(b->sa[i]);
+    b->msg[i].msg_hdr.msg_iov        = &b->iov[i];
+    b->msg[i].msg_hdr.msg_iovlen     = 1;
+    b->msg[i].msg_hdr.msg_control    = b->ctl[i];
+    b->msg[i].msg_hdr.msg_controllen = sizeof(b->ctl[i]);
+    b->msg[i].msg_hdr.msg_flags      = 0;
+    b->msg[i].msg_len                = 0U;
+  }
+}
+
+// Register socket events of a connection
+static void conn_watch (LOOP *loop, CONN *c, uint32_t events) {
+  struct epoll_event ev;
+
+  if (c->events == events) return;
+  ev.events   = events;
+  ev.data.ptr = c;
+  epoll_ctl (loop->epfd, EPOLL_CTL_MOD, c->fd, &ev);
+  c->events = events;
+}
+
+// Start connection timer in ns
+static void conn_timer_ns (LOOP *loop, CONN *c, uint64_t ns, uint64_t interval) {
+  struct epoll_event ev;
+
+  if (c->tfd < 0) {
+    c->tfd = timerfd_create (CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (c->tfd < 0) return;
+    ev.events   = EPOLLIN;
+    ev.data.ptr = (void *)((uintptr_t)c | TIMER_TAG);
+    epoll_ctl (loop->epfd, EPOLL_CTL_ADD, c->tfd, &ev);
+  }
+  timer_set_ns (c->tfd, ns, interval);
+}
+
+// Start connection timer
+static void conn_timer (LOOP *loop, CONN *c, uint32_t ms, uint32_t interval) {
+  conn_timer_ns (loop, c, (uint64_t)ms * 1000000U, (uint64_t)interval * 1000000U);
+}
+
+// Create a connection
+static CONN *conn_open (LOOP *loop, int32_t fd, uint8_t service, uint32_t events) {
+  struct epoll_event ev;
+  CONN *c;
+
+  c = calloc (1, sizeof(CONN));
+  if (c == NULL) {
+    return (NULL);
+  }
+  c->obj     = OBJ_CONN;
+  c->service = service;
+  c->setchar = '@';
+  c->fd      = fd;
+  c->tfd     = -1;
+  c->ufd     = -1;
+  c->events  = events;
+  c->start   = time_ns ();
+
+  ev.events   = events;
+  ev.data.ptr = c;
+  if ((fd >= 0) && (epoll_ctl (loop->epfd, EPOLL_CTL_ADD, fd, &ev) < 0)) {
+    free (c);
+    return (NULL);
+  }
+
+  c->next = loop->conn;
+  c->prev = NULL;
+  if (c->next != NULL) c->next->prev = c;
+  loop->conn = c;
+  STAT_SET (loop->conn_num, loop->conn_num + 1U);
+  return (c);
+}
+
+// Close connection socket
+static void conn_close_sock (LOOP *loop, CONN *c) {
+  if (c->fd >= 0) {
+    count_tcp_info (c);
+    epoll_ctl (loop->epfd, EPOLL_CTL_DEL, c->fd, NULL);
+    close (c->fd);
+    c->fd     = -1;
+    c->events = 0U;
+  }
+}
+
+// Close a connection
+static void conn_close (LOOP *loop, CONN *c) {
+  conn_close_sock (loop, c);
+  if (c->tfd >= 0) {
+    epoll_ctl (loop->epfd, EPOLL_CTL_DEL, c->tfd, NULL);
+    close (c->tfd);
+  }
+  if (c->ufd >= 0) {
+    epoll_ctl (loop->epfd, EPOLL_CTL_DEL, c->ufd, NULL);
+    close (c->ufd);
+  }
+  if (c->prev != NULL) c->prev->next = c->next;
+  else                 loop->conn    = c->next;
+  if (c->next != NULL) c->next->prev = c->prev;
+  STAT_SET (loop->conn_num, loop->conn_num - 1U);
+  count_session (loop, c);
+
+  // Events of this batch may still refer to the connection
+  c->obj     = 0U;
+  c->next    = loop->dead;
+  loop->dead = c;
+}
+
+// Send pending data of a connection
+// (return: 1 = all sent, 0 = socket buffer full, -1 = error)
+static int32_t conn_flush (LOOP *loop, CONN *c) {
+  ssize_t n;
+
+  while (c->offs < c->len) {
+    n = send (c->fd, c->buf + c->offs, c->len - c->offs, MSG_NOSIGNAL);
+    if (n < 0) {
+      if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+        return (0);
+      }
+      if (errno == EINTR) continue;
+      return (-1);
+    }
+    count_tx (loop, c, (int32_t)n, 0U);
+    if (c->state == AS_SEND) {
+      c->cnt += (uint64_t)n;
+    }
+    c->offs += (uint32_t)n;
+  }
+  return (1);
+}
+
+// Read data into the loop receive buffer
+// (return: number of bytes, 0 = closed by the peer, -1 = no data, -2 = error)
+static int32_t conn_read (LOOP *loop, CONN *c, uint32_t len) {
+  ssize_t n;
+
+  do {
+    n = recv (c->fd, loop->rx_buf, len, 0);
+  } while ((n < 0) && (errno == EINTR));
+  if (n < 0) {
+    return (((errno == EAGAIN) || (errno == EWOULDBLOCK)) ? -1 : -2);
+  }
+  if (n > 0) {
+    count_rx (loop, c, (int32_t)n, 0U);
+  }
+  return ((int32_t)n);
+}
+
+// Send the reply in the transmit buffer and wait for the client to close the connection
+static void assistant_reply (LOOP *loop, CONN *c) {
+  int32_t rc;
+
+  c->state = AS_STAT;
+  if (c->tfd >= 0) {
+    // Stop pacing, interval or command timer
+    timer_set (c->tfd, 0U, 0U);
+  }
+  c->offs  = 0U;
+  rc = conn_flush (loop, c);
+  if (rc < 0) {
+    conn_close (loop, c);
+    return;
+  }
+  if (rc == 0) {
+    conn_watch (loop, c, EPOLLOUT);
+    return;
+  }
+  c->state = AS_DRAIN;
+  conn_watch (loop, c, EPOLLIN);
+}
+
+// Send the statistics and wait for the client to close the connection
+static void assistant_stat (LOOP *loop, CONN *c) {
+  if (c->mode == SEND_BLOCK) {
+    // 32-bit count, as parsed by the clients
+    c->len = (uint32_t)sprintf (c->buf, "STAT %u bytes.", (uint32_t)c->cnt);
+  }
+  else if (c->mode == SEND_UDP) {
+    c->len = (uint32_t)sprintf (c->buf, "STAT %llu bytes, %u datagrams.",
+                                (unsigned long long)c->cnt, c->udp_num);
+  }
+  else if (c->mode == RECV_UDP) {
+    // Loss against the count sent by the client, or the highest sequence number
+    uint32_t exp  = (c->udp_sent != 0U) ? c->udp_sent : c->udp_next;
+    uint32_t lost = (exp > c->udp_num) ? exp - c->udp_num : 0U;
+    c->len = (uint32_t)sprintf (c->buf, "STAT %llu bytes, %u datagrams, %u lost, %u reordered, jitter %.1f us.",
+                                (unsigned long long)c->cnt, c->udp_num, lost, c->udp_reorder,
+                                c->udp_jitter / 1000.0);
+  }
+  else if (c->mode == SEND_PACED) {
+    // Achieved rate, below the requested rate when the link is slower
+    c->len = (uint32_t)sprintf (c->buf, "STAT %llu bytes, rate %.0f of %u kbit/s.",
+                                (unsigned long long)c->cnt, (double)c->cnt * 8.0 / c->win_ms, c->rate);
+  }
+  else if (c->mode == RECV_PACED) {
+    // Arrival rate stability over the complete intervals
+    double avg = 0.0, dev = 0.0;
+    if (c->win_num != 0U) {
+      avg = c->win_sum / c->win_num;
+      dev = c->win_sq / c->win_num - avg * avg;
+      dev = (dev > 0.0) ? sqrt (dev) : 0.0;
+    }
+    else {
+      c->win_min = 0.0;
+    }
+    c->len = (uint32_t)snprintf (c->buf, sizeof(c->buf),
+             "STAT %llu bytes, %u intervals of %u ms, rate avg %.0f min %.0f max %.0f stddev %.0f kbit/s.",
+             (unsigned long long)c->cnt, c->win_num, c->win_ms, avg, c->win_min, c->win_max, dev);
+  }
+  else {
+    c->len = (uint32_t)sprintf (c->buf, "STAT %llu bytes.", (unsigned long long)c->cnt);
+  }
+  assistant_reply (loop, c);
+}
+
+// Send data blocks until the socket buffer is full or the test time expires
+static void assistant_send (LOOP *loop, CONN *c) {
+  int32_t rc,n;
+
+  for (;;) {
+    rc = conn_flush (loop, c);
+    if (rc < 0) {
+      conn_close (loop, c);
+      return;
+    }
+    if (rc == 0) {
+      conn_watch (loop, c, EPOLLOUT);
+      return;
+    }
+    if (time_ns () >= c->deadline) {
+      // Inform the client of the number of bytes sent
+      assistant_stat (loop, c);
+      return;
+    }
+    n = sprintf (c->buf,"Block[%u] ",++c->blk);
+    memset (c->buf+n, c->setchar, c->bsize-(uint32_t)n);
+    if (++c->setchar > '~') c->setchar = ' ';
+    c->len  = c->bsize;
+    c->offs = 0U;
+  }
+}
+
+// Get offset of the fill character run in the bulk pattern
+static uint32_t bulk_run (char ch) {
+  return ((uint32_t)(ch - ' ') * BULK_BSIZE_MAX);
+}
+
+// Write the next bulk data (up to limit bytes, at most BULK_WRITE)
+// (return: bytes written, -1 = socket buffer full, -2 = error)
+static int32_t bulk_write (CONN *c, uint32_t limit) {
+  struct iovec iov[BULK_IOV];
+  uint32_t blk,offs,len,h,k,num,total;
+  char *hdr,ch;
+  off_t foffs;
+  ssize_t n;
+
+  if ((bulk_fd >= 0) && (c->bsize >= BULK_SENDFILE_MIN)) {
+    // Large blocks: header with send, fill from the pattern memfd with sendfile
+    h = (uint32_t)sprintf (c->buf, "Block[%u] ", c->blk);
+    if (c->boffs < h) {
+      len = h - c->boffs;
+      if (len > limit) len = limit;
+      n = send (c->fd, c->buf + c->boffs, len, MSG_MORE | MSG_NOSIGNAL);
+    }
+    else {
+      len = c->bsize - c->boffs;
+      if (len > limit) len = limit;
+      foffs = (off_t)(bulk_run (c->setchar) + (c->boffs - h));
+      n = sendfile (c->fd, bulk_fd, &foffs, len);
+    }
+  }
+  else {
+    // Small blocks: headers and pattern runs of several blocks in one writev
+    blk   = c->blk;
+    offs  = c->boffs;
+    ch    = c->setchar;
+    hdr   = c->buf;
+    total = 0U;
+    if (limit > BULK_WRITE) limit = BULK_WRITE;
+    for (num = 0U; (num + 2U <= BULK_IOV) && (total < limit); ) {
+      h = (uint32_t)sprintf (hdr, "Block[%u] ", blk);
+      if (offs < h) {
+        len = h - offs;
+        if (len > limit - total) len = limit - total;
+        iov[num].iov_base = hdr + offs;
+        iov[num].iov_len  = len;
+        total += len;
+        num++;
+        offs += len;
+        if (offs < h) break;
+      }
+      len = c->bsize - offs;
+      if (len > limit - total) len = limit - total;
+      iov[num].iov_base = bulk_pat + bulk_run (ch) + (offs - h);
+      iov[num].iov_len  = len;
+      total += len;
+      num++;
+      hdr += h;
+      blk++;
+      offs = 0U;
+      if (++ch > '~') ch = ' ';
+    }
+    n = writev (c->fd, iov, (int)num);
+  }
+  if (n < 0) {
+    if ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR)) {
+      return (-1);
+    }
+    return (-2);
+  }
+
+  // Advance the position in the block stream
+  k = c->boffs + (uint32_t)n;
+  while (k >= c->bsize) {
+    k -= c->bsize;
+    c->blk++;
+    if (++c->setchar > '~') c->setchar = ' ';
+  }
+  c->boffs = k;
+  return ((int32_t)n);
+}
+
+// Send bulk data until the socket buffer is full or the test time expires
+static void assistant_bulk (LOOP *loop, CONN *c) {
+  uint32_t limit;
+  int32_t n;
+
+  for (;;) {
+    limit = BULK_WRITE;
+    if (time_ns () >= c->deadline) {
+      if (c->boffs == 0U) {
+        // Inform the client of the number of bytes sent
+        assistant_stat (loop, c);
+        return;
+      }
+      // Complete the current block
+      limit = c->bsize - c->boffs;
+    }
+    n = bulk_write (c, limit);
+    if (n == -1) {
+      conn_watch (loop, c, EPOLLOUT);
+      return;
+    }
+    if (n < 0) {
+      conn_close (loop, c);
+      return;
+    }
+    count_tx (loop, c, n, 0U);
+    c->cnt += (uint32_t)n;
+  }
+}
+
+// Send paced data (token bucket, called on each pacing timer tick)
+static void assistant_paced (LOOP *loop, CONN *c) {
+  uint64_t now = time_ns ();
+  double   max = (double)c->burst;
+  uint32_t limit;
+  int32_t  n;
+
+  // Refill the bucket at the requested rate, up to one burst
+  c->tokens += (double)(now - c->last) * c->rate / 8000000.0;
+  if (c->tokens > max) c->tokens = max;
+  c->last = now;
+
+  for (;;) {
+    if (now >= c->deadline) {
+      if (c->boffs == 0U) {
+        // Inform the client of the number of bytes sent
+        assistant_stat (loop, c);
+        return;
+      }
+      // Complete the current block
+      limit = c->bsize - c->boffs;
+    }
+    else {
+      if (c->tokens < 1.0) return;
+      limit = (uint32_t)c->tokens;
+    }
+    n = bulk_write (c, limit);
+    if (n == -1) {
+      // Socket buffer full, continue on the next tick
+      return;
+    }
+    if (n < 0) {
+      conn_close (loop, c);
+      return;
+    }
+    count_tx (loop, c, n, 0U);
+    c->cnt    += (uint32_t)n;
+    c->tokens -= n;
+  }
+}
+
+// Close the arrival rate interval of the paced receive
+static void assistant_meter (CONN *c, uint64_t now) {
+  double rate;
+
+  if (now > c->last) {
+    rate = (double)c->win_bytes * 8000000.0 / (double)(now - c->last);
+    if ((c->win_num == 0U) || (rate < c->win_min)) c->win_min = rate;
+    if ((c->win_num == 0U) || (rate > c->win_max)) c->win_max = rate;
+    c->win_sum += rate;
+    c->win_sq  += rate * rate;
+    c->win_num++;
+  }
+  c->win_bytes = 0U;
+  c->last      = now;
+}
+
+// Send sequence-numbered datagrams (token bucket, called on each send timer tick)
+static void assistant_udp_send (LOOP *loop, CONN *c) {
+  DGRAM_BATCH *b = &loop->dgram;
+  uint64_t now = time_ns ();
+  double   max = (double)c->burst;
+  struct timespec ts;
+  uint32_t i,num,cnt,val[3];
+  int32_t  n;
+
+  if (now >= c->deadline) {
+    // Inform the client of the number of datagrams sent
+    close (c->ufd);
+    c->ufd = -1;
+    assistant_stat (loop, c);
+    return;
+  }
+
+  // Refill the bucket at the requested rate, up to one burst
+  c->tokens += (double)(now - c->last) * c->rate / 8000000.0;
+  if (c->tokens > max) c->tokens = max;
+  c->last = now;
+
+  num = (uint32_t)(c->tokens / c->bsize);
+  if (num > MAX_DGRAMS) num = MAX_DGRAMS;
+  if (num == 0U) return;
+
+  // Header: sequence number, send time (wall clock s, us), network byte order
+  clock_gettime (CLOCK_REALTIME, &ts);
+  val[1] = htonl ((uint32_t)ts.tv_sec);
+  val[2] = htonl ((uint32_t)(ts.tv_nsec / 1000));
+  for (i = 0U; i < num; i++) {
+    val[0] = htonl (c->udp_num + i);
+    memcpy (b->buf[i], val, UDP_HDR_SIZE);
+    memcpy (b->buf[i] + UDP_HDR_SIZE, bulk_pat + bulk_run ('a'), c->bsize - UDP_HDR_SIZE);
+    b->iov[i].iov_len                = c->bsize;
+    b->msg[i].msg_hdr.msg_name       = NULL;
+    b->msg[i].msg_hdr.msg_namelen    = 0;
+    b->msg[i].msg_hdr.msg_control    = NULL;
+    b->msg[i].msg_hdr.msg_controllen = 0;
+  }
+  n = sendmmsg (c->ufd, b->msg, num, MSG_DONTWAIT);
+  dgram_prepare (b, num);
+  if (n < 0) {
+    if ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == ENOBUFS)) return;
+    if (errno == ECONNREFUSED) return;
+    conn_close (loop, c);
+    return;
+  }
+  cnt = (uint32_t)n * c->bsize;
+  count_tx (loop, c, (int32_t)cnt, (uint32_t)n);
+  c->cnt      += cnt;
+  c->udp_num  += (uint32_t)n;
+  c->tokens   -= cnt;
+}
+
+// Receive sequence-numbered datagrams (loss, reordering and jitter)
+static void assistant_udp_recv (LOOP *loop, CONN *c) {
+  DGRAM_BATCH *b = &loop->dgram;
+  struct cmsghdr *cm;
+  struct timespec ts;
+  uint32_t i,k,cnt,val[3];
+  int64_t  rx,transit,d;
+  int32_t  n;
+
+  for (k = 0U; k < MAX_BATCHES; k++) {
+    n = recvmmsg (c->ufd, b->msg, MAX_DGRAMS, MSG_DONTWAIT, NULL);
+    if (n <= 0) {
+      return;
+    }
+    for (i = 0U, cnt = 0U; i < (uint32_t)n; i++) {
+      cnt += b->msg[i].msg_len;
+      if (b->msg[i].msg_len < UDP_HDR_SIZE) continue;
+
+      // Arrival time: kernel receive timestamp (wall clock), or now when not available
+      rx = -1;
+      for (cm = CMSG_FIRSTHDR (&b->msg[i].msg_hdr); cm != NULL; cm = CMSG_NXTHDR (&b->msg[i].msg_hdr, cm)) {
+        if ((cm->cmsg_level == SOL_SOCKET) && (cm->cmsg_type == SCM_TIMESTAMPNS)) {
+          memcpy (&ts, CMSG_DATA (cm), sizeof(ts));
+          rx = (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+        }
+      }
+      if (rx < 0) {
+        clock_gettime (CLOCK_REALTIME, &ts);
+        rx = (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+      }
+
+      memcpy (val, b->buf[i], UDP_HDR_SIZE);
+      val[0] = ntohl (val[0]);
+      if (val[0] < c->udp_next) {
+        c->udp_reorder++;
+      }
+      else {
+        c->udp_next = val[0] + 1U;
+      }
+
+      // Inter-arrival jitter (RFC 3550): J += (|D| - J) / 16
+      transit = rx - ((int64_t)ntohl (val[1]) * 1000000000 + (int64_t)ntohl (val[2]) * 1000);
+      if (c->udp_num != 0U) {
+        d = transit - c->udp_transit;
+        if (d < 0) d = -d;
+        c->udp_jitter += ((double)d - c->udp_jitter) / 16.0;
+      }
+      c->udp_transit = transit;
+      c->udp_num++;
+    }
+    count_rx (loop, c, (int32_t)cnt, (uint32_t)n);
+    set_remote (loop, &b->sa[n-1]);
+    c->cnt += cnt;
+    dgram_prepare (b, (uint32_t)n);
+    if (n < MAX_DGRAMS) {
+      return;
+    }
+  }
+}
+
+// Open the datagram socket of a UDP transfer
+// (peer: connect address, NULL = receive on an ephemeral port)
+static int32_t assistant_udp_open (LOOP *loop, CONN *c, const struct sockaddr_in *peer) {
+  struct epoll_event ev;
+  struct sockaddr_in sa;
+  int32_t sz,en = 1;
+
+  c->ufd = socket (PF_INET, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  if (c->ufd < 0) {
+    return (-1);
+  }
+  memset (&sa, 0, sizeof(sa));
+  sa.sin_family = AF_INET;
+  sa.sin_addr   = loop->addr;
+  if (bind (c->ufd, (struct sockaddr *)&sa, sizeof(sa)) < 0) {
+    return (-1);
+  }
+  if (peer != NULL) {
+    return (connect (c->ufd, (const struct sockaddr *)peer, sizeof(*peer)));
+  }
+  setsockopt (c->ufd, SOL_SOCKET, SO_TIMESTAMPNS, &en, sizeof(en));
+  sz = DGRAM_RCVBUF;
+  if (setsockopt (c->ufd, SOL_SOCKET, SO_RCVBUFFORCE, &sz, sizeof(sz)) < 0) {
+    setsockopt (c->ufd, SOL_SOCKET, SO_RCVBUF, &sz, sizeof(sz));
+  }
+  ev.events   = EPOLLIN;
+  ev.data.ptr = (void *)((uintptr_t)c | UDP_TAG);
+  return (epoll_ctl (loop->epfd, EPOLL_CTL_ADD, c->ufd, &ev));
+}
+
+// Count received data blocks until the client sends STOP
+static void assistant_recv (LOOP *loop, CONN *c) {
+  static const char stop[] = "STOP";
+  int32_t i,n;
+  char ch;
+
+  for (;;) {
+    n = conn_read (loop, c, RX_SIZE);
+    if (n == -1) return;
+    if (n <=  0) {
+      conn_close (loop, c);
+      return;
+    }
+    for (i = 0; i < n; i++) {
+      ch = loop->rx_buf[i];
+      if (ch == stop[c->stop]) {
+        if (++c->stop == 4U) {
+          if (c->mode == RECV_UDP) {
+            // Client sent all datagrams (STOP <n> datagrams.), receive late ones
+            loop->rx_buf[n < RX_SIZE ? n : RX_SIZE - 1] = 0;
+            sscanf (&loop->rx_buf[i+1], "%u", &c->udp_sent);
+            c->state = AS_UDP_LINGER;
+            conn_watch (loop, c, 0U);
+            conn_timer (loop, c, UDP_LINGER, 0U);
+            return;
+          }
+          // Client terminated upload, count the data before STOP
+          c->cnt += (uint64_t)(i + 1);
+          c->cnt -= 4U;
+          assistant_stat (loop, c);
+          return;
+        }
+      }
+      else {
+        c->stop = (ch == 'S') ? 1U : 0U;
+      }
+    }
+    if (c->mode == RECV_UDP) continue;
+    c->cnt += (uint32_t)n;
+    if (c->mode == RECV_PACED) {
+      if (c->last == 0U) {
+        // First data, start the arrival rate intervals
+        c->last = time_ns ();
+        conn_timer (loop, c, c->win_ms, c->win_ms);
+      }
+      c->win_bytes += (uint32_t)n;
+    }
+  }
+}
+
+// Start the connection to the requested address
+static void assistant_connect (LOOP *loop, CONN *c) {
+  struct sockaddr_in sa;
+  int32_t type,rc;
+
+  type  = (c->bsize != 0U) ? SOCK_STREAM : SOCK_DGRAM;
+  c->fd = socket (PF_INET, type | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  if (c->fd < 0) {
+    conn_close (loop, c);
+    return;
+  }
+  if (loop->addr.s_addr != htonl (INADDR_ANY)) {
+    // Connect from the service address
+    memset (&sa, 0, sizeof(sa));
+    sa.sin_family = AF_INET;
+    sa.sin_addr   = loop->addr;
+    bind (c->fd, (struct sockaddr *)&sa, sizeof(sa));
+  }
+  c->events = 0U;
+  rc = connect (c->fd, (struct sockaddr *)&c->peer, sizeof(c->peer));
+  if ((rc < 0) && (errno == EINPROGRESS)) {
+    // Wait for the connection to complete
+    struct epoll_event ev;
+    ev.events   = EPOLLOUT;
+    ev.data.ptr = c;
+    epoll_ctl (loop->epfd, EPOLL_CTL_ADD, c->fd, &ev);
+    c->events = EPOLLOUT;
+    c->state  = AS_CONNECT_PENDING;
+    conn_timer (loop, c, CONNECT_TIMEOUT, 0U);
+    return;
+  }
+  if (rc < 0) {
+    conn_close (loop, c);
+    return;
+  }
+  // Send some text, wait and close
+  send (c->fd, "SockServer", 10, MSG_NOSIGNAL);
+  c->state = AS_CONNECT_LINGER;
+  conn_timer (loop, c, 500U, 0U);
+}
+
+// Test assistant command
+static void assistant_cmd (LOOP *loop, CONN *c) {
+  ssize_t n;
+
+  // Receive the command
+  n = recv (c->fd, c->buf, sizeof(c->buf)-1, 0);
+  if (n < 0) {
+    if ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR)) return;
+  }
+  if (n <= 0) {
+    conn_close (loop, c);
+    return;
+  }
+  count_rx (loop, c, (int32_t)n, 0U);
+
+  // Parse the command
+  c->buf[n] = 0;
+
+  /* Syntax:  CONNECT <proto>,<ip_addr>,<port>,<delay_ms>
+     Param:   <proto>    = protocol (TCP, UDP)
+              <ip_addr>  = IP address (0.0.0.0 = sender address)
+              <port>     = port number
+              <delay_ms> = startup delay
+
+     Example: CONNECT TCP,192.168.1.200,80,600
+     (wait 600ms then connect to 192.168.1.200, port 80)
+  */
+  if ((strncmp (c->buf, "CONNECT TCP", 11) == 0) ||
+      (strncmp (c->buf, "CONNECT UDP", 11) == 0)) {
+    uint8_t  ip[4] = { 0U, 0U, 0U, 0U };
+    uint16_t port  = 0U;
+    uint32_t delay = 0U;
+
+    // Parse command parameters
+    sscanf (c->buf+11,",%hhu.%hhu.%hhu.%hhu,%hu,%u",&ip[0],&ip[1],&ip[2],&ip[3],&port,&delay);
+
+    c->peer.sin_port = htons (port);
+    if ((ip[0] | ip[1] | ip[2] | ip[3]) != 0U) {
+      // Supplied address not 0.0.0.0 use it
+      memcpy (&c->peer.sin_addr, ip, 4);
+    }
+
+    // Limit the timeout
+    if (delay < 10)   delay = 10;
+    if (delay > 5000) delay = 5000;
+    c->bsize = (c->buf[8] == 'T') ? 1U : 0U;
+    c->cnt   = delay;
+
+    // Close the control connection after 10 ms
+    c->state = AS_CONNECT_CLOSE;
+    conn_watch (loop, c, 0U);
+    conn_timer (loop, c, 10U, 0U);
+    return;
+  }
+
+  /* Syntax:  SEND <proto>,<bsize>,<time_ms>
+     Param:   <proto>   = protocol (TCP, UDP)
+              <bsize>   = size of data block in bytes
+              <time_ms> = test duration in ms
+  */
+  if (strncmp (c->buf, "SEND TCP", 8) == 0) {
+    uint32_t bsize = 0U,time = 0U;
+    int32_t  sz;
+
+    // Parse command parameters
+    sscanf (c->buf+8,",%u,%u",&bsize,&time);
+
+    // Check limits
+    if (bsize < 32)    bsize = 32;
+    if (bsize > 1460)  bsize = 1460;
+    if (time < 500)    time  = 500;
+    if (time > 60000)  time  = 60000;
+
+    // Limit send buffering, so that the test time is the transfer time
+    sz = (int32_t)bsize * 2;
+    setsockopt (c->fd, SOL_SOCKET, SO_SNDBUF, &sz, sizeof(sz));
+
+    c->bsize    = bsize;
+    c->deadline = (uint64_t)time * 1000000U;
+    c->setchar  = 'a';
+    c->state    = AS_SEND_START;
+    conn_watch (loop, c, 0U);
+    conn_timer (loop, c, 10U, 0U);
+    return;
+  }
+
+  /* Syntax:  BULK <proto>,<bsize>,<time_ms>
+     Param:   <proto>   = protocol (TCP)
+              <bsize>   = size of data block in bytes (32 to 65536)
+              <time_ms> = test duration in ms
+
+     High-rate download with the SEND data format (Block[n] header, fill
+     character, STAT report), written from a prebuilt pattern in writes
+     of up to 64 KB.
+  */
+  if (strncmp (c->buf, "BULK TCP", 8) == 0) {
+    uint32_t bsize = 0U,time = 0U;
+    int32_t  sz;
+
+    // Parse command parameters
+    sscanf (c->buf+8,",%u,%u",&bsize,&time);
+
+    // Check limits
+    if (bsize < 32)             bsize = 32;
+    if (bsize > BULK_BSIZE_MAX) bsize = BULK_BSIZE_MAX;
+    if (time < 500)             time  = 500;
+    if (time > 60000)           time  = 60000;
+
+    // Keep the unsent data small, so that the test time is the transfer time
+    sz = BULK_WRITE * 2;
+    setsockopt (c->fd, IPPROTO_TCP, TCP_NOTSENT_LOWAT, &sz, sizeof(sz));
+
+    c->mode     = SEND_BULK;
+    c->bsize    = bsize;
+    c->blk      = 1U;
+    c->boffs    = 0U;
+    c->deadline = (uint64_t)time * 1000000U;
+    c->setchar  = 'a';
+    c->state    = AS_SEND_START;
+    conn_watch (loop, c, 0U);
+    conn_timer (loop, c, 10U, 0U);
+    return;
+  }
+
+  /* Syntax:  PSEND <proto>,<bsize>,<time_ms>,<rate_kbps>,<burst>
+     Param:   <proto>     = protocol (TCP)
+              <bsize>     = size of data block in bytes (32 to 65536)
+              <time_ms>   = test duration in ms
+              <rate_kbps> = send rate in kbit/s
+              <burst>     = burst size in bytes (0 = one block)
+
+     Paced download with the SEND data format, sent by a token bucket that
+     is refilled at the requested rate up to one burst (at least the data
+     of PACE_TICK_MIN at the requested rate). The STAT report adds the
+     achieved and the requested rate:
+     STAT <n> bytes, rate <a> of <r> kbit/s.
+     Example: PSEND TCP,1460,10000,50000,14600
+     (send 1460-byte blocks for 10s at 50 Mbit/s, bursts of 10 blocks)
+  */
+  if (strncmp (c->buf, "PSEND TCP", 9) == 0) {
+    uint32_t bsize = 0U,time = 0U,rate = 0U,burst = 0U;
+    uint64_t tick;
+    int32_t  sz;
+
+    // Parse command parameters
+    sscanf (c->buf+9,",%u,%u,%u,%u",&bsize,&time,&rate,&burst);
+
+    // Check limits
+    if (bsize < 32)              bsize = 32;
+    if (bsize > BULK_BSIZE_MAX)  bsize = BULK_BSIZE_MAX;
+    if (time < 500)              time  = 500;
+    if (time > 60000)            time  = 60000;
+    if (rate < 1)                rate  = 1;
+    if (rate > PACE_RATE_MAX)    rate  = PACE_RATE_MAX;
+    if (burst == 0)              burst = bsize;
+    if (burst > PACE_BURST_MAX)  burst = PACE_BURST_MAX;
+
+    // Pacing period: time to send one burst at the requested rate. At the
+    // minimum period the burst is raised to the data of one period, the
+    // bucket would otherwise limit the rate to burst per PACE_TICK_MIN.
+    // The raised burst is limited to PACE_BURST_MAX as well.
+    tick = (uint64_t)burst * 8000000U / rate;
+    if (tick < PACE_TICK_MIN) {
+      tick  = PACE_TICK_MIN;
+      burst = (uint32_t)(((uint64_t)rate * PACE_TICK_MIN + 7999999U) / 8000000U);
+      if (burst > PACE_BURST_MAX)  burst = PACE_BURST_MAX;
+    }
+
+    // Keep the unsent data small, so that the rate is the rate on the link
+    sz = (int32_t)burst * 2;
+    setsockopt (c->fd, IPPROTO_TCP, TCP_NOTSENT_LOWAT, &sz, sizeof(sz));
+
+    c->mode     = SEND_PACED;
+    c->bsize    = bsize;
+    c->blk      = 1U;
+    c->boffs    = 0U;
+    c->rate     = rate;
+    c->burst    = burst;
+    c->tick     = tick;
+    c->win_ms   = time;
+    c->deadline = (uint64_t)time * 1000000U;
+    c->setchar  = 'a';
+    c->state    = AS_SEND_START;
+    conn_watch (loop, c, 0U);
+    conn_timer (loop, c, 10U, 0U);
+    return;
+  }
+
+  /* Syntax:  PRECV <proto>,<bsize>,<interval_ms>
+     Param:   <proto>       = protocol (TCP)
+              <bsize>       = size of data block in bytes
+              <interval_ms> = arrival rate interval in ms (0 = 100 ms)
+
+     Receive like RECV and measure the arrival rate in each interval from
+     the first received data. The report after STOP adds the average,
+     minimum, maximum and standard deviation of the interval rates:
+     STAT <n> bytes, <k> intervals of <ms> ms, rate avg <a> min <b> max <c> stddev <d> kbit/s.
+  */
+  if (strncmp (c->buf, "PRECV TCP", 9) == 0) {
+    uint32_t bsize = 0U,interval = 0U;
+
+    // Parse command parameters
+    sscanf (c->buf+9,",%u,%u",&bsize,&interval);
+
+    // Check limits
+    if (interval == 0)   interval = METER_INTERVAL;
+    if (interval < 10)   interval = 10;
+    if (interval > 10000) interval = 10000;
+
+    timer_set (c->tfd, 0U, 0U);
+    c->mode   = RECV_PACED;
+    c->win_ms = interval;
+    c->state  = AS_RECV;
+    return;
+  }
+
+  /* Syntax:  SEND UDP,<bsize>,<time_ms>,<rate_kbps>,<port>
+     Param:   <bsize>     = size of datagram in bytes (16 to 1472)
+              <time_ms>   = test duration in ms
+              <rate_kbps> = send rate in kbit/s (0 = 1000)
+              <port>      = UDP port of the client (address of the control connection)
+
+     Datagrams start with a header of three 32-bit values in network byte
+     order: sequence number (from 0), send time seconds and microseconds.
+     The report on the control connection gives the sent count:
+     STAT <n> bytes, <k> datagrams.
+  */
+  if (strncmp (c->buf, "SEND UDP", 8) == 0) {
+    uint32_t bsize = 0U,time = 0U,rate = 0U,port = 0U;
+    struct sockaddr_in sa;
+
+    // Parse command parameters
+    sscanf (c->buf+8,",%u,%u,%u,%u",&bsize,&time,&rate,&port);
+
+    // Check limits
+    if (bsize < 16)             bsize = 16;
+    if (bsize > UDP_BSIZE_MAX)  bsize = UDP_BSIZE_MAX;
+    if (time < 500)             time  = 500;
+    if (time > 60000)           time  = 60000;
+    if (rate == 0)              rate  = UDP_RATE_DEFAULT;
+    if (rate > PACE_RATE_MAX)   rate  = PACE_RATE_MAX;
+
+    sa          = c->peer;
+    sa.sin_port = htons ((uint16_t)port);
+    if ((port == 0U) || (port > 65535U) || (assistant_udp_open (loop, c, &sa) != 0)) {
+      conn_close (loop, c);
+      return;
+    }
+
+    // Send period of 1 ms (at least one datagram), bucket of two periods
+    // to catch up with late timer ticks
+    c->mode  = SEND_UDP;
+    c->bsize = bsize;
+    c->rate  = rate;
+    c->burst = (uint32_t)((uint64_t)rate * (UDP_TICK / 1000U) / 8000U);
+    if (c->burst < bsize) c->burst = bsize;
+    c->tick  = (uint64_t)c->burst * 8000000U / rate;
+    c->burst = c->burst * 2U;
+    c->deadline = (uint64_t)time * 1000000U;
+    c->state    = AS_SEND_START;
+    conn_watch (loop, c, 0U);
+    conn_timer (loop, c, 10U, 0U);
+    return;
+  }
+
+  /* Syntax:  RECV UDP,<bsize>
+     Param:   <bsize> = size of datagram in bytes
+
+     The server replies with the UDP port to send the datagrams to (PORT <n>)
+     and receives datagrams with the SEND UDP header until the client sends
+     STOP <n> datagrams. on the control connection. The report is:
+     STAT <n> bytes, <k> datagrams, <l> lost, <r> reordered, jitter <j> us.
+  */
+  if (strncmp (c->buf, "RECV UDP", 8) == 0) {
+    struct sockaddr_in sa;
+    socklen_t sa_len = sizeof(sa);
+
+    if ((assistant_udp_open (loop, c, NULL) != 0) ||
+        (getsockname (c->ufd, (struct sockaddr *)&sa, &sa_len) != 0)) {
+      conn_close (loop, c);
+      return;
+    }
+    timer_set (c->tfd, 0U, 0U);
+    c->mode  = RECV_UDP;
+    c->state = AS_RECV;
+    c->len   = (uint32_t)sprintf (c->buf, "PORT %u", ntohs (sa.sin_port));
+    c->offs  = 0U;
+    if (conn_flush (loop, c) != 1) {
+      conn_close (loop, c);
+    }
+    return;
+  }
+
+  /* Syntax:  STATS [<ip_addr>]
+     Param:   <ip_addr> = IP address of the device (default: sender address)
+
+     Reports the counters of all connections and datagrams of the device:
+     STATS <addr>: <c> conns, rx <n> bytes <p> packets, tx <n> bytes <p> packets,
+     <t> ms, <r> retransmits, rtt <us> us, rwnd limited <ms> ms.
+     TCP segments, retransmits, RTT and time are added when a connection closes.
+  */
+  if ((strncmp (c->buf, "STATS", 5) == 0) && ((c->buf[5] == 0) || (c->buf[5] == ' '))) {
+    uint8_t  ip[4] = { 0U, 0U, 0U, 0U };
+    uint32_t addr;
+    PEER     zero,*p;
+
+    // Parse command parameters
+    sscanf (c->buf+5," %hhu.%hhu.%hhu.%hhu",&ip[0],&ip[1],&ip[2],&ip[3]);
+    memcpy (&addr, ip, 4);
+    if (addr == 0U) {
+      addr = c->peer.sin_addr.s_addr;
+    }
+    p = peer_get (addr, 0U);
+    if (p == NULL) {
+      memset (&zero, 0, sizeof(zero));
+      p = &zero;
+    }
+    c->len = (uint32_t)snprintf (c->buf, sizeof(c->buf),
+             "STATS %s: %u conns, rx %llu bytes %llu packets, tx %llu bytes %llu packets, "
+             "%llu ms, %u retransmits, rtt %u us, rwnd limited %llu ms.",
+             inet_ntoa (*(struct in_addr *)&addr), STAT_GET (p->conns),
+             (unsigned long long)STAT_GET (p->rx_bytes), (unsigned long long)STAT_GET (p->rx_pkts),
+             (unsigned long long)STAT_GET (p->tx_bytes), (unsigned long long)STAT_GET (p->tx_pkts),
+             (unsigned long long)STAT_GET (p->time), STAT_GET (p->retrans), STAT_GET (p->rtt),
+             (unsigned long long)(STAT_GET (p->rwnd) / 1000U));
+    assistant_reply (loop, c);
+    return;
+  }
+
+  /* Syntax:  RECV <proto>,<bsize>
+     Param:   <proto> = protocol (TCP, UDP)
+              <bsize> = size of data block in bytes
+  */
+  if (strncmp (c->buf, "RECV TCP", 8) == 0) {
+    timer_set (c->tfd, 0U, 0U);
+    c->state = AS_RECV;
+    return;
+  }
+
+  conn_close (loop, c);
+}
+
+// Test assistant socket and timer events
+static void assistant_event (LOOP *loop, CONN *c, uint32_t events, uint32_t timer) {
+  int32_t n,err;
+  socklen_t len;
+
+  switch (c->state) {
+    case AS_CMD:
+      if (timer) {
+        // Command not received in time
+        conn_close (loop, c);
+        return;
+      }
+      assistant_cmd (loop, c);
+      return;
+
+    case AS_CONNECT_CLOSE:
+      conn_close_sock (loop, c);
+      if (timer) {
+        c->state = AS_CONNECT_DELAY;
+        conn_timer (loop, c, (uint32_t)c->cnt, 0U);
+      }
+      return;
+
+    case AS_CONNECT_DELAY:
+      if (timer) {
+        assistant_connect (loop, c);
+      }
+      return;
+
+    case AS_CONNECT_PENDING:
+      err = ETIMEDOUT;
+      if (!timer) {
+        len = sizeof(err);
+        getsockopt (c->fd, SOL_SOCKET, SO_ERROR, &err, &len);
+      }
+      if (err != 0) {
+        conn_close (loop, c);
+        return;
+      }
+      // Send some text, wait and close
+      send (c->fd, "SockServer", 10, MSG_NOSIGNAL);
+      c->state = AS_CONNECT_LINGER;
+      conn_watch (loop, c, 0U);
+      conn_timer (loop, c, 500U, 0U);
+      return;
+
+    case AS_CONNECT_LINGER:
+      // Timeout or closed by the peer
+      break;
+
+    case AS_SEND_START:
+      if (!timer) break;
+      c->deadline += time_ns ();
+      c->state     = AS_SEND;
+      if (c->mode == SEND_UDP) {
+        c->tokens = (double)c->bsize;
+        c->last   = time_ns ();
+        conn_timer_ns (loop, c, c->tick, c->tick);
+        assistant_udp_send (loop, c);
+        return;
+      }
+      if (c->mode == SEND_PACED) {
+        // Start with a full bucket, then refill on each pacing tick
+        c->tokens = (double)c->burst;
+        c->last   = time_ns ();
+        conn_timer_ns (loop, c, c->tick, c->tick);
+        assistant_paced (loop, c);
+        return;
+      }
+      if (c->mode == SEND_BULK) {
+        assistant_bulk (loop, c);
+        return;
+      }
+      assistant_send (loop, c);
+      return;
+
+    case AS_SEND:
+      if (events & (EPOLLERR | EPOLLHUP)) break;
+      if (c->mode == SEND_PACED) {
+        if (timer) assistant_paced (loop, c);
+        return;
+      }
+      if (c->mode == SEND_UDP) {
+        if (timer) assistant_udp_send (loop, c);
+        return;
+      }
+      if (c->mode == SEND_BULK) {
+        assistant_bulk (loop, c);
+        return;
+      }
+      assistant_send (loop, c);
+      return;
+
+    case AS_UDP_LINGER:
+      if (!timer) break;
+      assistant_stat (loop, c);
+      return;
+
+    case AS_RECV:
+      if (timer) {
+        // Arrival rate interval expired
+        assistant_meter (c, time_ns ());
+        return;
+      }
+      assistant_recv (loop, c);
+      return;
+
+    case AS_STAT:
+      if (events & (EPOLLERR | EPOLLHUP)) break;
+      n = conn_flush (loop, c);
+      if (n < 0) break;
+      if (n > 0) {
+        c->state = AS_DRAIN;
+        conn_watch (loop, c, EPOLLIN);
+      }
+      return;
+
+    case AS_DRAIN:
+      // Let the client close the connection
+      do {
+        n = conn_read (loop, c, RX_SIZE);
+      } while (n > 0);
+      if (n == -1) return;
+      break;
+  }
+  conn_close (loop, c);
+}
+
+// Stream connection socket and timer events
+static void conn_event (LOOP *loop, CONN *c, uint32_t events, uint32_t timer) {
+  int32_t i,n,rc;
+
+  switch (c->service) {
+    case SRV_ECHO:
+      if (c->offs < c->len) {
+        // Complete the previous echo first
+        rc = conn_flush (loop, c);
+        if (rc < 0) break;
+        if (rc == 0) return;
+        conn_watch (loop, c, EPOLLIN);
+      }
+      for (i = 0; i < 16; i++) {
+        n = conn_read (loop, c, BUFF_SIZE);
+        if (n == -1) return;
+        if (n <=  0) break;
+        memcpy (c->buf, loop->rx_buf, (uint32_t)n);
+        c->len  = (uint32_t)n;
+        c->offs = 0U;
+        rc = conn_flush (loop, c);
+        // ESC terminates the connection
+        if ((rc < 0) || (c->buf[0] == ESC)) break;
+        if (rc == 0) {
+          conn_watch (loop, c, EPOLLOUT);
+          return;
+        }
+      }
+      if (i == 16) return;
+      break;
+
+    case SRV_DISCARD:
+      for (;;) {
+        n = conn_read (loop, c, RX_SIZE);
+        if (n == -1) return;
+        // ESC terminates the connection
+        if ((n <= 0) || (loop->rx_buf[0] == ESC)) break;
+      }
+      break;
+
+    case SRV_CHARGEN:
+      if (timer) {
+        // Send next line, skip it when the socket buffer is full
+        c->setchar = gen_char (c->buf, c->setchar, 81);
+        n = (int32_t)send (c->fd, c->buf, 81, MSG_NOSIGNAL);
+        if (n > 0) count_tx (loop, c, n, 0U);
+        if ((n < 0) && (errno != EAGAIN) && (errno != EWOULDBLOCK)) break;
+        return;
+      }
+      for (;;) {
+        n = conn_read (loop, c, RX_SIZE);
+        if (n == -1) return;
+        // ESC terminates the connection
+        if ((n <= 0) || (loop->rx_buf[0] == ESC)) break;
+      }
+      break;
+
+    case SRV_ASSISTANT:
+      assistant_event (loop, c, events, timer);
+      return;
+  }
+  conn_close (loop, c);
+}
+
+// Accept pending connections of a stream service
+static void stream_accept (LOOP *loop, SERVICE *srv) {
+  struct sockaddr_in sa;
+  struct timespec ts;
+  socklen_t sa_len;
+  int32_t fd,en = 1;
+  CONN *c;
+
+  for (;;) {
+    sa_len = sizeof(sa);
+    fd = accept4 (srv->fd, (struct sockaddr *)&sa, &sa_len, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    if (fd < 0) {
+      if (errno == EINTR) continue;
+      return;
+    }
+    set_remote (loop, &sa);
+    c = conn_open (loop, fd, srv->service, EPOLLIN);
+    if (c == NULL) {
+      close (fd);
+      continue;
+    }
+    c->peer = sa;
+    c->host = peer_get (sa.sin_addr.s_addr, 1U);
+    if (c->host != NULL) {
+      STAT_INC (c->host->conns, 1U);
+    }
+    clock_gettime (CLOCK_REALTIME, &ts);
+    c->ses.peer    = sa;
+    c->ses.service = srv->service;
+    c->ses.start   = (uint64_t)ts.tv_sec * 1000U + (uint64_t)ts.tv_nsec / 1000000U;
+    switch (srv->service) {
+      case SRV_ECHO:
+        setsockopt (fd, IPPROTO_TCP, TCP_NODELAY, &en, sizeof(en));
+        break;
+      case SRV_CHARGEN:
+        conn_timer (loop, c, 1U, CHARGEN_INTERVAL);
+        break;
+      case SRV_ASSISTANT:
+        c->state = AS_CMD;
+        conn_timer (loop, c, CMD_TIMEOUT, 0U);
+        break;
+    }
+  }
+}
+
+// Datagram service (runs ECHO, DISCARD and CHARGEN services)
+// (receives and replies a batch of datagrams per system call)
+static void dgram_event (LOOP *loop, SERVICE *srv) {
+  DGRAM_BATCH *b = &loop->dgram;
+  PEER    *p = NULL;
+  uint32_t i,k,len,cnt;
+  int32_t n,rc;
+
+  for (k = 0U; k < MAX_BATCHES; k++) {
+    n = recvmmsg (srv->fd, b->msg, MAX_DGRAMS, MSG_DONTWAIT, NULL);
+    if (n <= 0) {
+      return;
+    }
+    for (i = 0U, cnt = 0U; i < (uint32_t)n; i++) {
+      cnt += b->msg[i].msg_len;
+      p = peer_dgram (p, &b->sa[i]);
+      if (p != NULL) {
+        STAT_INC (p->rx_bytes, b->msg[i].msg_len);
+        STAT_INC (p->rx_pkts, 1U);
+      }
+    }
+    count_rx (loop, NULL, (int32_t)cnt, 0U);
+    set_remote (loop, &b->sa[n-1]);
+
+    if (srv->service != SRV_DISCARD) {
+      for (i = 0U; i < (uint32_t)n; i++) {
+        if (srv->service == SRV_ECHO) {
+          len = b->msg[i].msg_len;
+        }
+        else {
+          len = 2U + (rand_r (&loop->seed) % 511U);
+          loop->setchar = gen_char (b->buf[i], loop->setchar, len);
+        }
+        b->iov[i].iov_len = len;
+      }
+      // Reply to the senders, drop the rest when the socket buffer is full
+      for (i = 0U, cnt = 0U; i < (uint32_t)n; i += (uint32_t)rc) {
+        rc = sendmmsg (srv->fd, &b->msg[i], (uint32_t)n - i, MSG_DONTWAIT);
+        if (rc <= 0) break;
+        for (len = i; len < i + (uint32_t)rc; len++) {
+          cnt += b->msg[len].msg_len;
+          p = peer_dgram (p, &b->sa[len]);
+          if (p != NULL) {
+            STAT_INC (p->tx_bytes, b->msg[len].msg_len);
+            STAT_INC (p->tx_pkts, 1U);
+          }
+        }
+      }
+      count_tx (loop, NULL, (int32_t)cnt, 0U);
+    }
+    dgram_prepare (b, (uint32_t)n);
+    if (n < MAX_DGRAMS) {
+      return;
+    }
+  }
+}
+
+// Initialize the event loop and open the services
+int32_t LoopInit (LOOP *loop, uint32_t id, struct in_addr addr, uint32_t options) {
+  struct epoll_event ev;
+  int32_t rc;
+
+  memset (loop, 0, sizeof(LOOP));
+  loop->id        = id;
+  loop->addr      = addr;
+  loop->seed      = id + 1U;
+  loop->setchar   = '@';
+  loop->tmo_fd[0] = loop->tmo_fd[1] = loop->tmo_fd[2] = -1;
+  dgram_prepare (&loop->dgram, MAX_DGRAMS);
+
+  loop->epfd    = epoll_create1 (EPOLL_CLOEXEC);
+  loop->wake_fd = eventfd (0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if ((loop->epfd < 0) || (loop->wake_fd < 0)) {
+    LoopUninit (loop);
+    return (-1);
+  }
+  loop->wake_obj = OBJ_WAKE;
+  ev.events   = EPOLLIN;
+  ev.data.ptr = &loop->wake_obj;
+  epoll_ctl (loop->epfd, EPOLL_CTL_ADD, loop->wake_fd, &ev);
+
+  rc  = open_service (loop, SOCK_STREAM, SRV_ECHO,      ECHO_PORT,      options);
+  rc |= open_service (loop, SOCK_STREAM, SRV_DISCARD,   DISCARD_PORT,   options);
+  rc |= open_service (loop, SOCK_STREAM, SRV_CHARGEN,   CHARGEN_PORT,   options);
+  rc |= open_service (loop, SOCK_STREAM, SRV_ASSISTANT, ASSISTANT_PORT, options);
+  rc |= open_service (loop, SOCK_DGRAM,  SRV_ECHO,      ECHO_PORT,      options);
+  rc |= open_service (loop, SOCK_DGRAM,  SRV_DISCARD,   DISCARD_PORT,   options);
+  rc |= open_service (loop, SOCK_DGRAM,  SRV_CHARGEN,   CHARGEN_PORT,   options);
+  // TCP_REJECTED_PORT is not opened, the kernel rejects connection requests
+  if (options & LOOP_TIMEOUT) {
+    // One accept queue only, so it is not shared with other workers
+    rc |= open_timeout (loop);
+  }
+  if (rc != 0) {
+    LoopUninit (loop);
+    return (-1);
+  }
+  return (0);
+}
+
+// Run the event loop until LoopStop is called
+void LoopRun (LOOP *loop) {
+  struct epoll_event ev[MAX_EVENTS];
+  uint64_t expired;
+  uint8_t *obj;
+  int32_t i,n;
+  CONN *c;
+
+  while (__atomic_load_n (&loop->stop, __ATOMIC_ACQUIRE) == 0) {
+    n = epoll_wait (loop->epfd, ev, MAX_EVENTS, -1);
+    for (i = 0; i < n; i++) {
+      if ((uintptr_t)ev[i].data.ptr & TIMER_TAG) {
+        // Connection timer
+        c = (CONN *)((uintptr_t)ev[i].data.ptr & ~(uintptr_t)OBJ_TAGS);
+        if ((c->obj == OBJ_CONN) && (read (c->tfd, &expired, sizeof(expired)) == sizeof(expired))) {
+          conn_event (loop, c, 0U, 1U);
+        }
+        continue;
+      }
+      if ((uintptr_t)ev[i].data.ptr & UDP_TAG) {
+        // Assistant datagram socket
+        c = (CONN *)((uintptr_t)ev[i].data.ptr & ~(uintptr_t)OBJ_TAGS);
+        if ((c->obj == OBJ_CONN) && (c->ufd >= 0)) {
+          assistant_udp_recv (loop, c);
+        }
+        continue;
+      }
+      obj = ev[i].data.ptr;
+      switch (*obj) {
+        case OBJ_LISTEN:
+          stream_accept (loop, (SERVICE *)obj);
+          break;
+        case OBJ_DGRAM:
+          dgram_event (loop, (SERVICE *)obj);
+          break;
+        case OBJ_CONN:
+          conn_event (loop, (CONN *)obj, ev[i].events, 0U);
+          break;
+        case OBJ_WAKE:
+          read (loop->wake_fd, &expired, sizeof(expired));
+          break;
+      }
+    }
+    // Free connections closed in this batch
+    while (loop->dead != NULL) {
+      c = loop->dead;
+      loop->dead = c->next;
+      free (c);
+    }
+  }
+}
+
+// Stop the event loop (called from another thread)
+void LoopStop (LOOP *loop) {
+  uint64_t val = 1U;
+
+  __atomic_store_n (&loop->stop, 1, __ATOMIC_RELEASE);
+  if (write (loop->wake_fd, &val, sizeof(val)) < 0) {
+    return;
+  }
+}
+
+// Close all connections and services
+void LoopUninit (LOOP *loop) {
+  uint32_t i;
+  CONN *c;
+
+  while (loop->conn != NULL) {
+    conn_close (loop, loop->conn);
+  }
+  while (loop->dead != NULL) {
+    c = loop->dead;
+    loop->dead = c->next;
+    free (c);
+  }
+  for (i = 0U; i < loop->srv_num; i++) {
+    close (loop->srv[i].fd);
+  }
+  loop->srv_num = 0U;
+  for (i = 0U; i < 3U; i++) {
+    if (loop->tmo_fd[i] >= 0) close (loop->tmo_fd[i]);
+    loop->tmo_fd[i] = -1;
+  }
+  if (loop->wake_fd >= 0) close (loop->wake_fd);
+  if (loop->epfd    >= 0) close (loop->epfd);
+  loop->wake_fd = -1;
+  loop->epfd    = -1;
+}
+
+// Build the bulk download pattern
+// (in a memfd, so that large blocks can be sent with sendfile without copying)
+static int32_t BulkInit (void) {
+  uint32_t size = BULK_RUNS * BULK_BSIZE_MAX;
+  uint32_t i;
+
+  bulk_fd = memfd_create ("SockServer", MFD_CLOEXEC);
+  if ((bulk_fd >= 0) && (ftruncate (bulk_fd, size) == 0)) {
+    bulk_pat = mmap (NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, bulk_fd, 0);
+    if (bulk_pat == MAP_FAILED) bulk_pat = NULL;
+  }
+  if (bulk_pat == NULL) {
+    // No memfd, blocks are sent from memory only
+    if (bulk_fd >= 0) close (bulk_fd);
+    bulk_fd  = -1;
+    bulk_pat = malloc (size);
+    if (bulk_pat == NULL) {
+      return (-1);
+    }
+  }
+  for (i = 0U; i < BULK_RUNS; i++) {
+    memset (bulk_pat + (i * BULK_BSIZE_MAX), ' ' + (int32_t)i, BULK_BSIZE_MAX);
+  }
+  return (0);
+}
+
+// Worker thread
+static void *Worker (void *argument) {
+  LoopRun ((LOOP *)argument);
+  return (NULL);
+}
+
+// Debug print status, aggregated over the workers
+// (remote address of the busiest worker since the last output)
+static void print_status (void) {
+  static uint64_t rx_prev,tx_prev;
+  static uint32_t conn_prev;
+  uint64_t rx,tx,remote,delta,max;
+  struct in_addr addr;
+  uint32_t i,conn;
+
+  rx = tx = remote = max = 0U;
+  conn = 0U;
+  for (i = 0U; i < loop_num; i++) {
+    delta = STAT_GET (loop_tab[i].rx_cnt);
+    rx   += delta;
+    tx   += STAT_GET (loop_tab[i].tx_cnt);
+    conn += STAT_GET (loop_tab[i].conn_num);
+    delta -= loop_tab[i].rx_last;
+    loop_tab[i].rx_last += delta;
+    if ((delta > max) || (remote == 0U)) {
+      max    = delta;
+      remote = STAT_GET (loop_tab[i].remote);
+    }
+  }
+  if ((rx == rx_prev) && (tx == tx_prev) && (conn == conn_prev)) return;
+  rx_prev   = rx;
+  tx_prev   = tx;
+  conn_prev = conn;
+
+  addr.s_addr = (uint32_t)remote;
+  printf("\rAddr=%s, conn=%u, rx_cnt=%llu, tx_cnt=%llu    ",inet_ntoa(addr),
+         conn,(unsigned long long)rx,(unsigned long long)tx);
+  fflush (stdout);
+}
+
+// Print counters of each worker (SIGUSR1)
+static void print_workers (void) {
+  uint32_t i;
+
+  printf ("\n");
+  for (i = 0U; i < loop_num; i++) {
+    printf ("Worker %u: conn=%u, rx_cnt=%llu, tx_cnt=%llu\n", loop_tab[i].id,
+            STAT_GET (loop_tab[i].conn_num),
+            (unsigned long long)STAT_GET (loop_tab[i].rx_cnt),
+            (unsigned long long)STAT_GET (loop_tab[i].tx_cnt));
+  }
+  fflush (stdout);
+}
+
+// Write the closed connections and the changed device counters to the CSV file
+static void csv_flush (void) {
+  static const char *srv_name[] = { "echo", "discard", "chargen", "assistant" };
+  static uint64_t prev[MAX_PEERS];
+  struct timespec ts;
+  struct in_addr addr;
+  SESSION  ses;
+  LOOP    *loop;
+  uint64_t now,sum;
+  uint32_t i,head;
+  PEER    *p;
+
+  for (i = 0U; i < loop_num; i++) {
+    loop = &loop_tab[i];
+    head = __atomic_load_n (&loop->sess_head, __ATOMIC_ACQUIRE);
+    if (head - loop->sess_tail > SESS_NUM) {
+      // Records overwritten before the output
+      loop->sess_tail = head - SESS_NUM;
+    }
+    for ( ; loop->sess_tail != head; loop->sess_tail++) {
+      ses = loop->sess[loop->sess_tail % SESS_NUM];
+      __atomic_thread_fence (__ATOMIC_ACQUIRE);
+      if (__atomic_load_n (&loop->sess_head, __ATOMIC_RELAXED) - loop->sess_tail >= SESS_NUM) {
+        // Overwritten while copied
+        continue;
+      }
+      fprintf (csv_file, "%llu.%03u,conn,%s,%u,%s,1,%llu,%llu,%llu,%llu,%llu,%u,%u,%u,%llu\n",
+               (unsigned long long)(ses.start / 1000U), (uint32_t)(ses.start % 1000U),
+               inet_ntoa (ses.peer.sin_addr), ntohs (ses.peer.sin_port), srv_name[ses.service & 3U],
+               (unsigned long long)ses.time,
+               (unsigned long long)ses.rx_bytes, (unsigned long long)ses.rx_pkts,
+               (unsigned long long)ses.tx_bytes, (unsigned long long)ses.tx_pkts,
+               ses.retrans, ses.rtt, ses.min_rtt, (unsigned long long)(ses.rwnd / 1000U));
+    }
+  }
+
+  clock_gettime (CLOCK_REALTIME, &ts);
+  now = (uint64_t)ts.tv_sec * 1000U + (uint64_t)ts.tv_nsec / 1000000U;
+  for (i = 0U; i < MAX_PEERS; i++) {
+    p = &peer_tab[i];
+    addr.s_addr = __atomic_load_n (&p->addr, __ATOMIC_ACQUIRE);
+    if (addr.s_addr == 0U) continue;
+    // Devices with traffic or closed connections since the last output
+    sum = STAT_GET (p->rx_bytes) + STAT_GET (p->tx_bytes) + STAT_GET (p->time) + STAT_GET (p->conns);
+    if (sum == prev[i]) continue;
+    prev[i] = sum;
+    fprintf (csv_file, "%llu.%03u,device,%s,,,%u,%llu,%llu,%llu,%llu,%llu,%u,%u,,%llu\n",
+             (unsigned long long)(now / 1000U), (uint32_t)(now % 1000U), inet_ntoa (addr),
+             STAT_GET (p->conns), (unsigned long long)STAT_GET (p->time),
+             (unsigned long long)STAT_GET (p->rx_bytes), (unsigned long long)STAT_GET (p->rx_pkts),
+             (unsigned long long)STAT_GET (p->tx_bytes), (unsigned long long)STAT_GET (p->tx_pkts),
+             STAT_GET (p->retrans), STAT_GET (p->rtt), (unsigned long long)(STAT_GET (p->rwnd) / 1000U));
+  }
+  fflush (csv_file);
+}
+
+// Main program
+int main (int argc, char *argv[]) {
+  pthread_t *thread;
+  struct ifaddrs *ifa,*ifl;
+  struct in_addr addr;
+  struct timespec ts;
+  struct rlimit rl;
+  sigset_t sigs;
+  uint64_t csv_next;
+  uint32_t i,num;
+  char ac[80];
+  long cpus;
+  int32_t sig;
+
+  printf("\nSockServer %s\n", VERSION);
+
+  addr.s_addr = htonl (INADDR_ANY);
+  num = 1U;
+  for (i = 1U; i < (uint32_t)argc; i++) {
+    if ((strcmp (argv[i], "-b") == 0) && (i + 1U < (uint32_t)argc) && (inet_aton (argv[i+1U], &addr) != 0)) {
+      i++;
+      continue;
+    }
+    if ((strcmp (argv[i], "-w") == 0) && (i + 1U < (uint32_t)argc)) {
+      num = (uint32_t)strtoul (argv[++i], NULL, 0);
+      if (num == 0U) {
+        // One worker per CPU core
+        cpus = sysconf (_SC_NPROCESSORS_ONLN);
+        num  = (cpus > 0) ? (uint32_t)cpus : 1U;
+      }
+      if (num > MAX_WORKERS) num = MAX_WORKERS;
+      continue;
+    }
+    if ((strcmp (argv[i], "-s") == 0) && (i + 1U < (uint32_t)argc) && (csv_file == NULL)) {
+      csv_file = fopen (argv[++i], "a");
+      if (csv_file == NULL) {
+        printf ("Failed to open %s: %s\n", argv[i], strerror(errno));
+        return (1);
+      }
+      if (ftell (csv_file) == 0) {
+        fprintf (csv_file, "time,type,address,port,service,conns,duration_ms,rx_bytes,rx_packets,"
+                           "tx_bytes,tx_packets,retransmits,rtt_us,min_rtt_us,rwnd_limited_ms\n");
+      }
+      continue;
+    }
+    printf ("Usage: %s [-b <bind address>] [-w <workers, 0 = one per CPU core>] [-s <statistics CSV file>]\n", argv[0]);
+    return (1);
+  }
+
+  // Allow many concurrent connections
+  if (getrlimit (RLIMIT_NOFILE, &rl) == 0) {
+    rl.rlim_cur = rl.rlim_max;
+    setrlimit (RLIMIT_NOFILE, &rl);
+  }
+
+  // Signals are handled by the main thread only
+  sigemptyset (&sigs);
+  sigaddset (&sigs, SIGINT);
+  sigaddset (&sigs, SIGTERM);
+  sigaddset (&sigs, SIGUSR1);
+  pthread_sigmask (SIG_BLOCK, &sigs, NULL);
+  signal (SIGPIPE, SIG_IGN);
+
+  if (BulkInit () != 0) {
+    printf ("Out of memory\n");
+    return (1);
+  }
+
+  loop_tab = calloc (num, sizeof(LOOP));
+  thread   = calloc (num, sizeof(pthread_t));
+  if ((loop_tab == NULL) || (thread == NULL)) {
+    printf ("Out of memory\n");
+    return (1);
+  }
+  for (loop_num = 0U; loop_num < num; loop_num++) {
+    if (LoopInit (&loop_tab[loop_num], loop_num, addr, ((num > 1U) ? LOOP_REUSEPORT : 0U) |
+                                                        ((loop_num == 0U) ? LOOP_TIMEOUT : 0U)) != 0) {
+      printf ("Failed to open the services\n");
+      while (loop_num != 0U) LoopUninit (&loop_tab[--loop_num]);
+      return (1);
+    }
+  }
+  for (i = 0U; i < num; i++) {
+    if (pthread_create (&thread[i], NULL, Worker, &loop_tab[i]) != 0) {
+      printf ("Failed to create thread: Worker %u\n", i);
+      return (1);
+    }
+  }
+
+  // Print info about local host
+  if (gethostname (ac, sizeof(ac)) == 0) {
+    printf ("\nServer name: %s\n",ac);
+  }
+  if (addr.s_addr != htonl (INADDR_ANY)) {
+    printf ("Address: %s\n", inet_ntoa(addr));
+  }
+  else if (getifaddrs (&ifl) == 0) {
+    for (ifa = ifl; ifa != NULL; ifa = ifa->ifa_next) {
+      if ((ifa->ifa_addr != NULL) && (ifa->ifa_addr->sa_family == AF_INET)) {
+        printf ("Address: %s (%s)\n", inet_ntoa(((struct sockaddr_in *)ifa->ifa_addr)->sin_addr), ifa->ifa_name);
+      }
+    }
+    freeifaddrs (ifl);
+  }
+  printf ("Workers: %u\n", num);
+
+  printf("\nPress Ctrl+C to stop...\n");
+  fflush (stdout);
+
+  // Status output until stopped
+  ts.tv_sec  = STATUS_INTERVAL / 1000;
+  ts.tv_nsec = (STATUS_INTERVAL % 1000) * 1000000L;
+  csv_next   = time_ns () + (uint64_t)CSV_INTERVAL * 1000000U;
+  do {
+    sig = sigtimedwait (&sigs, NULL, &ts);
+    if (sig == SIGUSR1) {
+      print_workers ();
+    }
+    else if (sig < 0) {
+      print_status ();
+    }
+    if ((csv_file != NULL) && (time_ns () >= csv_next)) {
+      csv_flush ();
+      csv_next += (uint64_t)CSV_INTERVAL * 1000000U;
+    }
+  } while ((sig != SIGINT) && (sig != SIGTERM));
+
+  for (i = 0U; i < num; i++) {
+    LoopStop (&loop_tab[i]);
+  }
+  for (i = 0U; i < num; i++) {
+    pthread_join (thread[i], NULL);
+    LoopUninit (&loop_tab[i]);
+  }
+  if (csv_file != NULL) {
+    // Including the connections closed on exit
+    csv_flush ();
+    fclose (csv_file);
+  }
+  free (thread);
+  free (loop_tab);
+  printf ("\nOk\n");
+  return 0;
+}
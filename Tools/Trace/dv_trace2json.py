@@ -0,0 +1,220 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 Arm Limited. All rights reserved.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the License); you may
+# not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an AS IS BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# -----------------------------------------------------------------------------
+#
+# Project:     CMSIS-Driver Validation
+# Title:       Driver API trace converter (DV_Trace dump to Chrome trace JSON)
+#
+# -----------------------------------------------------------------------------
+
+"""Convert a dump of the CMSIS-Driver Validation trace ring (DV_Trace) into a
+Chrome trace (JSON Trace Event Format) for chrome://tracing or ui.perfetto.dev.
+
+Usage: dv_trace2json.py dv_trace.bin [-o trace.json]
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+MAGIC   = 0x52545644                    # "DVTR"
+HEADER  = struct.Struct("<IHHIIIHH8x")
+RECORD  = struct.Struct("<IIIHBB")
+
+ENTRY, EXIT, EVENT, TEST_START, TEST_END = 1, 2, 3, 4, 5
+FN_EVENT, FN_UNIT = 0xFF, 0xFE
+
+# Function names in the order of the driver access structs
+DRIVERS = {
+    1: ("SPI", ["GetVersion", "GetCapabilities", "Initialize", "Uninitialize", "PowerControl",
+                "Send", "Receive", "Transfer", "GetDataCount", "Control", "GetStatus"]),
+    2: ("USART", ["GetVersion", "GetCapabilities", "Initialize", "Uninitialize", "PowerControl",
+                  "Send", "Receive", "Transfer", "GetTxCount", "GetRxCount", "Control", "GetStatus",
+                  "SetModemControl", "GetModemStatus"]),
+    3: ("ETH_MAC", ["GetVersion", "GetCapabilities", "Initialize", "Uninitialize", "PowerControl",
+                    "GetMacAddress", "SetMacAddress", "SetAddressFilter", "SendFrame", "ReadFrame",
+                    "GetRxFrameSize", "GetRxFrameTime", "GetTxFrameTime", "ControlTimer", "Control",
+                    "PHY_Read", "PHY_Write"]),
+    4: ("CAN", ["GetVersion", "GetCapabilities", "Initialize", "Uninitialize", "PowerControl",
+                "GetClock", "SetBitrate", "SetMode", "ObjectGetCapabilities", "ObjectSetFilter",
+                "ObjectConfigure", "MessageSend", "MessageRead", "Control", "GetStatus"]),
+    5: ("WiFi", ["GetVersion", "GetCapabilities", "Initialize", "Uninitialize", "PowerControl",
+                 "GetModuleInfo", "SetOption", "GetOption", "Scan", "Activate", "Deactivate",
+                 "IsConnected", "GetNetInfo", "BypassControl", "EthSendFrame", "EthReadFrame",
+                 "EthGetRxFrameSize", "SocketCreate", "SocketBind", "SocketListen", "SocketAccept",
+                 "SocketConnect", "SocketRecv", "SocketRecvFrom", "SocketSend", "SocketSendTo",
+                 "SocketGetSockName", "SocketGetPeerName", "SocketGetOpt", "SocketSetOpt",
+                 "SocketClose", "SocketGetHostByName", "Ping"]),
+}
+
+# Event bit names
+EVENTS = {
+    1: ["TRANSFER_COMPLETE", "DATA_LOST", "MODE_FAULT"],
+    2: ["SEND_COMPLETE", "RECEIVE_COMPLETE", "TRANSFER_COMPLETE", "TX_COMPLETE", "TX_UNDERFLOW",
+        "RX_OVERFLOW", "RX_TIMEOUT", "RX_BREAK", "RX_FRAMING_ERROR", "RX_PARITY_ERROR",
+        "CTS", "DSR", "DCD", "RI"],
+    3: ["RX_FRAME", "TX_FRAME", "WAKEUP", "TIMER_ALARM"],
+    4: ["SEND_COMPLETE", "RECEIVE", "RECEIVE_OVERRUN"],
+    5: ["AP_CONNECT", "AP_DISCONNECT", None, None, "ETH_RX_FRAME"],
+}
+CAN_UNIT_EVENTS = ["UNIT_INACTIVE", "UNIT_ACTIVE", "UNIT_WARNING", "UNIT_PASSIVE", "UNIT_BUS_OFF"]
+
+PID        = 1
+TID_TESTS  = 1                          # Track of the traced tests
+TID_EVENTS = 2                          # Track of signaled events (one per driver: 2 + driver)
+
+
+def event_name(drv, fn, event):
+    """Get readable name of a signaled event."""
+    if (drv == 4) and (fn == FN_UNIT):
+        return CAN_UNIT_EVENTS[event] if event < len(CAN_UNIT_EVENTS) else "UNIT_0x%X" % event
+    names = EVENTS.get(drv, [])
+    bits  = []
+    for bit in range(32):
+        if event & (1 << bit):
+            name = names[bit] if (bit < len(names)) and names[bit] else None
+            bits.append(name if name else "0x%X" % (1 << bit))
+    return "|".join(bits) if bits else "0"
+
+
+def signed(val):
+    """Convert 32-bit value to a signed integer (driver return values)."""
+    return val - (1 << 32) if val & 0x80000000 else val
+
+
+def read_dump(data):
+    """Get header, test names and records (oldest first) from a trace ring dump."""
+    if len(data) < HEADER.size:
+        raise ValueError("dump too short")
+    magic, version, rec_size, rec_num, freq, idx, name_num, name_len = HEADER.unpack_from(data, 0)
+    if magic != MAGIC:
+        raise ValueError("not a DV_Trace dump (magic 0x%08X)" % magic)
+    if (version != 1) or (rec_size != RECORD.size):
+        raise ValueError("unsupported trace format (version %d, record size %d)" % (version, rec_size))
+    if freq == 0:
+        raise ValueError("no traced test in the dump")
+
+    names = []
+    offs  = HEADER.size
+    for _ in range(name_num):
+        names.append(data[offs:offs + name_len].split(b"\0", 1)[0].decode("ascii", "replace"))
+        offs += name_len
+    if len(data) < offs + (rec_num * rec_size):
+        raise ValueError("dump too short for %d records" % rec_num)
+
+    recs = []
+    cnt  = min(idx, rec_num)
+    for i in range(idx - cnt, idx):
+        recs.append(RECORD.unpack_from(data, offs + ((i % rec_num) * rec_size)))
+    return freq, names, recs, idx - cnt
+
+
+def convert(freq, names, recs):
+    """Convert trace records into Chrome trace events."""
+    out     = []
+    threads = {}
+    drivers = set()
+    stacks  = {}
+    base    = None
+    last    = 0
+    ts_ext  = 0
+
+    def tid_of(thread):
+        if thread not in threads:
+            threads[thread] = 16 + len(threads)
+        return threads[thread]
+
+    for time, arg, thread, rid, rtype, aux in recs:
+        # Extend 32-bit system timer count (records are in recording order)
+        if base is None:
+            base = time
+            last = time
+        ts_ext += signed((time - last) & 0xFFFFFFFF)
+        last    = time
+        ts      = ts_ext * 1e6 / freq
+
+        drv, fn = rid >> 8, rid & 0xFF
+        dname, fnames = DRIVERS.get(drv, ("DRV%d" % drv, []))
+
+        if rtype in (TEST_START, TEST_END):
+            name = names[aux] if aux < len(names) else "test"
+            out.append({"name": name, "cat": "test", "ph": "B" if rtype == TEST_START else "E",
+                        "ts": ts, "pid": PID, "tid": TID_TESTS})
+        elif rtype == ENTRY:
+            tid  = tid_of(thread)
+            name = "%s_%s" % (dname, fnames[fn] if fn < len(fnames) else "fn%d" % fn)
+            args = {"arg": arg}
+            if aux:
+                args["aux"] = aux
+            stacks.setdefault(tid, []).append(name)
+            out.append({"name": name, "cat": dname, "ph": "B", "ts": ts, "pid": PID, "tid": tid,
+                        "args": args})
+        elif rtype == EXIT:
+            tid = tid_of(thread)
+            if not stacks.get(tid):
+                continue                # Entry overwritten or recorded before the test start
+            stacks[tid].pop()
+            out.append({"ph": "E", "ts": ts, "pid": PID, "tid": tid,
+                        "args": {"return": signed(arg)}})
+        elif rtype == EVENT:
+            drivers.add((drv, dname))
+            args = {"event": "0x%08X" % arg}
+            if drv == 4 and fn == FN_EVENT:
+                args["obj_idx"] = aux
+            out.append({"name": "%s %s" % (dname, event_name(drv, fn, arg)), "cat": dname,
+                        "ph": "i", "s": "t", "ts": ts, "pid": PID, "tid": TID_EVENTS + drv,
+                        "args": args})
+
+    meta = [{"name": "process_name", "ph": "M", "pid": PID, "args": {"name": "CMSIS-Driver Validation"}},
+            {"name": "thread_name", "ph": "M", "pid": PID, "tid": TID_TESTS, "args": {"name": "Tests"}}]
+    for drv, dname in sorted(drivers):
+        meta.append({"name": "thread_name", "ph": "M", "pid": PID, "tid": TID_EVENTS + drv,
+                     "args": {"name": "%s events" % dname}})
+    for thread, tid in threads.items():
+        meta.append({"name": "thread_name", "ph": "M", "pid": PID, "tid": tid,
+                     "args": {"name": "Thread 0x%08X" % thread}})
+    return meta + out
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert a DV_Trace dump into Chrome trace JSON.")
+    parser.add_argument("dump", help="binary dump of the DV_Trace variable (host: dv_trace.bin)")
+    parser.add_argument("-o", "--output", help="output file (default: standard output)")
+    args = parser.parse_args()
+
+    with open(args.dump, "rb") as f:
+        data = f.read()
+    try:
+        freq, names, recs, lost = read_dump(data)
+    except ValueError as e:
+        sys.exit("%s: %s" % (args.dump, e))
+
+    trace = {"traceEvents": convert(freq, names, recs), "displayTimeUnit": "ns",
+             "otherData": {"timer_freq": freq, "records": len(recs), "overwritten": lost}}
+    if args.output:
+        with open(args.output, "w") as f:
+            json.dump(trace, f)
+    else:
+        json.dump(trace, sys.stdout)
+    sys.stderr.write("%d records converted (%d overwritten)\n" % (len(recs), lost))
+
+
+if __name__ == "__main__":
+    main()
@@ -246,17 +246,17 @@ int32_t USART_Server_Start (void) {
   // (maximum size is incremented by 4 bytes to ensure that buffer can be aligned to 4 bytes)
 
   ptr_usart_xfer_buf_rx_alloc = malloc(USART_SERVER_BUF_SIZE + 4U);
-  if (((uint32_t)ptr_usart_xfer_buf_rx_alloc & 3U) != 0U) {
+  if (((uintptr_t)ptr_usart_xfer_buf_rx_alloc & 3U) != 0U) {
     // If allocated memory is not 4 byte aligned, use next 4 byte aligned address for ptr_tx_buf
-    ptr_usart_xfer_buf_rx = (uint8_t *)((((uint32_t)ptr_usart_xfer_buf_rx_alloc) + 3U) & (~3U));
+    ptr_usart_xfer_buf_rx = (uint8_t *)((((uintptr_t)ptr_usart_xfer_buf_rx_alloc) + 3U) & ~(uintptr_t)3U);
   } else {
     // If allocated memory is 4 byte aligned, use it directly
     ptr_usart_xfer_buf_rx = (uint8_t *)ptr_usart_xfer_buf_rx_alloc;
   }
   ptr_usart_xfer_buf_tx_alloc = malloc(USART_SERVER_BUF_SIZE + 4U);
-  if (((uint32_t)ptr_usart_xfer_buf_tx_alloc & 3U) != 0U) {
+  if (((uintptr_t)ptr_usart_xfer_buf_tx_alloc & 3U) != 0U) {
     // If allocated memory is not 4 byte aligned, use next 4 byte aligned address for ptr_tx_buf
-    ptr_usart_xfer_buf_tx = (uint8_t *)((((uint32_t)ptr_usart_xfer_buf_tx_alloc) + 3U) & (~3U));
+    ptr_usart_xfer_buf_tx = (uint8_t *)((((uintptr_t)ptr_usart_xfer_buf_tx_alloc) + 3U) & ~(uintptr_t)3U);
   } else {
     // If allocated memory is 4 byte aligned, use it directly
     ptr_usart_xfer_buf_tx = (uint8_t *)ptr_usart_xfer_buf_tx_alloc;
@@ -589,6 +589,11 @@ static int32_t USART_Com_Receive (void *data_in, uint32_t num, uint32_t timeout)
         if (timeout == osWaitForever) {   // Reception of next command
           for (;;) {
             flags = osThreadFlagsWait(USART_RECEIVE_EVENTS_MASK, osFlagsWaitAny, 1U);
+            if ((flags & (0x80000000U | ARM_USART_EVENT_RECEIVE_COMPLETE)) == ARM_USART_EVENT_RECEIVE_COMPLETE) {
+              // If complete command was received before the check of the received count
+              ret = EXIT_SUCCESS;
+              break;
+            }
             if ((flags & 0x80000000U) != 0U) {    // If timeout
               if (drvUSART->GetRxCount() != 0U) {
                 // If something was received, wait and try to receive complete command
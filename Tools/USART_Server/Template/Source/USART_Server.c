@@ -108,7 +108,6 @@ static int32_t  USART_Com_Break          (uint32_t val);
 static int32_t  USART_Com_SetModemControl(ARM_USART_MODEM_CONTROL control);
 static int32_t  USART_Com_Abort          (void);
 static uint32_t USART_Com_GetCnt         (void);
-static uint32_t USART_Com_GetMdm         (void);
 
 // Command handling functions
 static int32_t  USART_Cmd_GetVer         (const char *cmd);
@@ -128,12 +127,14 @@ static const uint32_t usart_baudrates[] = {
   9600U, 19200U, 38400U, 57600U, 115200U, 230400U, 460800U, 921600U
 };
 
+#ifdef DEBUG
 static const char *str_mode[] = {
   "Unknown",
   "Async",
   "Singl-wire",
   "IrDA"
 };
+#endif
 
 // Command specification (command string, command handling function)
 static const USART_CMD_DESC_t usart_cmd_desc[] = {
@@ -209,10 +210,10 @@ __WEAK void USART_Server_Pin_RI_SetState   (uint32_t state) {}
 */
 int32_t USART_Server_Start (void) {
   int32_t  ret;
-  uint32_t mode, mode_disp;
+#ifdef DEBUG
+  uint32_t mode_disp;
 
-  mode = USART_SERVER_MODE;
-  switch (mode) {
+  switch (USART_SERVER_MODE) {
     case 1:
       mode_disp = 1;
       break;
@@ -227,7 +228,6 @@ int32_t USART_Server_Start (void) {
       break;
   }
 
-#ifdef DEBUG
   printf("USART Server v%s\r\nMode: %s\r\n", USART_SERVER_VER, str_mode[mode_disp]);
 #endif
 
@@ -246,17 +246,17 @@ int32_t USART_Server_Start (void) {
   // (maximum size is incremented by 4 bytes to ensure that buffer can be aligned to 4 bytes)
 
   ptr_usart_xfer_buf_rx_alloc = malloc(USART_SERVER_BUF_SIZE + 4U);
-  if (((uint32_t)ptr_usart_xfer_buf_rx_alloc & 3U) != 0U) {
+  if (((uintptr_t)ptr_usart_xfer_buf_rx_alloc & 3U) != 0U) {
     // If allocated memory is not 4 byte aligned, use next 4 byte aligned address for ptr_tx_buf
-    ptr_usart_xfer_buf_rx = (uint8_t *)((((uint32_t)ptr_usart_xfer_buf_rx_alloc) + 3U) & (~3U));
+    ptr_usart_xfer_buf_rx = (uint8_t *)((((uintptr_t)ptr_usart_xfer_buf_rx_alloc) + 3U) & ~(uintptr_t)3U);
   } else {
     // If allocated memory is 4 byte aligned, use it directly
     ptr_usart_xfer_buf_rx = (uint8_t *)ptr_usart_xfer_buf_rx_alloc;
   }
   ptr_usart_xfer_buf_tx_alloc = malloc(USART_SERVER_BUF_SIZE + 4U);
-  if (((uint32_t)ptr_usart_xfer_buf_tx_alloc & 3U) != 0U) {
+  if (((uintptr_t)ptr_usart_xfer_buf_tx_alloc & 3U) != 0U) {
     // If allocated memory is not 4 byte aligned, use next 4 byte aligned address for ptr_tx_buf
-    ptr_usart_xfer_buf_tx = (uint8_t *)((((uint32_t)ptr_usart_xfer_buf_tx_alloc) + 3U) & (~3U));
+    ptr_usart_xfer_buf_tx = (uint8_t *)((((uintptr_t)ptr_usart_xfer_buf_tx_alloc) + 3U) & ~(uintptr_t)3U);
   } else {
     // If allocated memory is 4 byte aligned, use it directly
     ptr_usart_xfer_buf_tx = (uint8_t *)ptr_usart_xfer_buf_tx_alloc;
@@ -589,6 +589,11 @@ static int32_t USART_Com_Receive (void *data_in, uint32_t num, uint32_t timeout)
         if (timeout == osWaitForever) {   // Reception of next command
           for (;;) {
             flags = osThreadFlagsWait(USART_RECEIVE_EVENTS_MASK, osFlagsWaitAny, 1U);
+            if ((flags & (0x80000000U | ARM_USART_EVENT_RECEIVE_COMPLETE)) == ARM_USART_EVENT_RECEIVE_COMPLETE) {
+              // If complete command was received before the check of the received count
+              ret = EXIT_SUCCESS;
+              break;
+            }
             if ((flags & 0x80000000U) != 0U) {    // If timeout
               if (drvUSART->GetRxCount() != 0U) {
                 // If something was received, wait and try to receive complete command
@@ -1716,7 +1721,7 @@ static int32_t USART_Cmd_GetBrk (const char *cmd) {
 */
 static int32_t USART_Cmd_SetMdm (const char *cmd) {
   const char    *ptr_str;
-        uint32_t val, mdm_ctrl, delay, duration, control;
+        uint32_t val, mdm_ctrl, delay, duration;
          int32_t ret;
 
   ret      = EXIT_SUCCESS;
@@ -1724,7 +1729,6 @@ static int32_t USART_Cmd_SetMdm (const char *cmd) {
   mdm_ctrl = 0U;
   delay    = 0U;
   duration = 0U;
-  control  = 0U;
 
   ptr_str = &cmd[7];                    // Skip "SET MDM"
   while (*ptr_str == ' ') {             // Skip whitespaces